@@ -0,0 +1,136 @@
+/**
+ * @file concurrent_map_bench.cc
+ * @brief Throughput of concurrent_map against a map behind one mutex.
+ *
+ * @details
+ * Every thread runs the same mix of operations on random keys (90% find, 5%
+ * insert, 5% erase) against a map prefilled with half of the key space. The
+ * total throughput is printed for a growing number of threads; the sharded
+ * map should scale with the threads while the single lock serializes them.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "./../s21_containersplus.h"
+
+namespace {
+
+constexpr std::size_t kKeys = 1 << 16;
+constexpr std::size_t kOpsPerThread = 1 << 18;
+
+/**
+ * @brief An s21::map guarded by one mutex, the baseline.
+ */
+class LockedMap {
+ public:
+  bool find(std::uint64_t key) {
+    std::lock_guard lock{mutex_};
+
+    return map_.contains(key);
+  }
+
+  void insert(std::uint64_t key) {
+    std::lock_guard lock{mutex_};
+
+    map_.insert(key, key);
+  }
+
+  void erase(std::uint64_t key) {
+    std::lock_guard lock{mutex_};
+
+    map_.erase(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<const std::uint64_t, std::uint64_t> map_;
+};
+
+/**
+ * @brief The sharded map with the interface of LockedMap.
+ */
+class ShardedMap {
+ public:
+  bool find(std::uint64_t key) { return map_.contains(key); }
+  void insert(std::uint64_t key) { map_.insert(key, key); }
+  void erase(std::uint64_t key) { map_.erase(key); }
+
+ private:
+  s21::concurrent_map<std::uint64_t, std::uint64_t> map_;
+};
+
+/**
+ * @brief Runs the operation mix on several threads and prints the throughput.
+ *
+ * @param[in] name The name of the measured map.
+ * @param[in] threads The number of threads.
+ */
+template <typename Map>
+void measure(const char *name, std::size_t threads) {
+  Map map;
+  std::vector<std::thread> workers;
+
+  for (std::uint64_t key = 0; key < kKeys; key += 2) {
+    map.insert(key);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, t] {
+      std::mt19937_64 rng{t + 1};
+      std::uint64_t found{};
+
+      for (std::size_t op = 0; op < kOpsPerThread; ++op) {
+        std::uint64_t value = rng();
+        std::uint64_t key = value % kKeys;
+
+        switch ((value >> 32) % 20) {
+          case 0:
+            map.insert(key);
+            break;
+          case 1:
+            map.erase(key);
+            break;
+          default:
+            found += map.find(key);
+        }
+      }
+
+      static_cast<void>(found);
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-26s %2zu threads %8.2f Mops/s\n", name, threads,
+              threads * kOpsPerThread / elapsed.count() / 1e6);
+}
+
+}  // namespace
+
+int main() {
+  std::size_t cores = std::thread::hardware_concurrency();
+
+  std::printf("%zu keys, %zu ops per thread, %zu hardware threads\n", kKeys,
+              kOpsPerThread, cores);
+
+  for (std::size_t threads = 1; threads <= 2 * cores || threads <= 8;
+       threads *= 2) {
+    measure<LockedMap>("s21::map + std::mutex", threads);
+    measure<ShardedMap>("s21::concurrent_map", threads);
+  }
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file flat_bench.cc
+ * @brief Memory, lookup and scan of the flat containers against the tree.
+ *
+ * @details
+ * Builds s21::map and s21::flat_map of 64-bit keys and values, and s21::set
+ * and s21::flat_set of 64-bit keys, from the same shuffled keys. The global
+ * operator new is replaced to count the bytes held per element. Then times
+ * random lookups (half of them hit) and an in-order scan summing the keys.
+ * The flat containers are built in one batch with insert_range(), the tree
+ * ones by inserting the keys one by one.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "./../s21_containersplus.h"
+
+namespace {
+
+constexpr std::size_t kElements = 1 << 18;
+constexpr std::size_t kLookups = 1 << 20;
+
+std::size_t live_bytes = 0;  ///< Bytes allocated and not yet freed
+
+/**
+ * @brief Returns the seconds elapsed since start.
+ *
+ * @param[in] start The start of the measurement.
+ * @return double - the elapsed seconds.
+ */
+double since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+/**
+ * @brief Builds a container, then times lookups and a scan on it.
+ *
+ * @tparam Container The measured container.
+ * @tparam Build The type of the callable filling the container.
+ * @param[in] name The name of the measured container.
+ * @param[in] keys The keys to look up, twice as many as the elements.
+ * @param[in] build Fills the container.
+ */
+template <typename Container, typename Build>
+void measure(const char *name, const std::vector<std::uint64_t> &keys,
+             Build build) {
+  std::size_t before = live_bytes;
+  auto start = std::chrono::steady_clock::now();
+  Container container;
+
+  build(container);
+
+  double built = since(start);
+  double bytes = double(live_bytes - before) / container.size();
+  std::uint64_t hits = 0;
+
+  start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < kLookups; ++i) {
+    hits += container.contains(keys[i % keys.size()]);
+  }
+
+  double lookups = since(start);
+  std::uint64_t sum = 0;
+
+  start = std::chrono::steady_clock::now();
+  for (auto it = container.cbegin(); it != container.cend(); ++it) {
+    if constexpr (std::is_same_v<typename Container::key_type,
+                                 typename Container::value_type>) {
+      sum += *it;
+    } else {
+      sum += (*it).first;
+    }
+  }
+
+  std::printf(
+      "%-16s %5.1f B/elem build %6.1f ms lookup %6.1f ns scan %5.2f ns/elem"
+      " (checksum %llu)\n",
+      name, bytes, built * 1e3, lookups * 1e9 / kLookups,
+      since(start) * 1e9 / container.size(),
+      static_cast<unsigned long long>(hits + sum));
+}
+
+}  // namespace
+
+/// @brief Counts an allocation, storing its size before the block.
+void *operator new(std::size_t bytes) {
+  auto *block = static_cast<std::max_align_t *>(
+      std::malloc(bytes + sizeof(std::max_align_t)));
+
+  if (!block) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<std::size_t *>(block) = bytes;
+  live_bytes += bytes;
+  return block + 1;
+}
+
+/// @brief Counts an aligned allocation (alignments up to max_align_t).
+void *operator new(std::size_t bytes, std::align_val_t) {
+  return ::operator new(bytes);
+}
+
+/// @brief Frees a block from operator new.
+void operator delete(void *block) noexcept {
+  if (block) {
+    auto *start = static_cast<std::max_align_t *>(block) - 1;
+
+    live_bytes -= *reinterpret_cast<std::size_t *>(start);
+    std::free(start);
+  }
+}
+
+/// @brief Frees a block from operator new.
+void operator delete(void *block, std::size_t) noexcept {
+  ::operator delete(block);
+}
+
+/// @brief Frees a block from the aligned operator new.
+void operator delete(void *block, std::align_val_t) noexcept {
+  ::operator delete(block);
+}
+
+/// @brief Frees a block from the aligned operator new.
+void operator delete(void *block, std::size_t, std::align_val_t) noexcept {
+  ::operator delete(block);
+}
+
+int main() {
+  std::mt19937_64 rng(42);
+  std::vector<std::uint64_t> inserted(kElements);
+  std::vector<std::uint64_t> keys(2 * kElements);
+
+  for (std::size_t i = 0; i < kElements; ++i) {
+    inserted[i] = 2 * i;
+  }
+  std::shuffle(inserted.begin(), inserted.end(), rng);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = rng() % (4 * kElements);
+  }
+
+  std::printf("%zu elements of 8-byte keys (and 8-byte values)\n", kElements);
+  measure<s21::map<std::uint64_t, std::uint64_t>>(
+      "s21::map", keys, [&](auto &map) {
+        for (std::uint64_t key : inserted) {
+          map.insert(key, key);
+        }
+      });
+  measure<s21::flat_map<std::uint64_t, std::uint64_t>>(
+      "s21::flat_map", keys, [&](auto &map) {
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> pairs;
+
+        for (std::uint64_t key : inserted) {
+          pairs.emplace_back(key, key);
+        }
+        map.insert_range(pairs.begin(), pairs.end());
+      });
+  measure<s21::set<std::uint64_t>>("s21::set", keys, [&](auto &set) {
+    for (std::uint64_t key : inserted) {
+      set.insert(key);
+    }
+  });
+  measure<s21::flat_set<std::uint64_t>>("s21::flat_set", keys,
+                                        [&](auto &set) {
+                                          set.insert_range(inserted.begin(),
+                                                           inserted.end());
+                                        });
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file skiplist_bench.cc
+ * @brief Throughput of skiplist_map against lock-based maps under contention.
+ *
+ * @details
+ * Every thread runs a mix of operations on random keys against a map
+ * prefilled with half of the key space:
+ * - read-mostly: 90% find, 5% insert, 5% erase over the whole key space;
+ * - write-heavy: 50% insert, 50% erase over the whole key space;
+ * - hot range: the write-heavy mix on 64 adjacent keys, so every thread
+ * updates the same few nodes (and the same shard of the sharded map).
+ *
+ * The total throughput is printed for a growing number of threads. The
+ * single lock serializes the threads, the sharded map scales until the keys
+ * collide in a shard, and the skip list only contends on the nodes actually
+ * updated.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "./../s21_containersplus.h"
+
+namespace {
+
+constexpr std::size_t kKeys = 1 << 16;
+constexpr std::size_t kHotKeys = 64;
+constexpr std::size_t kOpsPerThread = 1 << 18;
+
+/**
+ * @brief An operation mix: percentages of inserts and erases, and the range
+ * of keys.
+ */
+struct Workload {
+  const char *name;
+  std::uint64_t insert_percent;
+  std::uint64_t erase_percent;
+  std::uint64_t keys;
+};
+
+/**
+ * @brief An s21::map guarded by one mutex, the baseline.
+ */
+class LockedMap {
+ public:
+  bool find(std::uint64_t key) {
+    std::lock_guard lock{mutex_};
+
+    return map_.contains(key);
+  }
+
+  void insert(std::uint64_t key) {
+    std::lock_guard lock{mutex_};
+
+    map_.insert(key, key);
+  }
+
+  void erase(std::uint64_t key) {
+    std::lock_guard lock{mutex_};
+
+    map_.erase(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<const std::uint64_t, std::uint64_t> map_;
+};
+
+/**
+ * @brief The sharded map with the interface of LockedMap.
+ */
+class ShardedMap {
+ public:
+  bool find(std::uint64_t key) { return map_.contains(key); }
+  void insert(std::uint64_t key) { map_.insert(key, key); }
+  void erase(std::uint64_t key) { map_.erase(key); }
+
+ private:
+  s21::concurrent_map<std::uint64_t, std::uint64_t> map_;
+};
+
+/**
+ * @brief The lock-free skip list with the interface of LockedMap.
+ */
+class SkiplistMap {
+ public:
+  bool find(std::uint64_t key) { return map_.contains(key); }
+  void insert(std::uint64_t key) { map_.insert(key, key); }
+  void erase(std::uint64_t key) { map_.erase(key); }
+
+ private:
+  s21::skiplist_map<std::uint64_t, std::uint64_t> map_;
+};
+
+/**
+ * @brief Runs a workload on several threads and prints the throughput.
+ *
+ * @param[in] name The name of the measured map.
+ * @param[in] workload The operation mix.
+ * @param[in] threads The number of threads.
+ */
+template <typename Map>
+void measure(const char *name, const Workload &workload,
+             std::size_t threads) {
+  Map map;
+  std::vector<std::thread> workers;
+
+  for (std::uint64_t key = 0; key < workload.keys; key += 2) {
+    map.insert(key);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&map, &workload, t] {
+      std::mt19937_64 rng{t + 1};
+      std::uint64_t found{};
+
+      for (std::size_t op = 0; op < kOpsPerThread; ++op) {
+        std::uint64_t value = rng();
+        std::uint64_t key = value % workload.keys;
+        std::uint64_t percent = (value >> 32) % 100;
+
+        if (percent < workload.insert_percent) {
+          map.insert(key);
+        } else if (percent < workload.insert_percent + workload.erase_percent) {
+          map.erase(key);
+        } else {
+          found += map.find(key);
+        }
+      }
+
+      static_cast<void>(found);
+    });
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-12s %-26s %2zu threads %8.2f Mops/s\n", workload.name, name,
+              threads, threads * kOpsPerThread / elapsed.count() / 1e6);
+}
+
+}  // namespace
+
+int main() {
+  std::size_t cores = std::thread::hardware_concurrency();
+  const Workload workloads[] = {{"read-mostly", 5, 5, kKeys},
+                                {"write-heavy", 50, 50, kKeys},
+                                {"hot range", 50, 50, kHotKeys}};
+
+  std::printf("%zu keys, %zu ops per thread, %zu hardware threads\n", kKeys,
+              kOpsPerThread, cores);
+
+  for (const Workload &workload : workloads) {
+    for (std::size_t threads = 1; threads <= 2 * cores || threads <= 8;
+         threads *= 2) {
+      measure<LockedMap>("s21::map + std::mutex", workload, threads);
+      measure<ShardedMap>("s21::concurrent_map", workload, threads);
+      measure<SkiplistMap>("s21::skiplist_map", workload, threads);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file small_vector_bench.cc
+ * @brief Heap allocations and time of small_vector against vector.
+ *
+ * @details
+ * Builds many short vectors of 32-bit integers, the sizes of typical small
+ * collections (1 to 16 elements), with push_back() and then copies each one.
+ * The global operator new is replaced to count the heap allocations per
+ * vector: small_vector<int, 8> allocates none up to 8 elements and one
+ * spill beyond, while vector allocates on every growth and every copy.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "./../s21_containersplus.h"
+
+namespace {
+
+constexpr std::size_t kRounds = 1 << 18;
+
+std::size_t allocations = 0;  ///< Heap allocations since the start
+
+/**
+ * @brief Builds and copies kRounds vectors of a given size.
+ *
+ * @tparam Vector The measured vector type.
+ * @param[in] name The name of the measured vector.
+ * @param[in] size The number of elements of each vector.
+ */
+template <typename Vector>
+void measure(const char *name, std::size_t size) {
+  std::size_t before = allocations;
+  std::uint64_t sum{};
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t round = 0; round < kRounds; ++round) {
+    Vector v;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      v.push_back(int(round + i));
+    }
+
+    Vector copy(v);
+
+    sum += copy[size - 1];
+  }
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-24s %2zu elements %5.2f allocs %6.1f ns (checksum %llu)\n",
+              name, size, double(allocations - before) / kRounds,
+              elapsed.count() * 1e9 / kRounds,
+              static_cast<unsigned long long>(sum));
+}
+
+}  // namespace
+
+/// @brief Counts an allocation.
+void *operator new(std::size_t bytes) {
+  ++allocations;
+  if (void *block = std::malloc(bytes ? bytes : 1)) {
+    return block;
+  }
+  throw std::bad_alloc();
+}
+
+/// @brief Counts an aligned allocation.
+void *operator new(std::size_t bytes, std::align_val_t align) {
+  std::size_t alignment = static_cast<std::size_t>(align);
+
+  ++allocations;
+  if (void *block = std::aligned_alloc(
+          alignment, (bytes + alignment - 1) / alignment * alignment)) {
+    return block;
+  }
+  throw std::bad_alloc();
+}
+
+/// @brief Frees a block from operator new.
+void operator delete(void *block) noexcept { std::free(block); }
+
+/// @brief Frees a block from operator new.
+void operator delete(void *block, std::size_t) noexcept { std::free(block); }
+
+/// @brief Frees a block from the aligned operator new.
+void operator delete(void *block, std::align_val_t) noexcept {
+  std::free(block);
+}
+
+/// @brief Frees a block from the aligned operator new.
+void operator delete(void *block, std::size_t, std::align_val_t) noexcept {
+  std::free(block);
+}
+
+int main() {
+  for (std::size_t size : {1, 2, 4, 8, 16}) {
+    measure<s21::vector<int>>("s21::vector", size);
+    measure<std::vector<int>>("std::vector", size);
+    measure<s21::small_vector<int, 8>>("s21::small_vector<8>", size);
+  }
+
+  return 0;
+}
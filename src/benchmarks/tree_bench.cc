@@ -0,0 +1,133 @@
+/**
+ * @file tree_bench.cc
+ * @brief Lookup and scan throughput of the tree.
+ *
+ * @details
+ * Compares the branchless descent used for scalar keys with the generic
+ * descent (forced off for the same keys through a comparator that opts out of
+ * branchless_search) and with std::map. Half of the lookups hit. The scan
+ * compares in-order iteration of a plain and a threaded map.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "./../s21_containers.h"
+
+/// @brief Plain less-than comparator that opts out of the branchless search.
+struct GenericLess {
+  bool operator()(std::uint64_t a, std::uint64_t b) const { return a < b; }
+};
+
+template <>
+struct s21::branchless_search<const std::uint64_t, GenericLess>
+    : std::false_type {};
+
+namespace {
+
+constexpr std::size_t kLookups = 1 << 21;
+
+/**
+ * @brief Runs all lookups against a container and prints the throughput.
+ *
+ * @param[in] name The name of the measured container.
+ * @param[in] map The container to search.
+ * @param[in] keys The keys to look up.
+ */
+template <typename Map>
+void measure(const char *name, const Map &map,
+             const std::vector<std::uint64_t> &keys) {
+  std::uint64_t found{};
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::uint64_t key : keys) {
+    found += map.find(key) != map.end();
+  }
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-28s %8.1f Mlookups/s (%llu hits)\n", name,
+              keys.size() / elapsed.count() / 1e6,
+              static_cast<unsigned long long>(found));
+}
+
+/**
+ * @brief Iterates over a whole container and prints the throughput.
+ *
+ * @param[in] name The name of the measured container.
+ * @param[in] map The container to iterate over.
+ */
+template <typename Map>
+void measureScan(const char *name, const Map &map) {
+  std::size_t rounds = kLookups / map.size() + 1;
+  std::uint64_t sum{};
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t round = 0; round < rounds; ++round) {
+    for (auto it = map.begin(), end = map.end(); it != end; ++it) {
+      sum += (*it).second;
+    }
+  }
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-28s %8.1f Msteps/s (sum %llu)\n", name,
+              map.size() * rounds / elapsed.count() / 1e6,
+              static_cast<unsigned long long>(sum));
+}
+
+/**
+ * @brief Fills the containers with the same keys and measures them.
+ *
+ * @param[in] size The number of keys in every container.
+ */
+void run(std::size_t size) {
+  std::mt19937_64 rng{42};
+  std::vector<std::uint64_t> inserted(size);
+  std::vector<std::uint64_t> keys(kLookups);
+
+  for (auto &key : inserted) {
+    key = rng() | 1;
+  }
+
+  for (std::size_t i = 0; i < kLookups; ++i) {
+    keys[i] = (i % 2) ? inserted[rng() % size] : rng() & ~1ULL;
+  }
+
+  s21::map<const std::uint64_t, std::uint64_t> branchless;
+  s21::map<const std::uint64_t, std::uint64_t, GenericLess> generic;
+  s21::map<const std::uint64_t, std::uint64_t, std::less<>, true> threaded;
+  std::map<std::uint64_t, std::uint64_t> reference;
+
+  for (std::uint64_t key : inserted) {
+    branchless.insert({key, key});
+    generic.insert({key, key});
+    threaded.insert({key, key});
+    reference.insert({key, key});
+  }
+
+  std::printf("random find, %zu keys, %zu lookups\n", size, kLookups);
+  measure("s21::map (branchless)", branchless, keys);
+  measure("s21::map (generic)", generic, keys);
+  measure("std::map", reference, keys);
+  measureScan("s21::map scan", branchless);
+  measureScan("s21::map scan (threaded)", threaded);
+  measureScan("std::map scan", reference);
+}
+
+}  // namespace
+
+int main() {
+  for (std::size_t size : {1 << 10, 1 << 16, 1 << 20}) {
+    run(size);
+  }
+
+  return 0;
+}
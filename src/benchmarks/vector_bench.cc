@@ -0,0 +1,136 @@
+/**
+ * @file vector_bench.cc
+ * @brief Bulk copy and shift throughput of vector on numeric elements.
+ *
+ * @details
+ * Measures, for s21::vector and std::vector of 64-bit integers, the copy
+ * constructor, growth by push_back(), erasure at the front and insertion at
+ * the front into the capacity freed by the erasures (each erase or insert
+ * shifts the whole tail). The throughput is given in bytes of elements copied
+ * or shifted per second, to compare with the memory bandwidth; trivially
+ * copyable elements go through memcpy() and memmove().
+ *
+ * Then compares the growth policies of s21::vector on the same push_back()
+ * loop: reallocations, bytes copied by them and capacity left unused. The
+ * mapped policy grows blocks of 1 MB and more with mremap(), copying nothing.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "./../s21_containers.h"
+
+namespace {
+
+constexpr std::size_t kElements = 1 << 23;
+constexpr std::size_t kErases = 64;
+
+/**
+ * @brief Prints a throughput in GB/s.
+ *
+ * @param[in] name The name of the measurement.
+ * @param[in] bytes The bytes copied or shifted.
+ * @param[in] start The start of the measurement.
+ */
+void report(const char *name, double bytes,
+            std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-32s %8.2f GB/s\n", name, bytes / elapsed.count() / 1e9);
+}
+
+/**
+ * @brief Runs the four measurements on a vector type.
+ *
+ * @param[in] name The name of the measured vector.
+ */
+template <typename Vector>
+void measure(const char *name) {
+  char label[64];
+  Vector source;
+  std::uint64_t sum{};
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < kElements; ++i) {
+    source.push_back(i);
+  }
+
+  std::snprintf(label, sizeof(label), "%s push_back", name);
+  report(label, kElements * sizeof(std::uint64_t), start);
+
+  start = std::chrono::steady_clock::now();
+
+  for (int round = 0; round < 4; ++round) {
+    Vector copy(source);
+
+    sum += copy[round];
+  }
+
+  std::snprintf(label, sizeof(label), "%s copy", name);
+  report(label, 4.0 * kElements * sizeof(std::uint64_t), start);
+
+  start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < kErases; ++i) {
+    source.erase(source.begin());
+  }
+
+  std::snprintf(label, sizeof(label), "%s erase front", name);
+  report(label, double(kErases) * kElements * sizeof(std::uint64_t), start);
+
+  start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < kErases; ++i) {
+    source.insert(source.begin(), i);
+  }
+
+  std::snprintf(label, sizeof(label), "%s insert front", name);
+  report(label, double(kErases) * kElements * sizeof(std::uint64_t), start);
+  sum += source[0];
+  std::printf("(checksum %llu)\n", static_cast<unsigned long long>(sum));
+}
+
+/**
+ * @brief Grows a vector with a counted growth policy and prints the counters.
+ *
+ * @tparam Policy The growth policy to count.
+ * @param[in] name The name of the policy.
+ */
+template <typename Policy>
+void measureGrowth(const char *name) {
+  s21::vector<std::uint64_t, s21::growth_counted<Policy>> v;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < kElements; ++i) {
+    v.push_back(i);
+  }
+
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  std::printf("%-16s %6.1f ms %3zu reallocs %7.1f MB copied %5.1f%% unused\n",
+              name, elapsed.count() * 1e3, v.growth().reallocations(),
+              v.growth().bytes_copied() / 1e6,
+              100.0 * (v.capacity() - v.size()) / v.capacity());
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%zu elements of 8 bytes\n", kElements);
+  measure<s21::vector<std::uint64_t>>("s21::vector");
+  measure<std::vector<std::uint64_t>>("std::vector");
+  measureGrowth<s21::growth_doubling>("growth x2");
+  measureGrowth<s21::growth_three_halves>("growth x1.5");
+  measureGrowth<s21::growth_step<(1 << 20)>>("growth +1M");
+  measureGrowth<s21::growth_paged<>>("growth x2 paged");
+  measureGrowth<s21::growth_mapped<s21::growth_doubling, (1 << 20)>>(
+      "growth x2 mapped");
+
+  return 0;
+}
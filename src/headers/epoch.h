@@ -0,0 +1,153 @@
+/**
+ * @file epoch.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the epoch-based memory reclamation.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_EPOCH_H_
+#define SRC_HEADERS_EPOCH_H_
+
+#include <atomic>   // for atomic
+#include <cstdint>  // for uint64_t
+#include <limits>   // for max()
+#include <mutex>    // for mutex, lock_guard, unique_lock
+#include <utility>  // for exchange()
+
+#include "./s21_vector.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief Epoch-based reclamation of memory shared by lock-free containers.
+ *
+ * @details
+ * A thread reads shared nodes only inside an epoch_guard, which announces
+ * the global epoch the thread entered in. A node unlinked from a container
+ * is retired rather than deleted: it is kept with the epoch of its
+ * retirement and deleted once the global epoch is two steps further, when
+ * no thread can still be inside a guard that saw it. The epoch only advances
+ * when every thread inside a guard has announced the current one, so a
+ * thread parked inside a guard delays reclamation but never blocks other
+ * threads.
+ *
+ * There is one domain for the whole program (see instance()). Threads
+ * register on their first guard and leave their pending nodes to the domain
+ * when they exit.
+ */
+class epoch_domain {
+ public:
+  // Type aliases
+
+  using size_type = std::size_t;          ///< Size type
+  using deleter_type = void (*)(void *);  ///< Deletes a retired node
+
+  // Constructors/destructor
+
+  epoch_domain() noexcept = default;
+  epoch_domain(const epoch_domain &) = delete;
+  epoch_domain &operator=(const epoch_domain &) = delete;
+  ~epoch_domain();
+
+  // Epoch domain Access
+
+  static epoch_domain &instance();
+
+  // Epoch domain Reclamation
+
+  void retire(void *ptr, deleter_type deleter);
+  void collect();
+  size_type pending() const;
+
+ private:
+  // Container types
+
+  struct Record;
+  struct Retired;
+  class Local;
+
+  // Fields
+
+  static constexpr std::uint64_t kIDLE =
+      std::numeric_limits<std::uint64_t>::max();  ///< Outside any guard
+  static constexpr size_type kCOLLECT_EVERY = 64;  ///< Retirements per pass
+
+  std::atomic<std::uint64_t> epoch_{};  ///< Global epoch
+  std::atomic<Record *> records_{};     ///< Registered threads
+  mutable std::mutex orphans_mutex_;    ///< Guards orphans_
+  vector<Retired> orphans_;             ///< Left by exited threads
+
+  static Local &local();
+  Record *acquireRecord();
+  bool tryAdvance() noexcept;
+  static void reclaim(vector<Retired> &retired, std::uint64_t epoch);
+
+  // Friends
+
+  friend class epoch_guard;
+};
+
+/**
+ * @brief Marks the scope in which the calling thread reads shared nodes.
+ *
+ * @details
+ * Guards nest and can be copied within a thread; the thread leaves its epoch
+ * with the last of them. A guard must be destroyed by the thread that built
+ * it.
+ */
+class epoch_guard {
+ public:
+  // Constructors/assignment operators/destructor
+
+  epoch_guard();
+  epoch_guard(const epoch_guard &other);
+  epoch_guard &operator=(const epoch_guard &other) noexcept;
+  ~epoch_guard();
+};
+
+/**
+ * @brief Announcement slot of one thread, reused after the thread exits.
+ */
+struct epoch_domain::Record {
+  std::atomic<std::uint64_t> epoch{kIDLE};  ///< Announced epoch
+  std::atomic<bool> taken{true};            ///< Owned by a live thread
+  Record *next{};                           ///< Next registered record
+};
+
+/**
+ * @brief A retired node waiting for its deletion.
+ */
+struct epoch_domain::Retired {
+  void *ptr{};             ///< Retired node
+  deleter_type deleter{};  ///< Deletes the node
+  std::uint64_t epoch{};   ///< Epoch of the retirement
+};
+
+/**
+ * @brief State of the calling thread: its record, guard depth and nodes.
+ */
+class epoch_domain::Local {
+ public:
+  // Constructors/destructor
+
+  Local() noexcept = default;
+  ~Local();
+
+  // Fields
+
+  Record *record{};           ///< Announcement slot, taken on the first guard
+  size_type depth{};          ///< Number of live guards
+  vector<Retired> retired{};  ///< Nodes retired by the thread
+};
+
+#include "./../templates/epoch.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_EPOCH_H_
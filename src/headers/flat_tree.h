@@ -0,0 +1,160 @@
+/**
+ * @file flat_tree.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the sorted array behind flat_set and flat_multiset.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_FLAT_TREE_H_
+#define SRC_HEADERS_FLAT_TREE_H_
+
+#include <algorithm>         // for lower_bound, stable_sort, inplace_merge
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <iterator>          // for make_move_iterator
+#include <numeric>           // for iota
+#include <type_traits>       // for conditional_t
+#include <utility>           // for pair, move
+
+#include "./s21_vector.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/// @brief Tells a flat container its input is sorted without duplicates.
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+
+/// @brief Tag value of sorted_unique_t.
+inline constexpr sorted_unique_t sorted_unique{};
+
+/// @brief Tells a flat container its input is sorted, duplicates allowed.
+struct sorted_equivalent_t {
+  explicit sorted_equivalent_t() = default;
+};
+
+/// @brief Tag value of sorted_equivalent_t.
+inline constexpr sorted_equivalent_t sorted_equivalent{};
+
+/**
+ * @brief Keys kept sorted in one vector, searched by binary search.
+ *
+ * @details
+ * The storage of flat_set and flat_multiset: the keys are contiguous, so a
+ * lookup touches O(log n) cache lines of one array and an iteration streams
+ * through memory, with no node per key. Inserting or erasing one key shifts
+ * the keys after it, O(n); batches go through insert_many() and
+ * insert_range(), which append the keys, sort them and merge them in at
+ * once.
+ *
+ * Keys are read-only: iterators are pointers to const keys, invalidated by
+ * every insertion and erasure.
+ *
+ * @tparam K The type of keys.
+ * @tparam C The boolean comparator ordering the keys.
+ * @tparam Unique Whether equivalent keys are rejected.
+ */
+template <typename K, typename C, bool Unique>
+class flat_tree {
+ public:
+  // Type aliases
+
+  using key_type = K;                               ///< Type of keys
+  using value_type = K;                             ///< Type of values
+  using reference = const K &;                      ///< Reference to value
+  using const_reference = const K &;                ///< Const reference
+  using size_type = std::size_t;                    ///< Size type
+  using difference_type = std::ptrdiff_t;           ///< Iterator distance
+  using iterator = const K *;                       ///< Keys are read-only
+  using const_iterator = const K *;                 ///< For read elements
+  using iterator_bool = std::pair<iterator, bool>;  ///< Pair iterator-bool
+  using key_compare = C;                            ///< Orders the keys
+  using container_type = vector<K>;                 ///< Storage of the keys
+  using sorted_tag = std::conditional_t<Unique, sorted_unique_t,
+                                        sorted_equivalent_t>;  ///< Input tag
+
+  // Constructors/assignment operators
+
+  flat_tree() = default;
+  explicit flat_tree(const C &comp);
+  flat_tree(std::initializer_list<value_type> const &items,
+            const C &comp = C());
+  explicit flat_tree(container_type keys, const C &comp = C());
+  flat_tree(sorted_tag, container_type keys, const C &comp = C());
+  flat_tree(const flat_tree &other) = default;
+  flat_tree(flat_tree &&other) = default;
+  flat_tree &operator=(const flat_tree &other);
+  flat_tree &operator=(flat_tree &&other) = default;
+
+  // Flat tree Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Flat tree Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+
+  // Flat tree Modifiers
+
+  void clear() noexcept;
+  iterator_bool insert(const value_type &value);
+  iterator_bool insert(value_type &&value);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  size_type erase(const key_type &key);
+  void swap(flat_tree &other);
+  void merge(flat_tree &other);
+
+  template <typename... Args>
+  iterator_bool emplace(Args &&...args);
+  template <typename... Args>
+  vector<iterator_bool> insert_many(Args &&...args);
+  template <typename InputIt>
+  vector<iterator_bool> insert_range(InputIt first, InputIt last);
+
+  // Flat tree Storage
+
+  const container_type &keys() const noexcept;
+  container_type extract() &&;
+  void replace(container_type keys);
+
+  // Flat tree Lookup
+
+  iterator find(const key_type &key) const;
+  size_type count(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key) const;
+  key_compare key_comp() const;
+
+ private:
+  // Fields
+
+  container_type keys_{};  ///< Sorted keys
+  C comp_{};               ///< Orders the keys
+
+  // Batches
+
+  void sortKeys();
+  vector<iterator_bool> mergeTail(size_type old);
+};
+
+#include "./../templates/flat_tree.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_FLAT_TREE_H_
@@ -0,0 +1,256 @@
+/**
+ * @file growth_policy.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the growth policies of vector.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_GROWTH_POLICY_H_
+#define SRC_HEADERS_GROWTH_POLICY_H_
+
+#include <algorithm>  // for max
+#include <cstddef>    // for size_t
+#include <new>        // for operator new, bad_alloc
+
+#ifdef __linux__
+#include <sys/mman.h>  // for mmap(), mremap(), munmap(), madvise()
+#endif
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief Storage of the growth policies: blocks from operator new.
+ *
+ * @details
+ * Policies inherit the storage functions of vector from here unless they
+ * provide their own (see growth_mapped):
+ *
+ * - allocate(bytes, align) and deallocate(block, bytes, align), the latter
+ *   with the same size and alignment as the former;
+ * - remap(block, old_bytes, new_bytes, align), resizing a block without
+ *   copying it, or returning nullptr when the block must be copied instead;
+ *   the alignment is the one the block was allocated with, and vector only
+ *   calls it for trivially relocatable elements;
+ * - kREMAPS, telling whether remap() can succeed at all.
+ */
+struct growth_heap {
+  static constexpr bool kREMAPS = false;  ///< Whether remap() can succeed
+
+  /**
+   * @brief Allocates a block with operator new.
+   *
+   * @param[in] bytes The size of the block.
+   * @param[in] align The alignment of the block.
+   * @return void* - the block.
+   */
+  void *allocate(std::size_t bytes, std::size_t align) {
+    return ::operator new(bytes, std::align_val_t(align));
+  }
+
+  /**
+   * @brief Frees a block from allocate().
+   *
+   * @param[in] block The block.
+   * @param[in] align The alignment of the block.
+   */
+  void deallocate(void *block, std::size_t, std::size_t align) noexcept {
+    ::operator delete(block, std::align_val_t(align));
+  }
+
+  /// @brief Never resizes a block: it must be copied.
+  void *remap(void *, std::size_t, std::size_t, std::size_t) noexcept {
+    return nullptr;
+  }
+};
+
+/**
+ * @brief Grows the capacity by a constant factor Num / Den.
+ *
+ * @details
+ * A growth policy decides the capacity a vector reallocates to when an
+ * insertion does not fit, and is told about every reallocation. It provides,
+ * besides the storage functions of growth_heap:
+ *
+ * - grow(capacity, required, element_size), returning a capacity of at least
+ *   required elements (the vector clamps it to max_size());
+ * - reallocated(bytes), called after the elements were relocated to new
+ *   storage, with the number of bytes copied (0 for a remapped block).
+ *
+ * The vector inherits from its policy, so a policy without fields costs no
+ * space. reserve() and shrink_to_fit() ask for an exact capacity and do not
+ * consult the policy, but report their reallocations to it.
+ *
+ * A factor of 2 reallocates the least often; a factor of 1.5 overshoots less
+ * and lets the allocator reuse freed blocks for later growth.
+ *
+ * @tparam Num The numerator of the factor.
+ * @tparam Den The denominator of the factor, less than Num.
+ */
+template <std::size_t Num, std::size_t Den = 1>
+struct growth_factor : growth_heap {
+  static_assert(Num > Den, "growth factor must be greater than 1");
+
+  /**
+   * @brief Computes the capacity to grow into.
+   *
+   * @param[in] capacity The current capacity.
+   * @param[in] required The capacity needed by the insertion.
+   * @return std::size_t - capacity * Num / Den, or required if greater.
+   */
+  std::size_t grow(std::size_t capacity, std::size_t required,
+                   std::size_t) const noexcept {
+    return std::max(required,
+                    capacity / Den * Num + capacity % Den * Num / Den);
+  }
+
+  /// @brief Ignores a reallocation.
+  void reallocated(std::size_t) noexcept {}
+};
+
+/// @brief Doubles the capacity (the default of vector).
+using growth_doubling = growth_factor<2>;
+
+/// @brief Grows the capacity by half.
+using growth_three_halves = growth_factor<3, 2>;
+
+/**
+ * @brief Grows the capacity by a fixed number of elements.
+ *
+ * @details
+ * Bounds the unused capacity by Step elements, at the cost of O(n / Step)
+ * reallocations, each copying the whole vector: use a Step large enough to
+ * make the copies rare.
+ *
+ * @tparam Step The number of elements added at each reallocation.
+ */
+template <std::size_t Step>
+struct growth_step : growth_heap {
+  static_assert(Step > 0, "growth step must not be 0");
+
+  /**
+   * @brief Computes the capacity to grow into.
+   *
+   * @param[in] capacity The current capacity.
+   * @param[in] required The capacity needed by the insertion.
+   * @return std::size_t - capacity + Step, or required if greater.
+   */
+  std::size_t grow(std::size_t capacity, std::size_t required,
+                   std::size_t) const noexcept {
+    return std::max(required, capacity + Step);
+  }
+
+  /// @brief Ignores a reallocation.
+  void reallocated(std::size_t) noexcept {}
+};
+
+/**
+ * @brief Rounds the capacity chosen by another policy up to whole pages.
+ *
+ * @details
+ * Large blocks are mapped by the allocator page by page, so the tail of the
+ * last page would be lost anyway: rounding makes it usable capacity.
+ *
+ * @tparam Base The policy choosing the capacity before rounding.
+ * @tparam Page The size of a page in bytes.
+ */
+template <typename Base = growth_doubling, std::size_t Page = 4096>
+struct growth_paged : Base {
+  /**
+   * @brief Computes the capacity to grow into.
+   *
+   * @param[in] capacity The current capacity.
+   * @param[in] required The capacity needed by the insertion.
+   * @param[in] element_size The size of an element in bytes.
+   * @return std::size_t - the capacity of Base, filling its last page.
+   */
+  std::size_t grow(std::size_t capacity, std::size_t required,
+                   std::size_t element_size) const noexcept {
+    std::size_t count = Base::grow(capacity, required, element_size);
+    std::size_t bytes = (count * element_size + Page - 1) / Page * Page;
+
+    return std::max(count, bytes / element_size);
+  }
+};
+
+/**
+ * @brief Counts the reallocations of a vector on top of another policy.
+ *
+ * @details
+ * The counters belong to one vector: they move and swap with its storage, and
+ * a copy of the vector starts from zero.
+ *
+ * @tparam Base The policy choosing the capacity.
+ */
+template <typename Base = growth_doubling>
+class growth_counted : public Base {
+ public:
+  /**
+   * @brief Counts a reallocation.
+   *
+   * @param[in] bytes The number of bytes relocated.
+   */
+  void reallocated(std::size_t bytes) noexcept {
+    ++reallocations_;
+    bytes_copied_ += bytes;
+    Base::reallocated(bytes);
+  }
+
+  /// @brief Returns the number of reallocations.
+  std::size_t reallocations() const noexcept { return reallocations_; }
+
+  /// @brief Returns the number of bytes relocated by the reallocations.
+  std::size_t bytes_copied() const noexcept { return bytes_copied_; }
+
+ private:
+  // Fields
+
+  std::size_t reallocations_{};  ///< Number of reallocations
+  std::size_t bytes_copied_{};   ///< Bytes relocated by them
+};
+
+/**
+ * @brief Maps large blocks directly from the kernel and grows them in place.
+ *
+ * @details
+ * Blocks of at least Threshold bytes are anonymous private mappings. Growing
+ * one with mremap() moves its pages instead of copying them, so a vector of
+ * trivially relocatable elements grows without the copy and without holding
+ * the old and the new block at once. Smaller blocks come from Base.
+ *
+ * With HugePages the mappings are advised to use transparent huge pages,
+ * which cuts page faults and TLB misses on big scans if the kernel allows
+ * it. Outside Linux every block comes from Base.
+ *
+ * @tparam Base The policy choosing the capacity and storing small blocks.
+ * @tparam Threshold The size in bytes from which blocks are mapped.
+ * @tparam HugePages Whether to advise transparent huge pages.
+ */
+template <typename Base = growth_doubling,
+          std::size_t Threshold = (std::size_t(1) << 26),
+          bool HugePages = false>
+struct growth_mapped : Base {
+#ifdef __linux__
+  static constexpr bool kREMAPS = true;  ///< Whether remap() can succeed
+#endif
+
+  void *allocate(std::size_t bytes, std::size_t align);
+  void deallocate(void *block, std::size_t bytes, std::size_t align) noexcept;
+  void *remap(void *block, std::size_t old_bytes, std::size_t new_bytes,
+              std::size_t align) noexcept;
+
+ private:
+  static bool mapped(std::size_t bytes, std::size_t align) noexcept;
+  static void advise(void *block, std::size_t bytes) noexcept;
+};
+
+#include "./../templates/growth_policy.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_GROWTH_POLICY_H_
@@ -0,0 +1,233 @@
+/**
+ * @file persistent_tree.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the persistent RB tree.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_PERSISTENT_TREE_H_
+#define SRC_HEADERS_PERSISTENT_TREE_H_
+
+#include <atomic>       // for atomic
+#include <functional>   // for less
+#include <limits>       // for digits
+#include <type_traits>  // for invoke_result_t, is_void_v
+#include <utility>      // for pair, exchange(), swap()
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A persistent red-black tree.
+ *
+ * @details
+ * Nodes are never modified once built. An update copies only the nodes on the
+ * path to the changed key, together with the few nodes recolored or rotated
+ * on that path, and shares every other subtree with the version it started
+ * from: it allocates O(log n) nodes and returns a new version, while the old
+ * one stays valid and unchanged. Copying a version shares its root, so a
+ * snapshot is O(1).
+ *
+ * Nodes are reference counted with atomic counters and freed with the last
+ * version using them. Any number of threads may therefore read, copy and
+ * update versions sharing nodes without locks, as long as no single tree
+ * object is assigned to while another thread uses it.
+ *
+ * Insertion follows Okasaki and removal follows Kahrs, both rebalancing on
+ * the way back up the search path.
+ *
+ * @tparam K The type of keys stored in the tree.
+ * @tparam M The type of values stored in the tree.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename M, typename C = std::less<K>>
+class persistent_tree {
+ public:
+  // Container types
+
+  class PersistentIterator;
+
+  // Type aliases
+
+  using key_type = K;                                   ///< Type of pairs key
+  using mapped_type = M;                                ///< Type of keys value
+  using value_type = std::pair<key_type, mapped_type>;  ///< Pair key-value
+  using size_type = std::size_t;                        ///< Size type
+  using iterator = PersistentIterator;                  ///< For read elements
+
+  // Constructors
+
+  persistent_tree() noexcept = default;
+  explicit persistent_tree(const C &comp);
+
+  // Persistent tree Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // Persistent tree Capacity
+
+  size_type size() const noexcept;
+
+  // Persistent tree Versions
+
+  persistent_tree insert(const value_type &pair) const;
+  persistent_tree insert_or_assign(const value_type &pair) const;
+  persistent_tree erase(const key_type &key) const;
+  bool shares_root(const persistent_tree &other) const noexcept;
+
+  // Persistent tree Lookup
+
+  iterator find(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  template <typename F>
+  bool for_each(F &&fn) const;
+
+ private:
+  // Container types
+
+  struct Node;
+  class Ref;
+  enum Colors { kRED, kBLACK };
+  enum Side { kLEFT, kRIGHT };
+
+  // Fields
+
+  Ref root_{};        ///< Root of the version
+  size_type size_{};  ///< Size of the version
+  C comp_{};          ///< Orders the keys
+
+  persistent_tree(Ref root, size_type size, const C &comp);
+
+  // Build versions
+
+  persistent_tree update(const value_type &pair, bool assign) const;
+  Ref insertNode(const Ref &node, const value_type &pair, bool assign,
+                 bool &changed, bool &inserted) const;
+  Ref eraseNode(const Ref &node, const key_type &key) const;
+
+  // Rebalancing
+
+  static Ref makeNode(Colors color, Ref left, const value_type &pair,
+                      Ref right);
+  static Ref recolor(const Ref &node, Colors color);
+  static Ref balance(Ref left, const value_type &pair, Ref right);
+  static Ref balanceLeft(Ref left, const value_type &pair, Ref right);
+  static Ref balanceRight(Ref left, const value_type &pair, Ref right);
+  static Ref join(const Ref &left, const Ref &right);
+  static bool isRed(const Ref &node) noexcept;
+  static bool isBlack(const Ref &node) noexcept;
+
+  // Visitation
+
+  template <typename F>
+  static bool visitNode(const Node *node, F &fn);
+};
+
+/**
+ * @brief An owning reference to a shared node.
+ *
+ * @details
+ * Copying the reference increments the counter of the node and destroying it
+ * decrements the counter, deleting the node (and releasing its children) when
+ * no reference is left.
+ */
+template <typename K, typename M, typename C>
+class persistent_tree<K, M, C>::Ref {
+ public:
+  // Constructors
+
+  Ref() noexcept = default;
+  explicit Ref(Node *node) noexcept;
+  Ref(const Ref &other) noexcept;
+  Ref(Ref &&other) noexcept;
+  Ref &operator=(Ref other) noexcept;
+  ~Ref();
+
+  // Access
+
+  const Node *get() const noexcept;
+  const Node *operator->() const noexcept;
+  explicit operator bool() const noexcept;
+
+ private:
+  // Fields
+
+  Node *node_{};  ///< Referenced node
+};
+
+/**
+ * @brief A node of the persistent tree.
+ *
+ * @details
+ * Built with a counter of one, adopted by the Ref returned by makeNode().
+ */
+template <typename K, typename M, typename C>
+struct persistent_tree<K, M, C>::Node {
+  value_type pair;                         ///< Node key
+  Colors color;                            ///< Color of node (red/black)
+  Ref child[2];                            ///< Left and right sons (see Side)
+  mutable std::atomic<size_type> refs{1};  ///< Number of references
+
+  /**
+   * @brief Constructs a new node.
+   *
+   * @param[in] color_ The color of the node.
+   * @param[in] left The left subtree.
+   * @param[in] pair_ The pair of key/value for node.
+   * @param[in] right The right subtree.
+   */
+  Node(Colors color_, Ref left, const value_type &pair_, Ref right)
+      : pair{pair_}, color{color_}, child{std::move(left), std::move(right)} {}
+};
+
+/**
+ * @brief A forward iterator over a version of the persistent tree.
+ *
+ * @details
+ * Nodes have no parent links (they are shared by several versions), so the
+ * iterator keeps the path of ancestors still to visit. Red-black trees are at
+ * most twice as deep as the binary logarithm of their size, which bounds the
+ * path. The iterator is valid as long as a version holding its nodes lives.
+ */
+template <typename K, typename M, typename C>
+class persistent_tree<K, M, C>::PersistentIterator {
+ public:
+  // Constructors
+
+  PersistentIterator() noexcept = default;
+
+  // Operators
+
+  const value_type &operator*() const noexcept;
+  iterator &operator++() noexcept;
+  iterator operator++(int) noexcept;
+  bool operator==(const iterator &other) const noexcept;
+  bool operator!=(const iterator &other) const noexcept;
+
+ private:
+  // Fields
+
+  static constexpr size_type kMAX_DEPTH =
+      2 * std::numeric_limits<size_type>::digits;  ///< Bound of the height
+
+  const Node *path_[kMAX_DEPTH]{};  ///< Current node on top of its ancestors
+  size_type depth_{};               ///< Number of nodes on the path
+
+  void pushLeft(const Node *node) noexcept;
+
+  // Friends
+
+  friend class persistent_tree;
+};
+
+#include "./../templates/persistent_tree.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_PERSISTENT_TREE_H_
@@ -0,0 +1,87 @@
+/**
+ * @file raw_storage.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the raw storage algorithms shared by the vectors.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_RAW_STORAGE_H_
+#define SRC_HEADERS_RAW_STORAGE_H_
+
+#include <algorithm>    // for rotate
+#include <cstddef>      // for size_t
+#include <cstring>      // for memcpy, memmove
+#include <memory>       // for uninitialized_*, destroy_n
+#include <new>          // for operator new, align_val_t
+#include <type_traits>  // for is_trivially_copyable, is_*_v
+#include <utility>      // for forward
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief Tells whether a type can be relocated with memcpy().
+ *
+ * @details
+ * Relocating an object moves it to other storage and ends the lifetime of the
+ * original. For a trivially relocatable type a bitwise copy does both at once:
+ * the copy owns the resources and the original is never destroyed. Every
+ * trivially copyable type qualifies; specialize the trait to std::true_type
+ * for other types that qualify, such as most types holding owning pointers
+ * without pointers into themselves. The vector then grows, inserts and erases
+ * such elements with memcpy() and memmove().
+ *
+ * @tparam T The type to check.
+ */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+/// @brief Value of is_trivially_relocatable.
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+/**
+ * @brief Algorithms on raw storage where only a prefix is constructed.
+ *
+ * @details
+ * vector and small_vector keep their elements in raw storage and insert
+ * through the same steps; only where the storage comes from differs. The
+ * functions here take the storage as arguments and never allocate it, except
+ * for a temporary buffer in shiftIn(). Each one either succeeds or leaves the
+ * elements as they were (shiftIn() excepted, see there), so the containers
+ * only free the storage they allocated when an exception passes through.
+ *
+ * @tparam T The type of the elements.
+ */
+template <typename T>
+struct raw_storage {
+  using size_type = std::size_t;  ///< Size type
+
+  static constexpr size_type kSTASH = 256;  ///< Bytes set aside on the stack
+
+  /// @brief Whether elements can be shifted within the storage on insertion.
+  static constexpr bool kSHIFTS =
+      is_trivially_relocatable_v<T> || std::is_move_assignable_v<T>;
+
+  static void relocate(T *first, T *last, T *dest);
+  template <typename Fill>
+  static void shiftIn(T *array, size_type &size, size_type index,
+                      size_type count, Fill &fill);
+  template <typename Fill>
+  static void buildAround(T *array, size_type size, size_type index,
+                          size_type count, T *dest, Fill &fill);
+  template <typename... Args>
+  static void constructEach(T *dest, Args &&...args);
+};
+
+#include "./../templates/raw_storage.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_RAW_STORAGE_H_
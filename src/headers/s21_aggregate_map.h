@@ -0,0 +1,181 @@
+/**
+ * @file s21_aggregate_map.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the aggregate map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_AGGREGATE_MAP_H_
+#define SRC_HEADERS_S21_AGGREGATE_MAP_H_
+
+#include <algorithm>         // for min(), max()
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <limits>            // for max(), lowest()
+#include <stdexcept>         // for out_of_range
+#include <utility>           // for pair
+
+#include "./tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief Monoid adding values.
+ *
+ * @tparam T The type of values.
+ */
+template <typename T>
+struct sum_monoid {
+  /// @brief Returns the neutral element.
+  T identity() const { return T{}; }
+
+  /// @brief Combines two values.
+  T operator()(const T &a, const T &b) const { return a + b; }
+};
+
+/**
+ * @brief Monoid keeping the lowest value.
+ *
+ * @tparam T The type of values.
+ */
+template <typename T>
+struct min_monoid {
+  /// @brief Returns the neutral element.
+  T identity() const { return std::numeric_limits<T>::max(); }
+
+  /// @brief Combines two values.
+  T operator()(const T &a, const T &b) const { return std::min(a, b); }
+};
+
+/**
+ * @brief Monoid keeping the greatest value.
+ *
+ * @tparam T The type of values.
+ */
+template <typename T>
+struct max_monoid {
+  /// @brief Returns the neutral element.
+  T identity() const { return std::numeric_limits<T>::lowest(); }
+
+  /// @brief Combines two values.
+  T operator()(const T &a, const T &b) const { return std::max(a, b); }
+};
+
+/**
+ * @brief An ordered map answering range aggregate queries in O(log n).
+ *
+ * @details
+ * The map is a red-black tree (see tree) in which every node also keeps the
+ * aggregate of the values in its subtree. The aggregates are refreshed along
+ * the path of every insertion and removal and at every rotation, which keeps
+ * updates at O(log n), and aggregate(lo, hi) combines O(log n) stored
+ * aggregates instead of visiting every element of the range.
+ *
+ * Values can only be changed through insert_or_assign(), so elements are
+ * accessed through constant references and iterators.
+ *
+ * @tparam K The type of keys stored in the map.
+ * @tparam V The type of values stored in the map.
+ * @tparam Monoid The aggregate. A default constructible type with an
+ * identity() member returning the neutral element and an associative call
+ * operator combining two values; it need not be commutative, values are
+ * combined in key order.
+ * @tparam C The comparator ordering the keys.
+ */
+template <typename K, typename V, typename Monoid = sum_monoid<V>,
+          typename C = std::less<K>>
+class aggregate_map {
+  struct Summary;
+
+  using tree_type = tree<const K, V, C, false, Summary>;  ///< Tree type
+
+ public:
+  // Type aliases
+
+  typedef typename tree_type::const_iterator AggregateMapConstIterator;
+  using key_type = K;                                ///< Type of pairs key
+  using mapped_type = V;                             ///< Type of keys value
+  using value_type = std::pair<const K, V>;          ///< Pair key-value
+  using const_reference = const value_type &;        ///< Const reference
+  using size_type = std::size_t;                     ///< Size type
+  using const_iterator = AggregateMapConstIterator;  ///< For read elements
+  using iterator = const_iterator;                   ///< Elements are read-only
+  using iterator_bool = std::pair<iterator, bool>;   ///< Pair iterator-bool
+
+  // Constructors
+
+  aggregate_map() noexcept = default;
+  explicit aggregate_map(const C &comp);
+  aggregate_map(std::initializer_list<value_type> const &items);
+
+  // Aggregate map Element access
+
+  const mapped_type &at(const key_type &key) const;
+
+  // Aggregate map Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // Aggregate map Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Aggregate map Modifiers
+
+  void clear() noexcept;
+  iterator_bool insert(const_reference value);
+  iterator_bool insert_or_assign(const key_type &key, const mapped_type &obj);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);
+
+  // Aggregate map Lookup
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+
+  // Aggregate map Aggregates
+
+  mapped_type aggregate() const;
+  mapped_type aggregate(const key_type &lo, const key_type &hi) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+ private:
+  // Fields
+
+  tree_type tree_{};  ///< Tree of elements
+};
+
+/**
+ * @brief Summary policy of the underlying tree.
+ *
+ * @details
+ * The summary of a subtree is the Monoid aggregate of its values.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+struct aggregate_map<K, V, Monoid, C>::Summary {
+  using type = V;  ///< Summary type
+
+  /// @brief Returns the summary of a single element.
+  V operator()(const value_type &pair) const { return pair.second; }
+
+  /// @brief Combines the summaries of two adjacent key ranges.
+  V operator()(const V &a, const V &b) const { return Monoid{}(a, b); }
+};
+
+#include "./../templates/aggregate_map.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_AGGREGATE_MAP_H_
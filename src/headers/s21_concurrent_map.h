@@ -0,0 +1,140 @@
+/**
+ * @file s21_concurrent_map.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the sharded concurrent map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_CONCURRENT_MAP_H_
+#define SRC_HEADERS_S21_CONCURRENT_MAP_H_
+
+#include <algorithm>         // for push_heap(), pop_heap()
+#include <functional>        // for less, hash
+#include <initializer_list>  // for init_list type
+#include <memory>            // for make_unique()
+#include <mutex>             // for unique_lock
+#include <optional>          // for optional
+#include <shared_mutex>      // for shared_mutex, shared_lock
+#include <type_traits>       // for invoke_result_t, is_void_v
+#include <utility>           // for pair
+
+#include "./tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief An ordered map safe for concurrent use, with striped locking.
+ *
+ * @details
+ * Keys are spread over a fixed number of shards by their hash. Every shard is
+ * a red-black tree (see tree) guarded by its own reader-writer lock, so
+ * lookups of any keys run in parallel and updates of keys in different shards
+ * do not wait for each other. Every operation locks one shard, except the
+ * ordered traversals, which hold the read locks of all shards (taken in shard
+ * order) and merge the shards with a heap in O(n log s) for s shards.
+ *
+ * Elements are never handed out by reference: find() returns a copy of the
+ * value and visit() runs a function under the lock of the shard.
+ *
+ * @tparam K The type of keys stored in the map.
+ * @tparam M The type of values stored in the map.
+ * @tparam C The boolean comparator ordering the keys.
+ * @tparam H The hash spreading the keys over the shards.
+ */
+template <typename K, typename M, typename C = std::less<K>,
+          typename H = std::hash<K>>
+class concurrent_map {
+  using tree_type = tree<const K, M, C>;  ///< Tree type
+
+ public:
+  // Type aliases
+
+  using key_type = K;                          ///< Type of pairs key
+  using mapped_type = M;                       ///< Type of keys value
+  using value_type = std::pair<const K, M>;    ///< Pair key-value
+  using const_reference = const value_type &;  ///< Const reference
+  using size_type = std::size_t;               ///< Size type
+
+  static constexpr size_type kDEFAULT_SHARDS = 64;  ///< Default shard count
+
+  // Constructors/destructor
+
+  explicit concurrent_map(size_type shards = kDEFAULT_SHARDS,
+                          const C &comp = C{}, const H &hash = H{});
+  concurrent_map(std::initializer_list<value_type> const &items);
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map();
+
+  // Concurrent map Capacity
+
+  bool empty() const;
+  size_type size() const;
+  size_type shard_count() const noexcept;
+
+  // Concurrent map Modifiers
+
+  void clear();
+  bool insert(const_reference value);
+  bool insert(const key_type &key, const mapped_type &obj);
+  bool insert_or_assign(const key_type &key, const mapped_type &obj);
+  size_type erase(const key_type &key);
+
+  // Concurrent map Lookup
+
+  std::optional<mapped_type> find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  template <typename F>
+  bool visit(const key_type &key, F &&fn);
+
+  // Concurrent map Ordered traversal
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+ private:
+  // Container types
+
+  struct Shard;
+  using Cursor = std::pair<typename tree_type::const_iterator,
+                           typename tree_type::const_iterator>;
+
+  // Fields
+
+  Shard *shards_{};    ///< Shards of the map
+  size_type count_{};  ///< Number of shards
+  C comp_{};           ///< Orders the keys
+  H hash_{};           ///< Selects the shard of a key
+
+  Shard &shardOf(const key_type &key) const noexcept;
+  template <typename F>
+  bool visitMerged(const key_type *lo, const key_type *hi, F &fn) const;
+};
+
+/**
+ * @brief A tree with its lock, alone on its cache lines.
+ *
+ * @details
+ * The alignment keeps threads locking neighbouring shards from invalidating
+ * each other's cache lines.
+ */
+template <typename K, typename M, typename C, typename H>
+struct alignas(64) concurrent_map<K, M, C, H>::Shard {
+  mutable std::shared_mutex mutex;  ///< Guards the tree
+  tree_type tree;                   ///< Elements of the shard
+};
+
+#include "./../templates/concurrent_map.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_CONCURRENT_MAP_H_
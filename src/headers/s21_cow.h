@@ -0,0 +1,119 @@
+/**
+ * @file s21_cow.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the copy-on-write container handle.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_COW_H_
+#define SRC_HEADERS_S21_COW_H_
+
+#include <atomic>       // for atomic
+#include <stdexcept>    // for logic_error
+#include <type_traits>  // for is_default_constructible_v
+#include <utility>      // for exchange(), forward(), in_place_t, swap()
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A copy-on-write handle to a container.
+ *
+ * @details
+ * Copies of the handle share one container through an atomic reference
+ * counter, so copying is O(1) whatever the size of the container. Reads go
+ * through the constant accessors; write() first copies the container if it
+ * is shared and then returns it for modification. A container passed around
+ * read-only is therefore never copied.
+ *
+ * Handles sharing a container may be used from different threads, as long as
+ * no single handle is used by two threads while one of them writes or
+ * assigns it. A reference obtained from write() must not be used after the
+ * handle has been copied again.
+ *
+ * A moved from handle holds no container. It reads as an empty container and
+ * write() gives it a new one; use_count() is 0 until then. For a type that
+ * is not default constructible, a moved from handle may only be assigned to
+ * or destroyed.
+ *
+ * Intended for s21::map, s21::set and s21::vector, which hand out mutable
+ * references from their constant members and so cannot detect writes on
+ * their own; works with any copy constructible type.
+ *
+ * @tparam T The type of the shared container.
+ */
+template <typename T>
+class cow {
+ public:
+  // Type aliases
+
+  using value_type = T;           ///< Type of the container
+  using size_type = std::size_t;  ///< Size type
+
+  // Constructors/assignment operators/destructor
+
+  cow();
+  explicit cow(const value_type &value);
+  explicit cow(value_type &&value);
+  template <typename... Args>
+  explicit cow(std::in_place_t, Args &&...args);
+  cow(const cow &other) noexcept;
+  cow(cow &&other) noexcept;
+  cow &operator=(cow other) noexcept;
+  ~cow();
+
+  // Cow Access
+
+  const value_type &operator*() const noexcept;
+  const value_type *operator->() const noexcept;
+  const value_type &read() const noexcept;
+  value_type &write();
+
+  // Cow Sharing
+
+  size_type use_count() const noexcept;
+  bool unique() const noexcept;
+  void swap(cow &other) noexcept;
+
+ private:
+  // Container types
+
+  struct Block;
+
+  // Fields
+
+  Block *block_{};  ///< Shared container with its counter
+
+  // Access
+
+  const value_type &shared() const noexcept;
+};
+
+/**
+ * @brief The shared container and the number of handles sharing it.
+ */
+template <typename T>
+struct cow<T>::Block {
+  value_type value;                ///< Shared container
+  std::atomic<size_type> refs{1};  ///< Number of handles
+
+  /**
+   * @brief Constructs the container from arguments.
+   *
+   * @param[in] args The arguments for the container constructor.
+   */
+  template <typename... Args>
+  explicit Block(std::in_place_t, Args &&...args)
+      : value(std::forward<Args>(args)...) {}
+};
+
+#include "./../templates/cow.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_COW_H_
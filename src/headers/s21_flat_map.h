@@ -0,0 +1,355 @@
+/**
+ * @file s21_flat_map.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the flat map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_FLAT_MAP_H_
+#define SRC_HEADERS_S21_FLAT_MAP_H_
+
+#include <algorithm>         // for lower_bound, stable_sort
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <iterator>          // for random_access_iterator_tag
+#include <numeric>           // for iota
+#include <stdexcept>         // for out_of_range, invalid_argument
+#include <type_traits>       // for conditional_t, enable_if_t
+#include <utility>           // for pair, move
+
+#include "./flat_tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A map with unique keys kept sorted in a vector.
+ *
+ * @details
+ * The keys and the values live in two vectors of the same size, the value of
+ * keys()[i] being values()[i]. A lookup is a binary search over the keys
+ * alone, so it touches neither the values nor any node, and iterating
+ * streams through both arrays. The map costs the size of its keys and values
+ * plus the spare capacity of the vectors, against a node of three pointers
+ * and a color per element for map.
+ *
+ * Single insertions and erasures shift the elements after them; batches go
+ * through insert_many() and insert_range(), which append the elements, sort
+ * them and merge them in at once, and a map built from two vectors sorts
+ * them once. If a batch throws the map is left empty.
+ *
+ * Elements are not stored as pairs: dereferencing an iterator gives a pair
+ * of references, std::pair<const K &, M &>, by value. Iterators are
+ * invalidated by every insertion and erasure. The two vectors can be taken
+ * out with extract() and put back with replace().
+ *
+ * @tparam K The type of keys.
+ * @tparam M The type of values.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename M, typename C = std::less<K>>
+class flat_map {
+ public:
+  // Container types
+
+  template <bool Const>
+  class FlatMapIterator;
+
+  // Type aliases
+
+  using key_type = K;                                       ///< Type of keys
+  using mapped_type = M;                                    ///< Type of values
+  using value_type = std::pair<K, M>;                       ///< Pair key-value
+  using reference = std::pair<const K &, M &>;              ///< Key and value
+  using const_reference = std::pair<const K &, const M &>;  ///< Read-only pair
+  using size_type = std::size_t;                            ///< Size type
+  using difference_type = std::ptrdiff_t;                   ///< Distance
+  using iterator = FlatMapIterator<false>;                  ///< For read/write
+  using const_iterator = FlatMapIterator<true>;             ///< Read-only
+  using iterator_bool = std::pair<iterator, bool>;          ///< Iterator-bool
+  using key_compare = C;                                    ///< Orders the keys
+  using key_container_type = vector<K>;                     ///< Key storage
+  using mapped_container_type = vector<M>;                  ///< Value storage
+
+  /// @brief The two vectors of a flat map, as extract() gives them.
+  struct containers {
+    key_container_type keys;       ///< Sorted keys
+    mapped_container_type values;  ///< Values, in the order of the keys
+  };
+
+  // Constructors/assignment operators
+
+  flat_map() = default;
+  explicit flat_map(const C &comp);
+  flat_map(std::initializer_list<value_type> const &items,
+           const C &comp = C());
+  flat_map(key_container_type keys, mapped_container_type values,
+           const C &comp = C());
+  flat_map(sorted_unique_t, key_container_type keys,
+           mapped_container_type values, const C &comp = C());
+  flat_map(const flat_map &other) = default;
+  flat_map(flat_map &&other) = default;
+  flat_map &operator=(const flat_map &other);
+  flat_map &operator=(flat_map &&other) = default;
+
+  // Flat map Element access
+
+  mapped_type &at(const key_type &key);
+  const mapped_type &at(const key_type &key) const;
+  mapped_type &operator[](const key_type &key);
+  mapped_type &operator[](key_type &&key);
+
+  // Flat map Iterators
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Flat map Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+
+  // Flat map Modifiers
+
+  void clear() noexcept;
+  iterator_bool insert(const value_type &value);
+  iterator_bool insert(value_type &&value);
+  iterator_bool insert(const key_type &key, const mapped_type &obj);
+  iterator_bool insert_or_assign(const key_type &key, const mapped_type &obj);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  size_type erase(const key_type &key);
+  void swap(flat_map &other);
+  void merge(flat_map &other);
+
+  template <typename... Args>
+  iterator_bool emplace(Args &&...args);
+  template <typename... Args>
+  iterator_bool try_emplace(const key_type &key, Args &&...args);
+  template <typename... Args>
+  iterator_bool try_emplace(key_type &&key, Args &&...args);
+  template <typename... Args>
+  vector<iterator_bool> insert_many(Args &&...args);
+  template <typename InputIt>
+  vector<iterator_bool> insert_range(InputIt first, InputIt last);
+
+  // Flat map Storage
+
+  const key_container_type &keys() const noexcept;
+  const mapped_container_type &values() const noexcept;
+  containers extract() &&;
+  void replace(key_container_type keys, mapped_container_type values);
+
+  // Flat map Lookup
+
+  iterator find(const key_type &key);
+  const_iterator find(const key_type &key) const;
+  size_type count(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key);
+  const_iterator lower_bound(const key_type &key) const;
+  iterator upper_bound(const key_type &key);
+  const_iterator upper_bound(const key_type &key) const;
+  key_compare key_comp() const;
+
+ private:
+  // Fields
+
+  key_container_type keys_{};       ///< Sorted keys
+  mapped_container_type values_{};  ///< Values, in the order of the keys
+  C comp_{};                        ///< Orders the keys
+
+  // Positions
+
+  size_type lowerIndex(const key_type &key) const;
+  size_type upperIndex(const key_type &key) const;
+  size_type findIndex(const key_type &key) const;
+  iterator iteratorAt(size_type index) noexcept;
+  const_iterator iteratorAt(size_type index) const noexcept;
+
+  // Insertion
+
+  template <typename Key, typename... Args>
+  iterator_bool tryInsert(Key &&key, Args &&...args);
+  void appendPair(value_type &&pair);
+  void truncate(size_type size);
+
+  // Batches
+
+  void checkSizes() const;
+  void sortPairs();
+  vector<iterator_bool> mergeTail(size_type old);
+};
+
+/**
+ * @brief A random access iterator over the two vectors of a flat map.
+ *
+ * @details
+ * Holds a pointer into each vector and gives pairs of references to the key
+ * and the value; operator->() returns a proxy holding such a pair. An
+ * iterator converts to a const_iterator.
+ *
+ * @tparam Const Whether the values are read-only.
+ */
+template <typename K, typename M, typename C>
+template <bool Const>
+class flat_map<K, M, C>::FlatMapIterator {
+  using value_pointer = std::conditional_t<Const, const M *, M *>;
+
+ public:
+  // Type aliases
+
+  using value_type = std::pair<K, M>;      ///< Type of values
+  using difference_type = std::ptrdiff_t;  ///< Distance between iterators
+  using iterator_category =
+      std::random_access_iterator_tag;  ///< Iterator category
+  using reference =
+      std::conditional_t<Const, typename flat_map::const_reference,
+                         typename flat_map::reference>;  ///< Pair of refs
+
+  /// @brief Gives operator->() a pair of references to point to.
+  struct Arrow {
+    reference pair;  ///< The element
+
+    /// @brief Returns the pair of references.
+    const reference *operator->() const noexcept { return &pair; }
+  };
+
+  using pointer = Arrow;  ///< Result of operator->()
+
+  // Constructors
+
+  FlatMapIterator() noexcept = default;
+
+  /// @brief Converts an iterator to a const_iterator.
+  template <bool Other, typename = std::enable_if_t<Const && !Other>>
+  FlatMapIterator(const FlatMapIterator<Other> &other) noexcept
+      : key_{other.key_}, value_{other.value_} {}
+
+  // Element access
+
+  /// @brief Returns references to the key and the value.
+  reference operator*() const noexcept { return {*key_, *value_}; }
+
+  /// @brief Returns a proxy pointing to the references.
+  pointer operator->() const noexcept { return {**this}; }
+
+  /// @brief Returns references to the element n positions away.
+  reference operator[](difference_type n) const noexcept {
+    return {key_[n], value_[n]};
+  }
+
+  // Increment/Decrement
+
+  /// @brief Moves to the next element.
+  FlatMapIterator &operator++() noexcept { return *this += 1; }
+
+  /// @brief Moves to the next element, returning the previous position.
+  FlatMapIterator operator++(int) noexcept {
+    FlatMapIterator old = *this;
+
+    ++*this;
+    return old;
+  }
+
+  /// @brief Moves to the previous element.
+  FlatMapIterator &operator--() noexcept { return *this -= 1; }
+
+  /// @brief Moves to the previous element, returning the previous position.
+  FlatMapIterator operator--(int) noexcept {
+    FlatMapIterator old = *this;
+
+    --*this;
+    return old;
+  }
+
+  // Pointer arithmetic
+
+  /// @brief Moves n elements forward.
+  FlatMapIterator &operator+=(difference_type n) noexcept {
+    key_ += n;
+    value_ += n;
+    return *this;
+  }
+
+  /// @brief Moves n elements backward.
+  FlatMapIterator &operator-=(difference_type n) noexcept {
+    return *this += -n;
+  }
+
+  /// @brief Returns the iterator n elements forward.
+  FlatMapIterator operator+(difference_type n) const noexcept {
+    return FlatMapIterator(*this) += n;
+  }
+
+  /// @brief Returns the iterator n elements backward.
+  FlatMapIterator operator-(difference_type n) const noexcept {
+    return FlatMapIterator(*this) -= n;
+  }
+
+  /// @brief Returns the distance from other to this iterator.
+  difference_type operator-(const FlatMapIterator &other) const noexcept {
+    return key_ - other.key_;
+  }
+
+  // Comparison
+
+  friend bool operator==(const FlatMapIterator &a,
+                         const FlatMapIterator &b) noexcept {
+    return a.key_ == b.key_;
+  }
+  friend bool operator!=(const FlatMapIterator &a,
+                         const FlatMapIterator &b) noexcept {
+    return a.key_ != b.key_;
+  }
+  friend bool operator<(const FlatMapIterator &a,
+                        const FlatMapIterator &b) noexcept {
+    return a.key_ < b.key_;
+  }
+  friend bool operator>(const FlatMapIterator &a,
+                        const FlatMapIterator &b) noexcept {
+    return b < a;
+  }
+  friend bool operator<=(const FlatMapIterator &a,
+                         const FlatMapIterator &b) noexcept {
+    return !(b < a);
+  }
+  friend bool operator>=(const FlatMapIterator &a,
+                         const FlatMapIterator &b) noexcept {
+    return !(a < b);
+  }
+
+ private:
+  // Fields
+
+  const K *key_{};         ///< Key of the element
+  value_pointer value_{};  ///< Value of the element
+
+  /// @brief Points to the element with the given key and value.
+  FlatMapIterator(const K *key, value_pointer value) noexcept
+      : key_{key}, value_{value} {}
+
+  // Friends
+
+  friend class flat_map;
+  template <bool>
+  friend class FlatMapIterator;
+};
+
+#include "./../templates/flat_map.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_FLAT_MAP_H_
@@ -0,0 +1,106 @@
+/**
+ * @file s21_flat_multiset.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the flat multiset container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_FLAT_MULTISET_H_
+#define SRC_HEADERS_S21_FLAT_MULTISET_H_
+
+#include <functional>  // for less
+
+#include "./flat_tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A multiset of keys kept sorted in a vector.
+ *
+ * @details
+ * As flat_set, with equivalent keys allowed: a key is inserted after its
+ * equivalents, so they keep the order of insertion. The sorted input of
+ * bulk construction and replace() is tagged sorted_equivalent.
+ *
+ * @tparam K The type of keys.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename C = std::less<K>>
+class flat_multiset : private flat_tree<K, C, false> {
+  using base = flat_tree<K, C, false>;
+
+ public:
+  // Type aliases
+
+  using typename base::const_iterator;
+  using typename base::const_reference;
+  using typename base::container_type;
+  using typename base::difference_type;
+  using typename base::iterator;
+  using typename base::key_compare;
+  using typename base::key_type;
+  using typename base::reference;
+  using typename base::size_type;
+  using typename base::value_type;
+  using iterator_range = std::pair<iterator, iterator>;  ///< Range of keys
+
+  // Constructors
+
+  using base::base;
+  flat_multiset() = default;
+
+  // Flat multiset Iterators
+
+  using base::begin;
+  using base::cbegin;
+  using base::cend;
+  using base::end;
+
+  // Flat multiset Capacity
+
+  using base::empty;
+  using base::max_size;
+  using base::reserve;
+  using base::size;
+
+  // Flat multiset Modifiers
+
+  using base::clear;
+  using base::erase;
+  using base::insert_many;
+  using base::insert_range;
+  iterator insert(const value_type &value);
+  iterator insert(value_type &&value);
+  template <typename... Args>
+  iterator emplace(Args &&...args);
+  void swap(flat_multiset &other);
+  void merge(flat_multiset &other);
+
+  // Flat multiset Storage
+
+  using base::extract;
+  using base::keys;
+  using base::replace;
+
+  // Flat multiset Lookup
+
+  using base::contains;
+  using base::count;
+  using base::equal_range;
+  using base::find;
+  using base::key_comp;
+  using base::lower_bound;
+  using base::upper_bound;
+};
+
+#include "./../templates/flat_multiset.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_FLAT_MULTISET_H_
@@ -0,0 +1,111 @@
+/**
+ * @file s21_flat_set.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the flat set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_FLAT_SET_H_
+#define SRC_HEADERS_S21_FLAT_SET_H_
+
+#include <functional>  // for less
+
+#include "./flat_tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A set of unique keys kept sorted in a vector.
+ *
+ * @details
+ * The interface of set over a flat_tree: lookups are binary searches in
+ * contiguous memory and the set costs the size of its keys plus the spare
+ * capacity of the vector, instead of a node of three pointers and a color
+ * per key. Single insertions and erasures shift the keys after them;
+ * insert_many() and insert_range() merge a whole batch at once, and a set
+ * built from a vector sorts it once. Iterators are pointers to const keys,
+ * invalidated by every modification.
+ *
+ * The keys can be taken out with extract() and put back, sorted, with
+ * replace() or the sorted_unique constructor.
+ *
+ * @tparam K The type of keys.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename C = std::less<K>>
+class flat_set : private flat_tree<K, C, true> {
+  using base = flat_tree<K, C, true>;
+
+ public:
+  // Type aliases
+
+  using typename base::const_iterator;
+  using typename base::const_reference;
+  using typename base::container_type;
+  using typename base::difference_type;
+  using typename base::iterator;
+  using typename base::iterator_bool;
+  using typename base::key_compare;
+  using typename base::key_type;
+  using typename base::reference;
+  using typename base::size_type;
+  using typename base::value_type;
+
+  // Constructors
+
+  using base::base;
+  flat_set() = default;
+
+  // Flat set Iterators
+
+  using base::begin;
+  using base::cbegin;
+  using base::cend;
+  using base::end;
+
+  // Flat set Capacity
+
+  using base::empty;
+  using base::max_size;
+  using base::reserve;
+  using base::size;
+
+  // Flat set Modifiers
+
+  using base::clear;
+  using base::emplace;
+  using base::erase;
+  using base::insert;
+  using base::insert_many;
+  using base::insert_range;
+  void swap(flat_set &other);
+  void merge(flat_set &other);
+
+  // Flat set Storage
+
+  using base::extract;
+  using base::keys;
+  using base::replace;
+
+  // Flat set Lookup
+
+  using base::contains;
+  using base::count;
+  using base::equal_range;
+  using base::find;
+  using base::key_comp;
+  using base::lower_bound;
+  using base::upper_bound;
+};
+
+#include "./../templates/flat_set.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_FLAT_SET_H_
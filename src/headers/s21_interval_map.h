@@ -0,0 +1,194 @@
+/**
+ * @file s21_interval_map.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the interval map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_INTERVAL_MAP_H_
+#define SRC_HEADERS_S21_INTERVAL_MAP_H_
+
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <stdexcept>         // for out_of_range, invalid_argument
+#include <type_traits>       // for invoke_result_t, is_void_v
+#include <utility>           // for pair
+
+#include "./s21_vector.h"
+#include "./tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief Ordering, summary and queries shared by the interval containers.
+ *
+ * @details
+ * Intervals are half-open [start, end) pairs with start before end. They are
+ * ordered by start and then by end, and every node of the tree also keeps the
+ * greatest end in its subtree. A query skips every subtree whose greatest end
+ * is not after the query, and stops at the first interval starting at or
+ * after the query end, so it only walks the paths to the reported intervals.
+ * Reporting k intervals costs O(log n + k log n), and never more than O(n):
+ * the intervals between two reported ones that end too early are skipped
+ * subtree by subtree, which may take a descent of O(log n) per reported
+ * interval. It is not the O(log n + k) of an output-sensitive interval tree.
+ *
+ * @tparam K The type of interval endpoints.
+ * @tparam C The boolean comparator ordering the endpoints. It is default
+ * constructed wherever it is needed.
+ */
+template <typename K, typename C = std::less<K>>
+struct interval_traits {
+  using interval_type = std::pair<K, K>;  ///< Interval [start, end)
+
+  struct less;
+  struct max_end;
+
+  template <typename Tree, typename F>
+  static bool overlapping(const Tree &tree, const K &lo, const K &hi,
+                          F &fn);
+  template <typename Tree, typename F>
+  static bool stabbing(const Tree &tree, const K &point, F &fn);
+  template <typename F, typename T>
+  static bool visit(F &fn, T &item);
+};
+
+/**
+ * @brief Orders intervals by start and then by end.
+ */
+template <typename K, typename C>
+struct interval_traits<K, C>::less {
+  /**
+   * @brief Compares two intervals.
+   *
+   * @param[in] a The first interval.
+   * @param[in] b The second interval.
+   * @return bool - true if a is ordered before b, false otherwise.
+   */
+  bool operator()(const interval_type &a, const interval_type &b) const {
+    C comp{};
+
+    return comp(a.first, b.first) ||
+           (!comp(b.first, a.first) && comp(a.second, b.second));
+  }
+};
+
+/**
+ * @brief Summary policy keeping the greatest interval end of a subtree.
+ */
+template <typename K, typename C>
+struct interval_traits<K, C>::max_end {
+  using type = K;  ///< Summary type
+
+  /// @brief Returns the summary of a single element: the end of its interval.
+  template <typename P>
+  K operator()(const P &pair) const {
+    return pair.first.second;
+  }
+
+  /// @brief Combines two summaries: the greater end.
+  K operator()(const K &a, const K &b) const { return (C{}(a, b)) ? b : a; }
+};
+
+/**
+ * @brief A map from intervals to values answering overlap queries.
+ *
+ * @details
+ * The map is a red-black tree (see tree) keyed by half-open intervals and
+ * augmented with the greatest end of every subtree (see interval_traits), so
+ * the intervals overlapping a range or containing a point are found without
+ * scanning the map, in O(log n + k log n) for k reported intervals. Equal
+ * intervals are one key; intervals that merely overlap are distinct keys.
+ *
+ * @tparam K The type of interval endpoints.
+ * @tparam V The type of values stored in the map.
+ * @tparam C The boolean comparator ordering the endpoints. It must be default
+ * constructible.
+ */
+template <typename K, typename V, typename C = std::less<K>>
+class interval_map {
+  using traits = interval_traits<K, C>;  ///< Ordering and queries
+  using tree_type = tree<const typename traits::interval_type, V,
+                         typename traits::less, false,
+                         typename traits::max_end>;  ///< Tree type
+
+ public:
+  // Type aliases
+
+  typedef typename tree_type::const_iterator IntervalMapConstIterator;
+  typedef typename tree_type::iterator IntervalMapIterator;
+  using point_type = K;                             ///< Type of endpoints
+  using key_type = typename traits::interval_type;  ///< Type of intervals
+  using mapped_type = V;                            ///< Type of values
+  using value_type = std::pair<const key_type, V>;  ///< Pair interval-value
+  using reference = value_type &;                   ///< Reference to pair
+  using const_reference = const value_type &;       ///< Const reference
+  using size_type = std::size_t;                    ///< Size type
+  using iterator = IntervalMapIterator;             ///< For read/write
+  using const_iterator = IntervalMapConstIterator;  ///< For read elements
+  using iterator_bool = std::pair<iterator, bool>;  ///< Pair iterator-bool
+  using entry_type = std::pair<key_type, V>;        ///< Copy of an element
+
+  // Constructors
+
+  interval_map() noexcept = default;
+  interval_map(std::initializer_list<value_type> const &items);
+
+  // Interval map Element access
+
+  mapped_type &at(const key_type &interval) const;
+
+  // Interval map Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Interval map Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Interval map Modifiers
+
+  void clear() noexcept;
+  iterator_bool insert(const_reference value);
+  iterator_bool insert(const point_type &start, const point_type &end,
+                       const mapped_type &obj);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &interval);
+
+  // Interval map Lookup
+
+  iterator find(const key_type &interval) const;
+  bool contains(const key_type &interval) const;
+
+  // Interval map Interval queries
+
+  vector<entry_type> overlapping(const point_type &lo,
+                                 const point_type &hi) const;
+  vector<entry_type> stabbing(const point_type &point) const;
+  template <typename F>
+  bool for_each_overlapping(const point_type &lo, const point_type &hi,
+                            F &&fn) const;
+  template <typename F>
+  bool for_each_stabbing(const point_type &point, F &&fn) const;
+
+ private:
+  // Fields
+
+  tree_type tree_{};  ///< Tree of elements
+};
+
+#include "./../templates/interval_map.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_INTERVAL_MAP_H_
@@ -0,0 +1,144 @@
+/**
+ * @file s21_interval_set.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the interval set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_INTERVAL_SET_H_
+#define SRC_HEADERS_S21_INTERVAL_SET_H_
+
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <stdexcept>         // for invalid_argument
+#include <utility>           // for pair
+#include <variant>           // for monostate
+
+#include "./s21_interval_map.h"
+#include "./s21_vector.h"
+#include "./tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A set of intervals answering overlap queries.
+ *
+ * @details
+ * The interval_map counterpart without values: a red-black tree of half-open
+ * intervals augmented with the greatest end of every subtree (see
+ * interval_traits). A query reporting k intervals costs O(log n + k log n).
+ *
+ * @tparam K The type of interval endpoints.
+ * @tparam C The boolean comparator ordering the endpoints. It must be default
+ * constructible.
+ */
+template <typename K, typename C = std::less<K>>
+class interval_set {
+  using traits = interval_traits<K, C>;  ///< Ordering and queries
+  using tree_type = tree<const typename traits::interval_type, std::monostate,
+                         typename traits::less, false,
+                         typename traits::max_end>;  ///< Tree type
+
+ public:
+  // Container types
+
+  class IntervalSetIterator;
+
+  // Type aliases
+
+  using point_type = K;                             ///< Type of endpoints
+  using key_type = typename traits::interval_type;  ///< Type of intervals
+  using value_type = key_type;                      ///< Type of values
+  using const_reference = const value_type &;       ///< Const reference
+  using size_type = std::size_t;                    ///< Size type
+  using iterator = IntervalSetIterator;             ///< Elements are read-only
+  using const_iterator = IntervalSetIterator;       ///< For read elements
+  using iterator_bool = std::pair<iterator, bool>;  ///< Pair iterator-bool
+
+  // Constructors
+
+  interval_set() noexcept = default;
+  interval_set(std::initializer_list<value_type> const &items);
+
+  // Interval set Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // Interval set Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Interval set Modifiers
+
+  void clear() noexcept;
+  iterator_bool insert(const_reference interval);
+  iterator_bool insert(const point_type &start, const point_type &end);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &interval);
+
+  // Interval set Lookup
+
+  iterator find(const key_type &interval) const;
+  bool contains(const key_type &interval) const;
+
+  // Interval set Interval queries
+
+  vector<value_type> overlapping(const point_type &lo,
+                                 const point_type &hi) const;
+  vector<value_type> stabbing(const point_type &point) const;
+  template <typename F>
+  bool for_each_overlapping(const point_type &lo, const point_type &hi,
+                            F &&fn) const;
+  template <typename F>
+  bool for_each_stabbing(const point_type &point, F &&fn) const;
+
+ private:
+  // Fields
+
+  tree_type tree_{};  ///< Tree of elements
+};
+
+/**
+ * @brief An iterator for the interval set.
+ *
+ * @details
+ * Allows traversal of the interval set and read-only access to its
+ * intervals.
+ *
+ * @tparam K The type of interval endpoints.
+ */
+template <typename K, typename C>
+class interval_set<K, C>::IntervalSetIterator
+    : public tree_type::TreeConstIterator {
+ public:
+  // Type aliases
+
+  using _tree_cit = typename tree_type::TreeConstIterator;
+
+  // Constructors
+
+  IntervalSetIterator() noexcept = default;
+  IntervalSetIterator(const _tree_cit &other) noexcept : _tree_cit(other) {}
+
+  // Operators
+
+  iterator &operator++() noexcept;
+  iterator &operator--() noexcept;
+  iterator operator++(int) noexcept;
+  iterator operator--(int) noexcept;
+  const_reference operator*() const noexcept;
+};
+
+#include "./../templates/interval_set.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_INTERVAL_SET_H_
@@ -51,14 +51,14 @@ class list {
 
   // Constructors/assignment operators/destructor
 
-  list();
+  list() noexcept;
   explicit list(size_type n);
   list(std::initializer_list<T> const &items);
   list(const list &l);
-  list(list &&l);
+  list(list &&l) noexcept;
   ~list();
   list &operator=(const list &l);
-  list &operator=(list &&l);
+  list &operator=(list &&l) noexcept;
 
   // List Element access
 
@@ -87,7 +87,7 @@ class list {
   void pop_back();
   void push_front(const_reference value);
   void pop_front();
-  void swap(list &other);
+  void swap(list &other) noexcept;
   void merge(list &other);
   void splice(const_iterator pos, list &other);
   void reverse();
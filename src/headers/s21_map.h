@@ -13,9 +13,11 @@
 #ifndef SRC_HEADERS_S21_MAP_H_
 #define SRC_HEADERS_S21_MAP_H_
 
+#include <functional>        // for less
 #include <initializer_list>  // for init_list type
 #include <limits>            // for max()
 #include <string>            // for string type
+#include <type_traits>       // for remove_const_t
 
 #include "./s21_vector.h"
 #include "./tree.h"
@@ -34,18 +36,22 @@ namespace s21 {
  *
  * @tparam K The type of keys stored in the map.
  * @tparam M The type of values stored in the map.
+ * @tparam C The comparator ordering the keys. If it declares is_transparent,
+ * lookups also accept any type comparable with K.
+ * @tparam L If true, the underlying tree is threaded, so an iterator step is
+ * O(1) (see tree).
  */
 
-template <typename K, typename M>
+template <typename K, typename M, typename C = std::less<K>, bool L = false>
 class map {
  public:
   // Type aliases
 
-  typedef typename tree<K, M>::const_iterator MapConstIterator;
-  typedef typename tree<K, M>::iterator MapIterator;
+  typedef typename tree<const K, M, C, L>::const_iterator MapConstIterator;
+  typedef typename tree<const K, M, C, L>::iterator MapIterator;
   using key_type = K;                               ///< Type of pairs key
   using mapped_type = M;                            ///< Type of keys value
-  using value_type = std::pair<K, M>;               ///< Pair key-value
+  using value_type = std::pair<const K, M>;         ///< Pair key-value
   using reference = value_type &;                   ///< Reference to pair
   using const_reference = const value_type &;       ///< Const reference to pair
   using size_type = std::size_t;                    ///< Containers size type
@@ -56,16 +62,19 @@ class map {
   // Constructors/assignment operators/destructor
 
   map() noexcept = default;
+  explicit map(const C &comp);
   map(std::initializer_list<value_type> const &items);
   map(const map &m);
-  map(map &&m);
-  map &operator=(map &&m);
+  map(map &&m) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  map &operator=(map &&m) noexcept(
+      std::is_nothrow_copy_constructible_v<C>);
   map &operator=(const map &m);
 
   // Map Element access
 
   mapped_type &at(const key_type &key) const;
   mapped_type &operator[](const key_type &key) noexcept;
+  mapped_type &operator[](std::remove_const_t<key_type> &&key) noexcept;
   const mapped_type &operator[](const key_type &key) const noexcept;
 
   // Map Iterators
@@ -85,28 +94,72 @@ class map {
 
   void clear();
   iterator_bool insert(const_reference value);
+  iterator_bool insert(value_type &&value);
   iterator_bool insert(const key_type &key, const mapped_type &obj);
   iterator_bool insert_or_assign(const key_type &key, const mapped_type &obj);
   iterator erase(const_iterator pos);
   iterator erase(const_iterator first, const_iterator last);
   size_type erase(const key_type &key);
-  void swap(map &other);
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<const Key &, const_iterator>>>
+  size_type erase(const Key &key);
+  void swap(map &other) noexcept(std::is_nothrow_copy_constructible_v<C>);
   void merge(map &other);
 
   template <typename... Args>
   std::pair<iterator, bool> emplace(Args &&...args);
   template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(std::remove_const_t<key_type> &&key,
+                                        Args &&...args);
+  template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+  template <typename InputIt>
+  vector<std::pair<iterator, bool>> insert_range(InputIt first, InputIt last);
 
   // Map Lookup
 
+  iterator find(const key_type &key) const noexcept;
+  size_type count(const key_type &key) const noexcept;
   bool contains(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  C key_comp() const;
+
+  // Map Visitation
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+  // Map Transparent lookup (only with a comparator declaring is_transparent)
+
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator find(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  size_type count(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  bool contains(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator lower_bound(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator upper_bound(const Key &key) const noexcept;
   std::string structure() const noexcept;
 
  private:
   // Fields
 
-  tree<key_type, mapped_type> tree_{};  ///< Tree of elements
+  tree<const key_type, mapped_type, C, L> tree_{};  ///< Tree of elements
 };
 
 #include "./../templates/map.tpp"
@@ -0,0 +1,152 @@
+/**
+ * @file s21_multimap.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the multimap container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_MULTIMAP_H_
+#define SRC_HEADERS_S21_MULTIMAP_H_
+
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <type_traits>       // for remove_const_t
+#include <utility>           // for pair
+
+#include "./s21_vector.h"
+#include "./tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A multimap container template class.
+ *
+ * @details
+ * This template class multimap provides a multimap similar to std::multimap
+ * in the C++ Standard Library. It manages a balanced binary search tree (see
+ * tree) in which several elements may share a key. Elements with equal keys
+ * keep their insertion order.
+ *
+ * Every node also counts the elements of its subtree, so count() takes
+ * O(log n) like equal_range(), lower_bound() and upper_bound(), whatever the
+ * number of equal keys.
+ *
+ * @tparam K The type of keys stored in the multimap.
+ * @tparam M The type of values stored in the multimap.
+ * @tparam C The comparator ordering the keys.
+ * @tparam L If true, the underlying tree is threaded, so an iterator step is
+ * O(1) (see tree).
+ */
+template <typename K, typename M, typename C = std::less<K>, bool L = false>
+class multimap {
+  struct Counter;
+
+  using tree_type = tree<const K, M, C, L, Counter>;  ///< Tree type
+
+ public:
+  // Type aliases
+
+  typedef typename tree_type::const_iterator MultimapConstIterator;
+  typedef typename tree_type::iterator MultimapIterator;
+  using key_type = K;                               ///< Type of pairs key
+  using mapped_type = M;                            ///< Type of keys value
+  using value_type = std::pair<const K, M>;         ///< Pair key-value
+  using reference = value_type &;                   ///< Reference to pair
+  using const_reference = const value_type &;       ///< Const reference to pair
+  using size_type = std::size_t;                    ///< Containers size type
+  using iterator = MultimapIterator;                ///< For read/write elements
+  using const_iterator = MultimapConstIterator;     ///< For read elements
+  using iterator_range = std::pair<iterator, iterator>;  ///< Pair of iterators
+
+  // Constructors/assignment operators/destructor
+
+  multimap() noexcept = default;
+  explicit multimap(const C &comp);
+  multimap(std::initializer_list<value_type> const &items);
+  multimap(const multimap &mm);
+  multimap(multimap &&mm) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  multimap &operator=(multimap &&mm) noexcept(
+      std::is_nothrow_copy_constructible_v<C>);
+  multimap &operator=(const multimap &mm);
+
+  // Multimap Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Multimap Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+
+  // Multimap Modifiers
+
+  void clear();
+  iterator insert(const_reference value);
+  iterator insert(value_type &&value);
+  iterator insert(const key_type &key, const mapped_type &obj);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);
+  void swap(multimap &other) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  void merge(multimap &other);
+
+  template <typename... Args>
+  iterator emplace(Args &&...args);
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Multimap Lookup
+
+  size_type count(const key_type &key) const noexcept;
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+  iterator_range equal_range(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  C key_comp() const;
+
+  // Multimap Visitation
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+ private:
+  // Fields
+
+  tree_type tree_{tree_type::kNON_UNIQUE};  ///< Tree of elements
+};
+
+/**
+ * @brief Summary policy of the underlying tree.
+ *
+ * @details
+ * The summary of a subtree is the number of its elements.
+ */
+template <typename K, typename M, typename C, bool L>
+struct multimap<K, M, C, L>::Counter {
+  using type = size_type;  ///< Summary type
+
+  /// @brief Returns the summary of a single element.
+  size_type operator()(const value_type &) const { return 1; }
+
+  /// @brief Combines the summaries of two adjacent key ranges.
+  size_type operator()(size_type a, size_type b) const { return a + b; }
+};
+
+#include "./../templates/multimap.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_MULTIMAP_H_
@@ -13,9 +13,13 @@
 #ifndef SRC_HEADERS_S21_MULTISET_H_
 #define SRC_HEADERS_S21_MULTISET_H_
 
+#include <functional>        // for less
 #include <initializer_list>  // for init_list type
 #include <limits>            // for max()
 #include <string>            // for string type
+#include <type_traits>       // for remove_const_t, invoke_result_t
+#include <utility>           // for pair, exchange()
+#include <variant>           // for monostate
 
 #include "./s21_set.h"
 #include "./s21_vector.h"
@@ -33,14 +37,21 @@ namespace s21 {
  * element access, and size management.
  *
  * @tparam K The type of keys stored in the multiset.
+ * @tparam C The comparator ordering the keys. If it declares is_transparent,
+ * lookups also accept any type comparable with K.
+ * @tparam L If true, the underlying tree is threaded, so an iterator step is
+ * O(1) (see tree).
+ * @tparam R If true, the multiset stores runs: equal elements share one node
+ * holding their number of occurrences (see multiset<K, C, L, true>).
  */
-template <typename K>
+template <typename K, typename C = std::less<K>, bool L = false,
+          bool R = false>
 class multiset {
  private:
   // Container types
 
-  typedef typename set<K>::const_iterator MultisetConstIterator;
-  typedef typename set<K>::iterator MultisetIterator;
+  typedef typename set<K, C, L>::const_iterator MultisetConstIterator;
+  typedef typename set<K, C, L>::iterator MultisetIterator;
 
  public:
   // Type aliases
@@ -55,17 +66,20 @@ class multiset {
   using iterator_range = std::pair<iterator, iterator>;  ///< Pair iterator-bool
 
  private:
-  tree<const key_type, const key_type> tree_{
-      tree<const key_type, const key_type>::kNON_UNIQUE};  ///< Tree of elements
+  using tree_type = tree<const key_type, std::monostate, C, L>;  ///< Tree type
+
+  tree_type tree_{tree_type::kNON_UNIQUE};  ///< Tree of elements
 
  public:
   // Constructors/assignment operators/destructor
 
   multiset() noexcept = default;
+  explicit multiset(const C &comp);
   multiset(std::initializer_list<value_type> const &items);
   multiset(const multiset &ms);
-  multiset(multiset &&ms);
-  multiset &operator=(multiset &&ms);
+  multiset(multiset &&ms) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  multiset &operator=(multiset &&ms) noexcept(
+      std::is_nothrow_copy_constructible_v<C>);
   multiset &operator=(const multiset &ms);
 
   // Multiset Iterators
@@ -85,14 +99,17 @@ class multiset {
 
   void clear();
   iterator insert(const_reference value);
+  iterator insert(std::remove_const_t<K> &&value);
   iterator erase(const_iterator pos);
-  void swap(multiset &other);
+  void swap(multiset &other) noexcept(std::is_nothrow_copy_constructible_v<C>);
   void merge(multiset &other);
 
   template <typename... Args>
   iterator emplace(Args &&...args);
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+  template <typename InputIt>
+  vector<std::pair<iterator, bool>> insert_range(InputIt first, InputIt last);
 
   // Multiset Lookup
 
@@ -102,10 +119,199 @@ class multiset {
   iterator_range equal_range(const key_type &key) const noexcept;
   iterator lower_bound(const key_type &key);
   iterator upper_bound(const key_type &key);
+  C key_comp() const;
+  std::string structure() const noexcept;
+
+  // Multiset Visitation
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+  // Multiset Transparent lookup (only with a comparator declaring
+  // is_transparent)
+
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  size_type count(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator find(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  bool contains(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator_range equal_range(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator lower_bound(const Key &key);
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator upper_bound(const Key &key);
+};
+
+/**
+ * @brief A multiset storing runs of equal elements.
+ *
+ * @details
+ * The counted mode of multiset. Every distinct key has a single node holding
+ * the number of its occurrences, so memory and the cost of every operation
+ * depend on the number of distinct keys only: count() is one search instead
+ * of a walk over the duplicates. The interface and the observable behaviour
+ * are those of multiset: iterators visit every occurrence, and insert() and
+ * erase() add or remove one occurrence at a time.
+ *
+ * Occurrences of a key are indistinguishable, so an iterator is a node and
+ * the position of the occurrence in its run.
+ *
+ * @tparam K The type of keys stored in the multiset.
+ * @tparam C The comparator ordering the keys.
+ * @tparam L If true, the underlying tree is threaded, so an iterator step is
+ * O(1) (see tree).
+ */
+template <typename K, typename C, bool L>
+class multiset<K, C, L, true> {
+ public:
+  // Container types
+
+  class CountedIterator;
+
+  // Type aliases
+
+  using key_type = const K;                      ///< Type of keys
+  using value_type = const K;                    ///< Type of values
+  using reference = value_type &;                ///< Reference to value
+  using const_reference = const value_type &;    ///< Const reference to value
+  using size_type = std::size_t;                 ///< Containers size type
+  using iterator = CountedIterator;              ///< Elements are read-only
+  using const_iterator = CountedIterator;        ///< For read elements
+  using iterator_range = std::pair<iterator, iterator>;  ///< Pair of iterators
+
+ private:
+  using tree_type = tree<const key_type, size_type, C, L>;  ///< Tree type
+
+  tree_type tree_{};  ///< Tree of keys and their numbers of occurrences
+  size_type size_{};  ///< Number of occurrences of all keys
+
+ public:
+  // Constructors/assignment operators/destructor
+
+  multiset() noexcept = default;
+  explicit multiset(const C &comp);
+  multiset(std::initializer_list<value_type> const &items);
+  multiset(const multiset &ms);
+  multiset(multiset &&ms) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  multiset &operator=(multiset &&ms) noexcept(
+      std::is_nothrow_copy_constructible_v<C>);
+  multiset &operator=(const multiset &ms);
+
+  // Multiset Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Multiset Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  size_type distinct() const noexcept;
+
+  // Multiset Modifiers
+
+  void clear();
+  iterator insert(const_reference value);
+  iterator insert(const_reference value, size_type occurrences);
+  iterator erase(const_iterator pos);
+  size_type erase(const key_type &key);
+  void swap(multiset &other) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  void merge(multiset &other);
+
+  template <typename... Args>
+  iterator emplace(Args &&...args);
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+  template <typename InputIt>
+  vector<std::pair<iterator, bool>> insert_range(InputIt first, InputIt last);
+
+  // Multiset Lookup
+
+  size_type count(const key_type &key) const noexcept;
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+  iterator_range equal_range(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  C key_comp() const;
   std::string structure() const noexcept;
+
+  // Multiset Visitation
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+  template <typename F>
+  bool for_each_run(F &&fn) const;
+
+ private:
+  // Visitation
+
+  template <typename F>
+  static bool visitRun(F &fn, const typename tree_type::value_type &run);
+};
+
+/**
+ * @brief An iterator for the counted multiset.
+ *
+ * @details
+ * Visits every occurrence of every key: it stays on a node until it has
+ * passed all the occurrences the node holds.
+ *
+ * @tparam K The type of keys stored in the multiset.
+ */
+template <typename K, typename C, bool L>
+class multiset<K, C, L, true>::CountedIterator {
+ public:
+  // Type aliases
+
+  using _tree_cit = typename tree_type::const_iterator;
+
+  // Constructors
+
+  CountedIterator() noexcept = default;
+  CountedIterator(const _tree_cit &node, size_type index = 0) noexcept
+      : node_{node}, index_{index} {}
+
+  // Operators
+
+  iterator &operator++() noexcept;
+  iterator &operator--() noexcept;
+  iterator operator++(int) noexcept;
+  iterator operator--(int) noexcept;
+  bool operator==(const iterator &other) const noexcept;
+  bool operator!=(const iterator &other) const noexcept;
+  const_reference operator*() const noexcept;
+
+ private:
+  // Fields
+
+  _tree_cit node_{};   ///< Node of the current key
+  size_type index_{};  ///< Position of the occurrence in the run of the key
+
+  // Friends
+
+  friend class multiset;  ///< Reads and updates the run of an iterator
 };
 
 #include "./../templates/multiset.tpp"
+#include "./../templates/counted_multiset.tpp"
 
 }  // namespace s21
 
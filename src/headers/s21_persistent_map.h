@@ -0,0 +1,107 @@
+/**
+ * @file s21_persistent_map.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the persistent map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_PERSISTENT_MAP_H_
+#define SRC_HEADERS_S21_PERSISTENT_MAP_H_
+
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <stdexcept>         // for out_of_range
+#include <utility>           // for pair
+
+#include "./persistent_tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief An immutable ordered map whose updates return new versions.
+ *
+ * @details
+ * Every persistent_map is a version: it never changes after construction.
+ * insert(), insert_or_assign() and erase() return a new version built in
+ * O(log n) new nodes that shares the rest of its nodes with this one (see
+ * persistent_tree), so copying a map to keep a snapshot is O(1) and old
+ * versions stay readable, from any thread and without locks, while new ones
+ * are built.
+ *
+ * @tparam K The type of keys stored in the map.
+ * @tparam V The type of values stored in the map.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename V, typename C = std::less<K>>
+class persistent_map {
+  using tree_type = persistent_tree<const K, V, C>;  ///< Tree type
+
+ public:
+  // Type aliases
+
+  typedef typename tree_type::iterator PersistentMapIterator;
+  using key_type = K;                            ///< Type of pairs key
+  using mapped_type = V;                         ///< Type of keys value
+  using value_type = std::pair<const K, V>;      ///< Pair key-value
+  using const_reference = const value_type &;    ///< Const reference
+  using size_type = std::size_t;                 ///< Size type
+  using const_iterator = PersistentMapIterator;  ///< For read elements
+  using iterator = const_iterator;               ///< Elements are read-only
+
+  // Constructors
+
+  persistent_map() noexcept = default;
+  explicit persistent_map(const C &comp);
+  persistent_map(std::initializer_list<value_type> const &items);
+
+  // Persistent map Element access
+
+  const mapped_type &at(const key_type &key) const;
+
+  // Persistent map Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // Persistent map Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Persistent map Versions
+
+  [[nodiscard]] persistent_map insert(const_reference value) const;
+  [[nodiscard]] persistent_map insert(const key_type &key,
+                                      const mapped_type &obj) const;
+  [[nodiscard]] persistent_map insert_or_assign(const key_type &key,
+                                                const mapped_type &obj) const;
+  [[nodiscard]] persistent_map erase(const key_type &key) const;
+  bool shares_root(const persistent_map &other) const noexcept;
+
+  // Persistent map Lookup
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  template <typename F>
+  bool for_each(F &&fn) const;
+
+ private:
+  // Fields
+
+  tree_type tree_{};  ///< Version of the tree
+
+  explicit persistent_map(tree_type tree) noexcept;
+};
+
+#include "./../templates/persistent_map.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_PERSISTENT_MAP_H_
@@ -0,0 +1,124 @@
+/**
+ * @file s21_persistent_set.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the persistent set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_PERSISTENT_SET_H_
+#define SRC_HEADERS_S21_PERSISTENT_SET_H_
+
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <variant>           // for monostate
+
+#include "./persistent_tree.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief An immutable ordered set whose updates return new versions.
+ *
+ * @details
+ * The persistent_map counterpart without values: insert() and erase() return
+ * a new version in O(log n) new nodes sharing the rest with this one, and a
+ * copy is an O(1) snapshot (see persistent_tree).
+ *
+ * @tparam K The type of keys stored in the set.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename C = std::less<K>>
+class persistent_set {
+  using tree_type = persistent_tree<const K, std::monostate, C>;  ///< Tree
+
+ public:
+  // Container types
+
+  class PersistentSetIterator;
+
+  // Type aliases
+
+  using key_type = K;                            ///< Type of keys
+  using value_type = K;                          ///< Type of values
+  using const_reference = const value_type &;    ///< Const reference
+  using size_type = std::size_t;                 ///< Size type
+  using const_iterator = PersistentSetIterator;  ///< For read elements
+  using iterator = const_iterator;               ///< Elements are read-only
+
+  // Constructors
+
+  persistent_set() noexcept = default;
+  explicit persistent_set(const C &comp);
+  persistent_set(std::initializer_list<value_type> const &items);
+
+  // Persistent set Iterators
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // Persistent set Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Persistent set Versions
+
+  [[nodiscard]] persistent_set insert(const_reference value) const;
+  [[nodiscard]] persistent_set erase(const key_type &key) const;
+  bool shares_root(const persistent_set &other) const noexcept;
+
+  // Persistent set Lookup
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  template <typename F>
+  bool for_each(F &&fn) const;
+
+ private:
+  // Fields
+
+  tree_type tree_{};  ///< Version of the tree
+
+  explicit persistent_set(tree_type tree) noexcept;
+};
+
+/**
+ * @brief An iterator for the persistent set.
+ *
+ * @details
+ * Allows traversal of a version of the set and read-only access to its keys.
+ *
+ * @tparam K The type of keys stored in the set.
+ */
+template <typename K, typename C>
+class persistent_set<K, C>::PersistentSetIterator
+    : public tree_type::iterator {
+ public:
+  // Type aliases
+
+  using _tree_it = typename tree_type::iterator;
+
+  // Constructors
+
+  PersistentSetIterator() noexcept = default;
+  PersistentSetIterator(const _tree_it &other) noexcept : _tree_it(other) {}
+
+  // Operators
+
+  iterator &operator++() noexcept;
+  iterator operator++(int) noexcept;
+  const_reference operator*() const noexcept;
+};
+
+#include "./../templates/persistent_set.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_PERSISTENT_SET_H_
@@ -42,13 +42,13 @@ class queue {
 
   // Constructors/assignment operators/destructor
 
-  queue();
+  queue() noexcept;
   queue(std::initializer_list<T> const &items);
   queue(const queue &q);
-  queue(queue &&q);
+  queue(queue &&q) noexcept;
   ~queue();
   queue &operator=(const queue &q);
-  queue &operator=(queue &&q);
+  queue &operator=(queue &&q) noexcept;
 
   // Queue Element access
 
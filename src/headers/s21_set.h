@@ -13,10 +13,13 @@
 #ifndef SRC_HEADERS_S21_SET_H_
 #define SRC_HEADERS_S21_SET_H_
 
+#include <functional>        // for less
 #include <initializer_list>  // for init_list type
 #include <limits>            // for max()
 #include <string>            // for string type
+#include <type_traits>       // for remove_const_t
 #include <utility>           // for pair
+#include <variant>           // for monostate
 
 #include "./s21_vector.h"
 #include "./tree.h"
@@ -34,8 +37,12 @@ namespace s21 {
  * and size management.
  *
  * @tparam K The type of keys stored in the set.
+ * @tparam C The comparator ordering the keys. If it declares is_transparent,
+ * lookups also accept any type comparable with K.
+ * @tparam L If true, the underlying tree is threaded, so an iterator step is
+ * O(1) (see tree).
  */
-template <typename K>
+template <typename K, typename C = std::less<K>, bool L = false>
 class set {
  public:
   // Container types
@@ -57,10 +64,12 @@ class set {
   // Constructors/assignment operators/destructor
 
   set() noexcept = default;
+  explicit set(const C &comp);
   set(std::initializer_list<value_type> const &items);
   set(const set &s);
-  set(set &&s);
-  set &operator=(set &&s);
+  set(set &&s) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  set &operator=(set &&s) noexcept(
+      std::is_nothrow_copy_constructible_v<C>);
   set &operator=(const set &s);
 
   // Set Iterators
@@ -80,25 +89,64 @@ class set {
 
   void clear();
   iterator_bool insert(const_reference value);
+  iterator_bool insert(std::remove_const_t<K> &&value);
   iterator erase(const_iterator pos);
   iterator erase(const_iterator first, const_iterator last);
-  void swap(set &other);
+  size_type erase(const key_type &key);
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<const Key &, const_iterator>>>
+  size_type erase(const Key &key);
+  void swap(set &other) noexcept(std::is_nothrow_copy_constructible_v<C>);
   void merge(set &other);
 
   template <typename... Args>
   std::pair<iterator, bool> emplace(Args &&...args);
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+  template <typename InputIt>
+  vector<std::pair<iterator, bool>> insert_range(InputIt first, InputIt last);
 
   // Set Lookup
 
   iterator find(const key_type &key) const noexcept;
+  size_type count(const key_type &key) const noexcept;
   bool contains(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  C key_comp() const;
+
+  // Set Visitation
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+  // Set Transparent lookup (only with a comparator declaring is_transparent)
+
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator find(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  size_type count(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  bool contains(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator lower_bound(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator upper_bound(const Key &key) const noexcept;
 
  private:
   // Fields
 
-  tree<const key_type, const key_type> tree_{};  ///< Tree of elements
+  tree<const key_type, std::monostate, C, L> tree_{};  ///< Tree of elements
 };
 
 /**
@@ -110,12 +158,13 @@ class set {
  *
  * @tparam K The type of keys stored in the set.
  */
-template <typename K>
-class set<K>::SetIterator : public tree<const K, const K>::TreeIterator {
+template <typename K, typename C, bool L>
+class set<K, C, L>::SetIterator
+    : public tree<const K, std::monostate, C, L>::TreeIterator {
  public:
   // Type aliases
 
-  using _tree_it = typename tree<const K, const K>::TreeIterator;
+  using _tree_it = typename tree<const K, std::monostate, C, L>::TreeIterator;
 
   // Constructors
 
@@ -144,13 +193,14 @@ class set<K>::SetIterator : public tree<const K, const K>::TreeIterator {
  *
  * @tparam K The type of keys stored in the set.
  */
-template <typename K>
-class set<K>::SetConstIterator
-    : public tree<const K, const K>::TreeConstIterator {
+template <typename K, typename C, bool L>
+class set<K, C, L>::SetConstIterator
+    : public tree<const K, std::monostate, C, L>::TreeConstIterator {
  public:
   // Type aliases
 
-  using _tree_cit = typename tree<const K, const K>::TreeConstIterator;
+  using _tree_cit =
+      typename tree<const K, std::monostate, C, L>::TreeConstIterator;
 
   // Constructors
 
@@ -0,0 +1,207 @@
+/**
+ * @file s21_skiplist_map.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the lock-free skip list map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_SKIPLIST_MAP_H_
+#define SRC_HEADERS_S21_SKIPLIST_MAP_H_
+
+#include <atomic>            // for atomic
+#include <cstdint>           // for uintptr_t, uint64_t
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <new>               // for operator new, operator delete
+#include <optional>          // for optional
+#include <stdexcept>         // for out_of_range
+#include <thread>            // for this_thread::get_id()
+#include <type_traits>       // for invoke_result_t, is_void_v
+#include <utility>           // for pair
+
+#include "./epoch.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A lock-free ordered map on a skip list.
+ *
+ * @details
+ * Any number of threads may search, insert and erase at the same time
+ * without locks. Every operation is linearizable: an element is present from
+ * the moment it is linked into the bottom list, and absent from the moment
+ * its bottom link is marked deleted. Searches and updates take O(log n)
+ * expected steps.
+ *
+ * The towers of a node are linked and unlinked with compare-and-swap after
+ * the bottom level, following Herlihy and Shavit; marked nodes are unlinked
+ * by whichever thread meets them. An unlinked node is retired to the
+ * epoch_domain and deleted once no thread can still read it, so every
+ * operation, and every iterator, runs inside an epoch_guard.
+ *
+ * Values are never modified in place: an element is read while other
+ * threads update the map without copying it under a lock. Iterators are
+ * weakly consistent: they visit keys in ascending order, see every element
+ * present during the whole traversal and may or may not see the elements
+ * inserted or erased meanwhile. An iterator keeps the epoch of its thread
+ * pinned, so it must stay in the thread that made it and should be short
+ * lived.
+ *
+ * @tparam K The type of keys stored in the map.
+ * @tparam M The type of values stored in the map.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename M, typename C = std::less<K>>
+class skiplist_map {
+ public:
+  // Container types
+
+  class SkiplistIterator;
+
+  // Type aliases
+
+  using key_type = K;                               ///< Type of pairs key
+  using mapped_type = M;                            ///< Type of keys value
+  using value_type = std::pair<const K, M>;         ///< Pair key-value
+  using const_reference = const value_type &;       ///< Const reference
+  using size_type = std::size_t;                    ///< Size type
+  using const_iterator = SkiplistIterator;          ///< For read elements
+  using iterator = const_iterator;                  ///< Elements are read-only
+  using iterator_bool = std::pair<iterator, bool>;  ///< Pair iterator-bool
+
+  static constexpr size_type kMAX_LEVEL = 32;  ///< Greatest tower height
+
+  // Constructors/destructor
+
+  skiplist_map() noexcept = default;
+  explicit skiplist_map(const C &comp);
+  skiplist_map(std::initializer_list<value_type> const &items);
+  skiplist_map(const skiplist_map &) = delete;
+  skiplist_map &operator=(const skiplist_map &) = delete;
+  ~skiplist_map();
+
+  // Skiplist map Element access
+
+  mapped_type at(const key_type &key) const;
+
+  // Skiplist map Iterators
+
+  iterator begin() const;
+  iterator end() const noexcept;
+
+  // Skiplist map Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Skiplist map Modifiers
+
+  void clear();
+  iterator_bool insert(const_reference value);
+  iterator_bool insert(const key_type &key, const mapped_type &obj);
+  size_type erase(const key_type &key);
+
+  // Skiplist map Lookup
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  template <typename F>
+  bool for_each(F &&fn) const;
+
+ private:
+  // Container types
+
+  struct Node;
+  using Link = std::atomic<std::uintptr_t>;  ///< Marked pointer to a node
+
+  // Fields
+
+  mutable Link head_[kMAX_LEVEL]{};   ///< Links of the head tower
+  std::atomic<size_type> height_{1};  ///< Greatest tower height so far
+  std::atomic<size_type> size_{};     ///< Number of elements
+  C comp_{};                          ///< Orders the keys
+
+  // Search
+
+  bool findNode(const key_type &key, Link **preds, Node **succs,
+                bool through) const;
+  void linkTower(Node *node, Link **preds, Node **succs);
+  static Node *firstFrom(std::uintptr_t link) noexcept;
+
+  // Nodes
+
+  static Node *makeNode(const value_type &pair, size_type height);
+  static void deleteNode(void *node) noexcept;
+  static void releaseNode(Node *node) noexcept;
+  static size_type randomHeight() noexcept;
+  static Node *pointer(std::uintptr_t link) noexcept;
+  static bool isMarked(std::uintptr_t link) noexcept;
+  static std::uintptr_t pack(Node *node) noexcept;
+};
+
+/**
+ * @brief A node with its tower of links, allocated in one block.
+ *
+ * @details
+ * The links follow the node in memory. The low bit of a link marks the node
+ * owning the link as deleted at that level.
+ */
+template <typename K, typename M, typename C>
+struct skiplist_map<K, M, C>::Node {
+  value_type pair;             ///< Node key
+  size_type height;            ///< Number of links
+  std::atomic<int> owners{2};  ///< Inserter and eraser still using the node
+
+  /// @brief Returns the link of the node at the given level.
+  Link &link(size_type level) noexcept {
+    return reinterpret_cast<Link *>(this + 1)[level];
+  }
+};
+
+/**
+ * @brief A weakly consistent forward iterator over the skip list.
+ *
+ * @details
+ * Holds an epoch_guard while it points to an element, so the element stays
+ * readable even if it is erased meanwhile.
+ */
+template <typename K, typename M, typename C>
+class skiplist_map<K, M, C>::SkiplistIterator {
+ public:
+  // Constructors
+
+  SkiplistIterator() noexcept = default;
+
+  // Operators
+
+  const_reference operator*() const noexcept;
+  iterator &operator++() noexcept;
+  iterator operator++(int) noexcept;
+  bool operator==(const iterator &other) const noexcept;
+  bool operator!=(const iterator &other) const noexcept;
+
+ private:
+  // Fields
+
+  std::optional<epoch_guard> guard_{};  ///< Keeps the element readable
+  Node *node_{};                        ///< Current element
+
+  explicit SkiplistIterator(Node *node);
+
+  // Friends
+
+  friend class skiplist_map;
+};
+
+#include "./../templates/skiplist_map.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_SKIPLIST_MAP_H_
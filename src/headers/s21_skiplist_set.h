@@ -0,0 +1,125 @@
+/**
+ * @file s21_skiplist_set.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the lock-free skip list set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_SKIPLIST_SET_H_
+#define SRC_HEADERS_S21_SKIPLIST_SET_H_
+
+#include <functional>        // for less
+#include <initializer_list>  // for init_list type
+#include <utility>           // for pair
+#include <variant>           // for monostate
+
+#include "./s21_skiplist_map.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A lock-free ordered set on a skip list.
+ *
+ * @details
+ * The skiplist_map counterpart without values: threads insert, erase and
+ * search keys at the same time without locks, every operation is
+ * linearizable and iterators are weakly consistent (see skiplist_map).
+ *
+ * @tparam K The type of keys stored in the set.
+ * @tparam C The boolean comparator ordering the keys.
+ */
+template <typename K, typename C = std::less<K>>
+class skiplist_set {
+  using map_type = skiplist_map<K, std::monostate, C>;  ///< Underlying map
+
+ public:
+  // Container types
+
+  class SkiplistSetIterator;
+
+  // Type aliases
+
+  using key_type = K;                               ///< Type of keys
+  using value_type = K;                             ///< Type of values
+  using const_reference = const value_type &;       ///< Const reference
+  using size_type = std::size_t;                    ///< Size type
+  using const_iterator = SkiplistSetIterator;       ///< For read elements
+  using iterator = const_iterator;                  ///< Elements are read-only
+  using iterator_bool = std::pair<iterator, bool>;  ///< Pair iterator-bool
+
+  // Constructors
+
+  skiplist_set() noexcept = default;
+  explicit skiplist_set(const C &comp);
+  skiplist_set(std::initializer_list<value_type> const &items);
+
+  // Skiplist set Iterators
+
+  iterator begin() const;
+  iterator end() const noexcept;
+
+  // Skiplist set Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+
+  // Skiplist set Modifiers
+
+  void clear();
+  iterator_bool insert(const_reference value);
+  size_type erase(const key_type &key);
+
+  // Skiplist set Lookup
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator lower_bound(const key_type &key) const;
+  template <typename F>
+  bool for_each(F &&fn) const;
+
+ private:
+  // Fields
+
+  map_type map_{};  ///< Map of keys
+};
+
+/**
+ * @brief An iterator for the skip list set.
+ *
+ * @details
+ * Allows weakly consistent traversal of the set and read-only access to its
+ * keys.
+ *
+ * @tparam K The type of keys stored in the set.
+ */
+template <typename K, typename C>
+class skiplist_set<K, C>::SkiplistSetIterator
+    : public map_type::iterator {
+ public:
+  // Type aliases
+
+  using _map_it = typename map_type::iterator;
+
+  // Constructors
+
+  SkiplistSetIterator() noexcept = default;
+  SkiplistSetIterator(const _map_it &other) : _map_it(other) {}
+
+  // Operators
+
+  iterator &operator++() noexcept;
+  iterator operator++(int) noexcept;
+  const_reference operator*() const noexcept;
+};
+
+#include "./../templates/skiplist_set.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_SKIPLIST_SET_H_
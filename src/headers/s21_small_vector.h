@@ -0,0 +1,174 @@
+/**
+ * @file s21_small_vector.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the small vector container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_SMALL_VECTOR_H_
+#define SRC_HEADERS_S21_SMALL_VECTOR_H_
+
+#include <algorithm>         // for move, remove_if
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <initializer_list>  // for init_list type
+#include <iterator>          // for iterator_traits, distance
+#include <memory>            // for uninitialized_*, destroy
+#include <new>               // for operator new, align_val_t
+#include <stdexcept>         // for out_of_range, length_error
+#include <type_traits>       // for is_nothrow_move_constructible_v
+#include <utility>           // for forward, move
+
+#include "./s21_vector.h"
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief A vector keeping up to N elements inside the object.
+ *
+ * @details
+ * The first N elements live in a buffer inside the small vector, so a vector
+ * that never holds more than N elements never allocates. Beyond N the
+ * elements spill to the heap, and from then on the small vector behaves as a
+ * vector, doubling its capacity on growth; shrink_to_fit() brings the
+ * elements back inside when they fit.
+ *
+ * Moving a small vector whose elements are inside moves the elements one by
+ * one (or with a memcpy() for trivially relocatable types): iterators to
+ * them are invalidated by the move, and so is swap(). A spilled small vector
+ * is moved by handing its heap storage over.
+ *
+ * Iterators are pointers. Inserting before the end shifts the tail after the
+ * position once per insertion. The storage algorithms are those of vector
+ * (see raw_storage); only the storage differs.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The number of elements kept inside, at least 1.
+ */
+template <typename T, std::size_t N>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+
+ public:
+  // Type aliases
+
+  using value_type = T;                    ///< Type of values
+  using reference = T &;                   ///< Reference to value
+  using const_reference = const T &;       ///< Const reference to value
+  using iterator = T *;                    ///< For read/write elements
+  using const_iterator = const T *;        ///< For read elements
+  using size_type = std::size_t;           ///< Size type
+  using difference_type = std::ptrdiff_t;  ///< Distance between iterators
+
+  // Constructors/assignment operators/destructor
+
+  small_vector() noexcept;
+  explicit small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &other);
+  small_vector(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~small_vector();
+  small_vector &operator=(const small_vector &other);
+  small_vector &operator=(small_vector &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+
+  // Small vector Element access
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) noexcept;
+  const_reference operator[](size_type pos) const noexcept;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+  T *data() noexcept;
+  const T *data() const noexcept;
+
+  // Small vector Iterators
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  // Small vector Capacity
+
+  bool empty() const noexcept;
+  size_type size() const noexcept;
+  size_type max_size() const noexcept;
+  void reserve(size_type size);
+  size_type capacity() const noexcept;
+  void shrink_to_fit();
+  bool is_inline() const noexcept;
+
+  // Small vector Modifiers
+
+  void clear() noexcept;
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void assign(InputIt first, InputIt last);
+  iterator erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename Pred>
+  size_type erase_if(Pred pred);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename Range>
+  void append_range(Range &&range);
+  void pop_back();
+  void swap(small_vector &other);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  // Fields
+
+  T *data_;                                         ///< Inside buffer or heap
+  size_type size_{};                                ///< Number of elements
+  size_type capacity_{N};                           ///< Capacity of data_
+  alignas(T) unsigned char buffer_[N * sizeof(T)];  ///< Elements kept inside
+
+  using storage = raw_storage<T>;  ///< Algorithms shared with vector
+
+  // Storage
+
+  T *inlineData() noexcept;
+  static T *allocate(size_type count);
+  static void deallocate(T *array) noexcept;
+  void adopt(T *array, size_type capacity) noexcept;
+  void reallocate(size_type capacity);
+  void moveFrom(small_vector &other);
+
+  // Insertion
+
+  size_type grownCapacity(size_type count) const;
+  template <typename Fill>
+  iterator insertBatch(size_type index, size_type count, Fill fill);
+};
+
+#include "./../templates/small_vector.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_SMALL_VECTOR_H_
@@ -41,13 +41,13 @@ class stack {
 
   // Constructors/assignment operators/destructor
 
-  stack();
+  stack() noexcept;
   stack(std::initializer_list<T> const &items);
   stack(const stack &s);
-  stack(stack &&s);
+  stack(stack &&s) noexcept;
   ~stack();
   stack &operator=(const stack &s);
-  stack &operator=(stack &&s);
+  stack &operator=(stack &&s) noexcept;
 
   // Stack Element access
 
@@ -0,0 +1,247 @@
+/**
+ * @file s21_static_vector.h
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Header for the static vector container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#ifndef SRC_HEADERS_S21_STATIC_VECTOR_H_
+#define SRC_HEADERS_S21_STATIC_VECTOR_H_
+
+#include <algorithm>         // for min
+#include <cstddef>           // for size_t, ptrdiff_t
+#include <initializer_list>  // for init_list type
+#include <iterator>          // for iterator_traits, distance
+#include <memory>            // for uninitialized_*, destroy
+#include <new>               // for placement new
+#include <stdexcept>         // for out_of_range, length_error
+#include <type_traits>       // for is_trivial_v
+#include <utility>           // for forward, move
+
+/// @brief Namespace for working with containers
+namespace s21 {
+
+/**
+ * @brief Storage of static_vector: the elements and their number.
+ *
+ * @details
+ * For small trivial types the storage is an array of N value-initialized
+ * elements, of which the first size_ are in use: construction and destruction
+ * reduce to assignment and nothing, and every special member is trivial, so
+ * the static vector is a literal type usable in constant expressions. C++17
+ * needs every element initialized for that, which costs O(N) on every
+ * construction and copy, so it is only done up to 64 bytes of elements. Other
+ * types, and larger arrays, live in raw storage where only the first size_
+ * elements are constructed or copied.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The capacity.
+ * @tparam Literal Whether the storage is an initialized array.
+ */
+template <typename T, std::size_t N,
+          bool Literal = std::is_trivial_v<T> && N * sizeof(T) <= 64>
+class static_storage {
+ protected:
+  // Fields
+
+  std::size_t size_{};  ///< Number of elements
+  T elements_[N]{};     ///< All N elements, the first size_ in use
+
+  // Elements
+
+  constexpr T *data() noexcept;
+  constexpr const T *data() const noexcept;
+  template <typename... Args>
+  static constexpr void construct(T *dest, Args &&...args);
+  template <typename... Args>
+  static constexpr void constructEach(T *dest, Args &&...args);
+  static constexpr void constructN(T *dest, std::size_t count);
+  template <typename InputIt>
+  static constexpr void copy(InputIt first, InputIt last, T *dest);
+  static constexpr void destroy(T *first, T *last) noexcept;
+};
+
+/**
+ * @brief Storage of static_vector for non-trivial types and large arrays:
+ * raw storage.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The capacity.
+ */
+template <typename T, std::size_t N>
+class static_storage<T, N, false> {
+ protected:
+  // Constructors/assignment operators/destructor
+
+  static_storage() noexcept = default;
+  static_storage(const static_storage &other);
+  static_storage(static_storage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~static_storage();
+  static_storage &operator=(const static_storage &other);
+  static_storage &operator=(static_storage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>);
+
+  // Fields
+
+  std::size_t size_{};                              ///< Number of elements
+  alignas(T) unsigned char buffer_[N * sizeof(T)];  ///< Raw element storage
+
+  // Elements
+
+  T *data() noexcept;
+  const T *data() const noexcept;
+  template <typename... Args>
+  static void construct(T *dest, Args &&...args);
+  template <typename... Args>
+  static void constructEach(T *dest, Args &&...args);
+  static void constructN(T *dest, std::size_t count);
+  template <typename InputIt>
+  static void copy(InputIt first, InputIt last, T *dest);
+  static void destroy(T *first, T *last) noexcept;
+
+ private:
+  template <typename InputIt>
+  void assignFrom(InputIt first, std::size_t count);
+};
+
+/**
+ * @brief A vector of at most N elements kept inside the object.
+ *
+ * @details
+ * The static vector never allocates: its capacity is N, fixed at compile
+ * time. Growing past N throws std::length_error from every inserting
+ * function; try_push_back() and try_emplace_back() report a full static
+ * vector instead. If an insertion throws the static vector is unchanged.
+ *
+ * For trivial types of at most 64 bytes in total every function is constexpr
+ * and the static vector can be built in a constant expression. Copying and
+ * moving work element by element and leave iterators pointing into the
+ * original; a moved-from static vector keeps its moved-from elements, as
+ * std::array does.
+ *
+ * Iterators are pointers. Inserting before the end builds the new elements
+ * past the end and rotates them into place, which needs move-assignable
+ * elements; appending does not.
+ *
+ * @tparam T The type of the elements.
+ * @tparam N The capacity, at least 1.
+ */
+template <typename T, std::size_t N>
+class static_vector : private static_storage<T, N> {
+  static_assert(N > 0, "static_vector needs room for at least one element");
+
+  using storage = static_storage<T, N>;
+
+ public:
+  // Type aliases
+
+  using value_type = T;                    ///< Type of values
+  using reference = T &;                   ///< Reference to value
+  using const_reference = const T &;       ///< Const reference to value
+  using iterator = T *;                    ///< For read/write elements
+  using const_iterator = const T *;        ///< For read elements
+  using size_type = std::size_t;           ///< Size type
+  using difference_type = std::ptrdiff_t;  ///< Distance between iterators
+
+  // Constructors
+
+  constexpr static_vector() noexcept = default;
+  constexpr explicit static_vector(size_type n);
+  constexpr static_vector(std::initializer_list<value_type> const &items);
+
+  // Static vector Element access
+
+  constexpr reference at(size_type pos);
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference operator[](size_type pos) noexcept;
+  constexpr const_reference operator[](size_type pos) const noexcept;
+  constexpr reference front();
+  constexpr const_reference front() const;
+  constexpr reference back();
+  constexpr const_reference back() const;
+  using storage::data;
+
+  // Static vector Iterators
+
+  constexpr iterator begin() noexcept;
+  constexpr iterator end() noexcept;
+  constexpr const_iterator begin() const noexcept;
+  constexpr const_iterator end() const noexcept;
+  constexpr const_iterator cbegin() const noexcept;
+  constexpr const_iterator cend() const noexcept;
+
+  // Static vector Capacity
+
+  constexpr bool empty() const noexcept;
+  constexpr bool full() const noexcept;
+  constexpr size_type size() const noexcept;
+  constexpr size_type max_size() const noexcept;
+  constexpr void reserve(size_type size);
+  constexpr size_type capacity() const noexcept;
+  constexpr void shrink_to_fit() noexcept;
+
+  // Static vector Modifiers
+
+  constexpr void clear() noexcept;
+  constexpr iterator insert(const_iterator pos, const_reference value);
+  constexpr iterator insert(const_iterator pos, value_type &&value);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  constexpr void assign(InputIt first, InputIt last);
+  constexpr iterator erase(const_iterator pos);
+  constexpr iterator erase(const_iterator first, const_iterator last);
+  template <typename Pred>
+  constexpr size_type erase_if(Pred pred);
+  constexpr void push_back(const_reference value);
+  constexpr void push_back(value_type &&value);
+  constexpr bool try_push_back(const_reference value);
+  constexpr bool try_push_back(value_type &&value);
+  template <typename Range>
+  constexpr void append_range(Range &&range);
+  constexpr void pop_back() noexcept;
+  constexpr void swap(static_vector &other);
+
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args);
+  template <typename... Args>
+  constexpr T *try_emplace_back(Args &&...args);
+  template <typename... Args>
+  constexpr iterator insert_many(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  constexpr void insert_many_back(Args &&...args);
+
+ private:
+  using storage::construct;
+  using storage::constructEach;
+  using storage::constructN;
+  using storage::copy;
+  using storage::destroy;
+  using storage::size_;
+
+  // Insertion
+
+  constexpr void checkRoom(size_type count) const;
+  template <typename Fill>
+  constexpr T *appendBatch(size_type count, Fill fill);
+  template <typename Fill>
+  constexpr iterator insertBatch(size_type index, size_type count, Fill fill);
+  static constexpr void rotate(T *first, T *middle, T *last);
+};
+
+#include "./../templates/static_vector.tpp"
+
+}  // namespace s21
+
+#endif  // SRC_HEADERS_S21_STATIC_VECTOR_H_
@@ -13,9 +13,18 @@
 #define SRC_HEADERS_S21_VECTOR_H_
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "./growth_policy.h"
+#include "./raw_storage.h"
+
 /// @brief Namespace for working with containers
 namespace s21 {
 
@@ -32,10 +41,19 @@ namespace s21 {
  * size: the size of the stored array (size() method) and the size of the buffer
  * (capacity() method).
  *
+ * The buffer is raw storage: only the elements in [0, size()) are constructed,
+ * with placement-new, and only they are destroyed. Growing the buffer
+ * constructs nothing in its spare slots, and T need not be default
+ * constructible unless the size constructor is used.
+ *
+ * When an insertion does not fit, the growth policy G chooses the new
+ * capacity (see growth_factor): doubling by default.
+ *
  * @tparam The template argument T is a value type of stored in the vector.
+ * @tparam G The growth policy.
  */
-template <typename T>
-class vector {
+template <typename T, typename G = growth_doubling>
+class vector : private G {
  public:
   class VectorIterator;
   class VectorConstIterator;
@@ -54,13 +72,13 @@ class vector {
 
   // Vector Member functions
 
-  vector();
+  vector() noexcept;
   explicit vector(size_type n);
   vector(std::initializer_list<value_type> const &items);
   vector(const vector &v);
-  vector(vector &&v);
+  vector(vector &&v) noexcept;
   ~vector();
-  vector &operator=(vector &&v);
+  vector &operator=(vector &&v) noexcept;
 
   // Vector Element access
 
@@ -70,6 +88,7 @@ class vector {
   const_reference front() const;
   const_reference back() const;
   value_type *data() noexcept;
+  const value_type *data() const noexcept;
 
   // Vector Iterators
 
@@ -87,15 +106,37 @@ class vector {
   size_type capacity();
   void shrink_to_fit();
 
+  // Vector Growth
+
+  G &growth() noexcept;
+  const G &growth() const noexcept;
+
   // Vector Modifiers
 
   void clear() noexcept;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  iterator insert(iterator pos, InputIt first, InputIt last);
+  template <typename InputIt, typename = typename std::iterator_traits<
+                                  InputIt>::iterator_category>
+  void assign(InputIt first, InputIt last);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  template <typename Pred>
+  size_type erase_if(Pred pred);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <typename Range>
+  void append_range(Range &&range);
   void pop_back();
-  void swap(vector &other);
+  void swap(vector &other) noexcept;
 
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
   template <typename... Args>
@@ -107,6 +148,27 @@ class vector {
   T *_array;            ///< Pointer to allocated memory for elements
   size_type _size;      ///< Number of elements
   size_type _capacity;  ///< Currently allocated storage size
+
+  using storage = raw_storage<T>;  ///< Algorithms shared with small_vector
+
+  // Storage
+
+  T *allocate(size_type count);
+  void deallocate(T *array, size_type count) noexcept;
+  void adopt(T *array, size_type capacity) noexcept;
+  void release() noexcept;
+  void reallocate(size_type capacity);
+
+  // Insertion
+
+  size_type grownCapacity(size_type count) const;
+  template <typename Fill>
+  iterator insertBatch(size_type index, size_type count, Fill fill);
+  template <typename Fill>
+  bool insertRemapping(size_type index, size_type count, Fill &fill);
+  template <typename Fill>
+  void insertRelocating(size_type index, size_type count, size_type capacity,
+                        Fill &fill);
 };
 
 /**
@@ -121,12 +183,13 @@ class vector {
  *
  * @tparam T is a type of the iterator.
  */
-template <typename T>
-class vector<T>::VectorIterator {
+template <typename T, typename G>
+class vector<T, G>::VectorIterator {
  public:
-  using value_type = T;   ///< Type of values
-  using pointer = T *;    ///< Pointer to value
-  using reference = T &;  ///< Reference to value
+  using value_type = T;               ///< Type of values
+  using pointer = T *;                ///< Pointer to value
+  using reference = T &;              ///< Reference to value
+  using difference_type = ptrdiff_t;  ///< Distance between iterators
   using iterator_category =
       std::random_access_iterator_tag;  ///< Iterator categories. The
                                         ///< std::random_access_iterator_tag is
@@ -156,10 +219,10 @@ class vector<T>::VectorIterator {
 
   // Pointer Arithmetic
 
-  iterator &operator+=(value_type n) noexcept;
-  iterator operator+(value_type n) const noexcept;
-  iterator &operator-=(value_type n) noexcept;
-  iterator operator-(value_type n) const noexcept;
+  iterator &operator+=(difference_type n) noexcept;
+  iterator operator+(difference_type n) const noexcept;
+  iterator &operator-=(difference_type n) noexcept;
+  iterator operator-(difference_type n) const noexcept;
   ptrdiff_t operator-(const iterator &other) noexcept;
 
   // Comparison
@@ -190,14 +253,15 @@ class vector<T>::VectorIterator {
  *
  * @tparam T is a type of the iterator.
  */
-template <typename T>
-class vector<T>::VectorConstIterator {
+template <typename T, typename G>
+class vector<T, G>::VectorConstIterator {
  public:
   using value_type = T;               ///< Type of values
   using pointer = T *;                ///< Pointer to value
   using const_pointer = const T *;    ///< Const pointer to value
   using reference = T &;              ///< Reference to value
   using const_reference = const T &;  ///< Const reference to value
+  using difference_type = ptrdiff_t;  ///< Distance between iterators
   using iterator_category =
       std::random_access_iterator_tag;  ///< Iterator categories. The
                                         ///< std::random_access_iterator_tag is
@@ -227,10 +291,10 @@ class vector<T>::VectorConstIterator {
 
   // Pointer Arithmetic
 
-  const_iterator &operator+=(value_type n) noexcept;
-  const_iterator operator+(value_type n) const noexcept;
-  const_iterator &operator-=(value_type n) noexcept;
-  const_iterator operator-(value_type n) const noexcept;
+  const_iterator &operator+=(difference_type n) noexcept;
+  const_iterator operator+(difference_type n) const noexcept;
+  const_iterator &operator-=(difference_type n) noexcept;
+  const_iterator operator-(difference_type n) const noexcept;
   ptrdiff_t operator-(const const_iterator &other) noexcept;
 
   // Comparison
@@ -14,13 +14,94 @@
 #define SRC_HEADERS_S21_TREE_H_
 
 #include <algorithm>         // for exchange()
+#include <functional>        // for less
 #include <initializer_list>  // for init_list type
 #include <limits>            // for max()
+#include <optional>          // for optional
 #include <string>            // for string type
+#include <tuple>             // for forward_as_tuple()
+#include <type_traits>       // for enable_if_t, invoke_result_t, void_t
+#include <utility>           // for pair, in_place, piecewise_construct
+
+#include "./s21_vector.h"
 
 /// @brief Namespace for working with containers
 namespace s21 {
 
+/**
+ * @brief Detects a three-way comparator.
+ *
+ * @details
+ * A comparator opts in to the three-way mode by declaring the member type
+ * is_three_way. Its call operator then returns an int that is negative, zero
+ * or positive when the first argument is ordered before, equivalent to or
+ * after the second one, so the tree resolves each level with one call.
+ *
+ * @tparam C The comparator type.
+ */
+template <typename C, typename = void>
+struct is_three_way : std::false_type {};
+
+template <typename C>
+struct is_three_way<C, std::void_t<typename C::is_three_way>>
+    : std::true_type {};
+
+/**
+ * @brief Selects the branchless search for a key type and comparator.
+ *
+ * @details
+ * Enabled for scalar keys (integers, floating point, enums, pointers) ordered
+ * by a boolean comparator, where a comparison is cheap and the cost of a
+ * search is dominated by mispredicted branches. The search then does one
+ * comparison per level and never branches on its result (see
+ * tree::findNode()). Specialize it to opt a key type in or out.
+ *
+ * @tparam K The key type.
+ * @tparam C The comparator type.
+ */
+template <typename K, typename C>
+struct branchless_search
+    : std::bool_constant<std::is_scalar_v<K> && !is_three_way<C>::value> {};
+
+/**
+ * @brief Transparent three-way comparator.
+ *
+ * @details
+ * Types with a compare() member (std::string, std::string_view) are compared
+ * with a single compare() call. Other types fall back to two operator<
+ * calls.
+ */
+struct compare_three_way {
+  using is_three_way = void;    ///< Opts in to the three-way mode
+  using is_transparent = void;  ///< Allows heterogeneous lookup
+
+  /**
+   * @brief Compares two values.
+   *
+   * @param[in] a The first value.
+   * @param[in] b The second value.
+   * @return int - negative, zero or positive if a is less than, equal to or
+   * greater than b.
+   */
+  template <typename A, typename B>
+  int operator()(const A &a, const B &b) const {
+    if constexpr (has_compare<A, B>::value) {
+      return a.compare(b);
+    } else {
+      return (a < b) ? -1 : (b < a) ? 1 : 0;
+    }
+  }
+
+ private:
+  template <typename A, typename B, typename = void>
+  struct has_compare : std::false_type {};
+
+  template <typename A, typename B>
+  struct has_compare<A, B,
+                     std::void_t<decltype(std::declval<const A &>().compare(
+                         std::declval<const B &>()))>> : std::true_type {};
+};
+
 /**
  * @brief A red-black tree container template class.
  *
@@ -32,8 +113,21 @@ namespace s21 {
  *
  * @tparam K The type of keys stored in the tree.
  * @tparam M The type of values stored in the tree.
+ * @tparam C The comparator ordering the keys. If it declares is_transparent,
+ * lookups also accept any type comparable with K. If it declares
+ * is_three_way, it is called once per level (see is_three_way).
+ * @tparam L If true, every node also links to its in-order neighbours, so an
+ * iterator step is a single pointer load instead of a walk along the parents.
+ * Costs two pointers per node and a few stores on insert and erase.
+ * @tparam S The summary policy, or void for none. Every node then keeps the
+ * summary of its subtree, which makes aggregate() O(log n). The policy is
+ * default constructed on each use and provides the summary type `type`, a call
+ * operator making the summary of one element from a value_type and a call
+ * operator combining the summaries of two adjacent key ranges (it must be
+ * associative). The summary type must be default constructible.
  */
-template <typename K, typename M>
+template <typename K, typename M, typename C = std::less<K>, bool L = false,
+          typename S = void>
 class tree {
  public:
   // Container types
@@ -54,11 +148,13 @@ class tree {
   // Constructors/destructor
 
   explicit tree(Uniq type = kUNIQUE) noexcept;
+  explicit tree(const C &comp, Uniq type = kUNIQUE);
   explicit tree(const value_type &pair, Uniq type = kUNIQUE);
   tree(std::initializer_list<value_type> const &items, Uniq type = kUNIQUE);
   tree(const tree &t);
-  tree(tree &&t);
-  tree &operator=(tree &&t);
+  tree(tree &&t) noexcept(std::is_nothrow_copy_constructible_v<C>);
+  tree &operator=(tree &&t) noexcept(
+      std::is_nothrow_copy_constructible_v<C>);
   tree &operator=(const tree &t);
   ~tree();
 
@@ -73,23 +169,90 @@ class tree {
 
   iterator find(const key_type &key) const;
   iterator insert(const value_type &pair);
+  iterator insert(value_type &&pair);
   iterator erase(const key_type &key) noexcept;
   iterator erase(const_iterator it) noexcept;
   iterator erase(const_iterator first, const_iterator last);
+  size_type erase_all(const key_type &key) noexcept;
   size_type size() const noexcept;
   size_type max_size() const noexcept;
+  C key_comp() const;
   void merge(tree &other);
   void clear() noexcept;
   std::string structure() const noexcept;
 
-  // template <typename... Args>
-  std::pair<iterator, bool> emplace(K key, M val);
+  template <typename Obj>
+  std::pair<iterator, bool> insert_or_assign(const key_type &key, Obj &&obj);
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+  template <typename Key, typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args);
+
+  // Tree lookup
+
+  size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+
+  // Transparent lookup (only with a comparator declaring is_transparent)
+
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator find(const Key &key) const;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  size_type count(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator lower_bound(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent>
+  iterator upper_bound(const Key &key) const noexcept;
+  template <typename Key, typename Cmp = C,
+            typename = typename Cmp::is_transparent,
+            typename = std::enable_if_t<
+                !std::is_convertible_v<const Key &, const_iterator>>>
+  iterator erase(const Key &key) noexcept;
+
+  // Visitation
+
+  template <typename F>
+  bool for_each(F &&fn) const;
+  template <typename F>
+  bool for_each_in_range(const key_type &lo, const key_type &hi,
+                         F &&fn) const;
+
+  // Summaries (only with a summary policy S)
+
+  template <typename Sum = S>
+  std::optional<typename Sum::type> aggregate() const;
+  template <typename Sum = S>
+  std::optional<typename Sum::type> aggregate(const key_type &lo,
+                                              const key_type &hi) const;
+  template <typename Sum = S>
+  std::optional<typename Sum::type> aggregate_before(const key_type &key,
+                                                     bool upper = false) const;
+  template <typename P, typename F>
+  bool for_each_summarized(P &&enter, F &&fn) const;
+
+  // Bulk insertion
+
+  template <typename Iter = iterator, typename... Args>
+  vector<std::pair<Iter, bool>> insert_many(Args &&...args);
+  template <typename Iter = iterator, typename InputIt, typename Make>
+  vector<std::pair<Iter, bool>> insert_range(InputIt first, InputIt last,
+                                             Make make);
 
  private:
   // Container types
 
   struct Node;
+  struct Links;
+  struct NoLinks {};
+  struct Summary;
+  struct NoSummary {};
   enum Colors { kRED, kBLACK };
+  enum Side { kLEFT, kRIGHT };
 
   // Fields
 
@@ -97,53 +260,91 @@ class tree {
   Node *sentinel_{};  ///< Dummy element
   size_type size_{};  ///< Size of tree
   Uniq type_{};       ///< Determines whether to allow duplicates
+  C comp_{};          ///< Orders the keys
+
+  static constexpr bool kSUMMARIZED = !std::is_void_v<S>;  ///< Keeps summaries
 
   // Add/remove nodes
 
   void insertNode(Node *insert, Node *&node, Node *parent = nullptr);
+  iterator linkNode(Node *node);
   Node *extractNode(Node *node) noexcept;
+  iterator eraseNode(Node *node) noexcept;
+  static Node *nextNode(Node *node) noexcept;
   void cleanTree(Node *&node) noexcept;
   void removeConnect(Node *node) noexcept;
   void copyTree(Node *node);
 
+  // Bulk insertion
+
+  using BatchItem = std::pair<Node *, size_type>;
+
+  template <typename Iter>
+  vector<std::pair<Iter, bool>> insertBatch(Node **nodes, size_type count);
+  void sweepBatch(BatchItem *batch, size_type count, Node **placed,
+                  bool *inserted);
+  void rebuildBatch(BatchItem *batch, size_type count, Node **placed,
+                    bool *inserted);
+  static void deleteNodes(Node **nodes, size_type count) noexcept;
+  static void flattenTree(Node *node, Node **out, size_type &pos) noexcept;
+  static Node *buildBalanced(Node **nodes, size_type count, Node *parent,
+                             size_type depth, size_type red_depth) noexcept;
+
+  // Visitation
+
+  template <typename F>
+  static bool visitNode(F &fn, value_type &pair);
+  template <typename F>
+  bool visitNodes(Node *node, const key_type *lo, const key_type *hi,
+                  F &fn) const;
+
+  // Summaries
+
+  void summarizeNode(Node *node) const noexcept;
+  void summarizePath(Node *node) const noexcept;
+  void summarizeTree(Node *node) const noexcept;
+  template <typename T>
+  void summarizeRange(Node *node, const key_type *lo, const key_type *hi,
+                      std::optional<T> &result) const;
+  template <typename P, typename F>
+  bool visitSummarized(Node *node, P &enter, F &fn) const;
+
+  // Threading
+
+  void threadNode(Node *node, Node *parent, bool side) noexcept;
+  void unthreadNode(Node *node) noexcept;
+  void threadSequence(Node **nodes, size_type count) noexcept;
+
   // Tree balancing
 
   void balancingTree(Node *node) noexcept;
   void fixDoubleBlack(Node *&node) noexcept;
   void rotateLeft(Node *old_root) noexcept;
   void rotateRight(Node *old_root) noexcept;
-  void swapColors(Node *node) noexcept;
 
   // Tree searching
 
-  Node *findNode(Node *node, const key_type &key) const noexcept;
+  template <typename A, typename B>
+  bool lessKeys(const A &a, const B &b) const noexcept;
+  template <typename A, typename B>
+  int compareKeys(const A &a, const B &b) const noexcept;
+  template <typename Key>
+  Node *findNode(Node *node, const Key &key) const noexcept;
+  template <typename Key>
+  Node *boundNode(const Key &key, bool upper) const noexcept;
+  template <typename Key>
+  size_type countNodes(const Key &key) const noexcept;
   static Node *findMax(Node *node) noexcept;
   static Node *findMin(Node *node) noexcept;
 
-  // Cases of node removal
-
-  Node *deleteTwoChild(Node *&node) noexcept;
-  Node *deleteOneChild(Node *&node, Node *&child) noexcept;
-  void deleteBlackNoChild(Node *&node) noexcept;
-
-  // Black no child node removal cases
-
-  void redParBlackSonRedLeft(Node *&node) noexcept;
-  void redParBlackSonRedRight(Node *&node) noexcept;
-  void blackParRedSonBlackRight(Node *&node) noexcept;
-  void blackParRedBrosBlackRightRedLeft(Node *&node) noexcept;
-  void blackParBlackBrosBlackAll(Node *&node) noexcept;
-  void blackParBlackBrosRedRightGran(Node *&node) noexcept;
-  void blackParBlackBrosRedLeftOrAllGran(Node *&node) noexcept;
-
   // Printing
 
   std::string printNodes(const Node *node, int indent = 0,
                          bool last = true) const noexcept;
 };
 
-template <typename K, typename M>
-class tree<K, M>::TreeConstIterator {
+template <typename K, typename M, typename C, bool L, typename S>
+class tree<K, M, C, L, S>::TreeConstIterator {
  public:
   // Constructors
 
@@ -164,7 +365,7 @@ class tree<K, M>::TreeConstIterator {
   void operator-=(size_type shift) noexcept;
   bool operator==(const_iterator other) const noexcept;
   bool operator!=(const_iterator other) const noexcept;
-  const value_type operator*() const noexcept;
+  const value_type &operator*() const noexcept;
   iterator toIterator() const noexcept;
 
  protected:
@@ -173,10 +374,14 @@ class tree<K, M>::TreeConstIterator {
   Node *ptr_{};    ///< Pointer to the current node
   Node *first_{};  ///< Pointer to the lowest node
   Node *last_{};   ///< Pointer to a dummy node
+
+  // Friends
+
+  friend class tree;  ///< Erases the node an iterator points to
 };
 
-template <typename K, typename M>
-class tree<K, M>::TreeIterator : public TreeConstIterator {
+template <typename K, typename M, typename C, bool L, typename S>
+class tree<K, M, C, L, S>::TreeIterator : public TreeConstIterator {
  public:
   // Constructors
 
@@ -197,7 +402,7 @@ class tree<K, M>::TreeIterator : public TreeConstIterator {
   void operator-=(size_type shift) noexcept;
   bool operator==(iterator other) const noexcept;
   bool operator!=(iterator other) const noexcept;
-  std::pair<const key_type, mapped_type &> operator*() noexcept;
+  value_type &operator*() noexcept;
 
   /**
    * @brief Converts the current iterator to a constant iterator.
@@ -216,24 +421,54 @@ class tree<K, M>::TreeIterator : public TreeConstIterator {
   // }
 };
 
+/**
+ * @brief In-order links of a node in a threaded tree.
+ *
+ * @details
+ * The links form a circular list through the sentinel: the sentinel follows
+ * the greatest node and precedes the lowest one. Rotations do not change the
+ * order of the nodes, so only linking and unlinking a node touch the list.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+struct tree<K, M, C, L, S>::Links {
+  Node *link[2]{};  ///< Previous and next nodes in key order (see Side)
+};
+
+/**
+ * @brief Summary of the subtree of a node in a summarized tree.
+ *
+ * @details
+ * Combines, in key order, the summaries of the left subtree, of the node's own
+ * element and of the right subtree. It is recomputed bottom-up wherever the
+ * subtree changes: along the path of an inserted or removed node and at both
+ * nodes of a rotation.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+struct tree<K, M, C, L, S>::Summary {
+  typename S::type summary{};  ///< Summary of the subtree
+};
+
 /**
  * @brief A node in the red-black tree.
  *
  * @details
  * This class represents a node in the red-black tree. It contains the key,
- * value, color, parent, left child, and right child of the node.
+ * value, color, parent, left child, and right child of the node. A threaded
+ * tree adds the in-order links (see Links), a summarized tree the summary of
+ * the subtree (see Summary).
  *
  * @tparam K The type of keys stored in the tree.
  * @tparam M The type of values stored in the tree.
  */
-template <typename K, typename M>
-struct tree<K, M>::Node {
+template <typename K, typename M, typename C, bool L, typename S>
+struct tree<K, M, C, L, S>::Node
+    : std::conditional_t<L, Links, NoLinks>,
+      std::conditional_t<kSUMMARIZED, Summary, NoSummary> {
  public:
   value_type *pair;  ///< Node key
   Colors color;      ///< Color of node (red/black)
   Node *parent;      ///< Parent of this node
-  Node *left{};      ///< Left son of this node
-  Node *right{};     ///< Right son of this node
+  Node *child[2]{};  ///< Left and right sons of this node (see Side)
 
   /**
    * @brief Constructs a new node.
@@ -246,6 +481,21 @@ struct tree<K, M>::Node {
   Node(const value_type &pair_, Colors color_ = kRED, Node *parent_ = 0)
       : pair{new value_type{pair_}}, color{color_}, parent{parent_} {}
 
+  /**
+   * @brief Constructs a new red node with the pair built from arguments.
+   *
+   * @details
+   * The arguments are forwarded to the constructor of value_type, so the pair
+   * is built directly in its final storage without a temporary.
+   *
+   * @param[in] args The arguments for the pair constructor.
+   */
+  template <typename... Args>
+  explicit Node(std::in_place_t, Args &&...args)
+      : pair{new value_type(std::forward<Args>(args)...)},
+        color{kRED},
+        parent{} {}
+
   /**
    * @brief Destructor. Destroys nodes pair.
    */
@@ -14,8 +14,23 @@
 #ifndef _S21_CONTAINERSPLUS_H_
 #define _S21_CONTAINERSPLUS_H_
 
+#include "./headers/s21_aggregate_map.h"
 #include "./headers/s21_array.h"
+#include "./headers/s21_concurrent_map.h"
+#include "./headers/s21_cow.h"
+#include "./headers/s21_flat_map.h"
+#include "./headers/s21_flat_multiset.h"
+#include "./headers/s21_flat_set.h"
+#include "./headers/s21_interval_map.h"
+#include "./headers/s21_interval_set.h"
+#include "./headers/s21_multimap.h"
 #include "./headers/s21_multiset.h"
+#include "./headers/s21_persistent_map.h"
+#include "./headers/s21_persistent_set.h"
+#include "./headers/s21_skiplist_map.h"
+#include "./headers/s21_skiplist_set.h"
+#include "./headers/s21_small_vector.h"
+#include "./headers/s21_static_vector.h"
 #include "./s21_containers.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,279 @@
+/**
+ * @file aggregate_map.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the aggregate map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_aggregate_map.h"
+
+using namespace s21;
+
+// AGGREGATE MAP CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty aggregate map ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+aggregate_map<K, V, Monoid, C>::aggregate_map(const C &comp) : tree_{comp} {}
+
+/**
+ * @brief Constructs an aggregate map with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of key-value pairs to insert.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+aggregate_map<K, V, Monoid, C>::aggregate_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    tree_.insert(item);
+  }
+}
+
+// AGGREGATE MAP ELEMENT ACCESS
+
+/**
+ * @brief Returns the value of the element with the given key.
+ *
+ * @param[in] key The key of the element.
+ * @return const mapped_type& - the value of the element.
+ * @throws std::out_of_range if the key is not present.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::at(const key_type &key) const
+    -> const mapped_type & {
+  iterator it = tree_.find(key);
+
+  if (it == end()) {
+    throw std::out_of_range("aggregate_map::at() - missing element");
+  }
+
+  return (*it).second;
+}
+
+// AGGREGATE MAP ITERATORS
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return iterator - an iterator to the first element.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::begin() const noexcept -> iterator {
+  return tree_.cbegin();
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return iterator - an iterator past the last element.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::end() const noexcept -> iterator {
+  return tree_.cend();
+}
+
+// AGGREGATE MAP CAPACITY
+
+/**
+ * @brief Checks whether the aggregate map is empty.
+ *
+ * @return bool - true if there are no elements, false otherwise.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+bool aggregate_map<K, V, Monoid, C>::empty() const noexcept {
+  return !tree_.size();
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::size() const noexcept -> size_type {
+  return tree_.size();
+}
+
+// AGGREGATE MAP MODIFIERS
+
+/**
+ * @brief Removes all elements.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+void aggregate_map<K, V, Monoid, C>::clear() noexcept {
+  tree_.clear();
+}
+
+/**
+ * @brief Inserts an element if its key is not present.
+ *
+ * @param[in] value The key-value pair to insert.
+ * @return iterator_bool - an iterator to the element with the key and whether
+ * the insertion took place.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::insert(const_reference value)
+    -> iterator_bool {
+  return tree_.try_emplace(value.first, value.second);
+}
+
+/**
+ * @brief Inserts an element or assigns to the value of an existing one.
+ *
+ * @details
+ * The aggregates above the element are refreshed, which takes O(log n).
+ *
+ * @param[in] key The key of the element.
+ * @param[in] obj The value to insert or assign.
+ * @return iterator_bool - an iterator to the element and whether the insertion
+ * took place.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::insert_or_assign(const key_type &key,
+                                                      const mapped_type &obj)
+    -> iterator_bool {
+  return tree_.insert_or_assign(key, obj);
+}
+
+/**
+ * @brief Removes the element at the given position.
+ *
+ * @param[in] pos An iterator to the element to remove.
+ * @return iterator - an iterator to the element following the removed one.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::erase(const_iterator pos) -> iterator {
+  return tree_.erase(pos);
+}
+
+/**
+ * @brief Removes the element with the given key.
+ *
+ * @param[in] key The key of the element to remove.
+ * @return size_type - the number of removed elements (0 or 1).
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::erase(const key_type &key) -> size_type {
+  size_type count = tree_.count(key);
+
+  tree_.erase(key);
+
+  return count;
+}
+
+// AGGREGATE MAP LOOKUP
+
+/**
+ * @brief Searches for the element with the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the element, or end() if not found.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::find(const key_type &key) const
+    -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Checks whether an element with the given key is present.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+bool aggregate_map<K, V, Monoid, C>::contains(const key_type &key) const {
+  return tree_.count(key);
+}
+
+/**
+ * @brief Returns an iterator to the first element not less than the key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the element, or end() if there is none.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::lower_bound(const key_type &key) const
+    noexcept -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Returns an iterator to the first element greater than the key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the element, or end() if there is none.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::upper_bound(const key_type &key) const
+    noexcept -> iterator {
+  return tree_.upper_bound(key);
+}
+
+// AGGREGATE MAP AGGREGATES
+
+/**
+ * @brief Returns the aggregate of all values.
+ *
+ * @details
+ * Takes O(1): it is the aggregate stored at the root.
+ *
+ * @return mapped_type - the aggregate, or the identity of the Monoid if the
+ * map is empty.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::aggregate() const -> mapped_type {
+  return tree_.aggregate().value_or(Monoid{}.identity());
+}
+
+/**
+ * @brief Returns the aggregate of the values with keys in [lo, hi).
+ *
+ * @details
+ * Takes O(log n) whatever the number of elements in the range (see
+ * tree::aggregate()).
+ *
+ * @param[in] lo The lowest key to include.
+ * @param[in] hi The key to stop at, not included itself.
+ * @return mapped_type - the aggregate, or the identity of the Monoid if the
+ * range is empty.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+auto aggregate_map<K, V, Monoid, C>::aggregate(const key_type &lo,
+                                               const key_type &hi) const
+    -> mapped_type {
+  return tree_.aggregate(lo, hi).value_or(Monoid{}.identity());
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * The elements are visited in ascending key order and the function may stop
+ * the traversal early by returning false (see tree::for_each_in_range()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with a constant reference to each
+ * key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename V, typename Monoid, typename C>
+template <typename F>
+bool aggregate_map<K, V, Monoid, C>::for_each_in_range(const key_type &lo,
+                                                       const key_type &hi,
+                                                       F &&fn) const {
+  return tree_.for_each_in_range(
+      lo, hi, [&fn](const value_type &pair) -> decltype(auto) {
+        return fn(pair);
+      });
+}
\ No newline at end of file
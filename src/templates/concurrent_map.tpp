@@ -0,0 +1,378 @@
+/**
+ * @file concurrent_map.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the sharded concurrent map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_concurrent_map.h"
+
+using namespace s21;
+
+// CONCURRENT MAP CONSTRUCTORS/DESTRUCTOR
+
+/**
+ * @brief Constructs an empty concurrent map.
+ *
+ * @details
+ * More shards let more updates run in parallel, at the price of a larger
+ * merge in the ordered traversals.
+ *
+ * @param[in] shards The number of shards, at least one.
+ * @param[in] comp The comparator ordering the keys.
+ * @param[in] hash The hash spreading the keys over the shards.
+ */
+template <typename K, typename M, typename C, typename H>
+concurrent_map<K, M, C, H>::concurrent_map(size_type shards, const C &comp,
+                                           const H &hash)
+    : count_{shards ? shards : 1}, comp_{comp}, hash_{hash} {
+  shards_ = new Shard[count_];
+
+  for (size_type i = 0; i < count_; ++i) {
+    shards_[i].tree = tree_type{comp_};
+  }
+}
+
+/**
+ * @brief Constructs a concurrent map with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of key-value pairs to insert.
+ */
+template <typename K, typename M, typename C, typename H>
+concurrent_map<K, M, C, H>::concurrent_map(
+    std::initializer_list<value_type> const &items)
+    : concurrent_map() {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+/**
+ * @brief Destructor. Frees the shards.
+ */
+template <typename K, typename M, typename C, typename H>
+concurrent_map<K, M, C, H>::~concurrent_map() {
+  delete[] shards_;
+}
+
+// CONCURRENT MAP CAPACITY
+
+/**
+ * @brief Checks whether the concurrent map is empty.
+ *
+ * @return bool - true if there are no elements, false otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+bool concurrent_map<K, M, C, H>::empty() const {
+  return !size();
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @details
+ * The shards are counted one after another, so with concurrent updates the
+ * result is the size at no single moment, only a value between the smallest
+ * and the greatest size during the call.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename M, typename C, typename H>
+auto concurrent_map<K, M, C, H>::size() const -> size_type {
+  size_type result = 0;
+
+  for (size_type i = 0; i < count_; ++i) {
+    std::shared_lock lock{shards_[i].mutex};
+
+    result += shards_[i].tree.size();
+  }
+
+  return result;
+}
+
+/**
+ * @brief Returns the number of shards.
+ *
+ * @return size_type - the number of shards.
+ */
+template <typename K, typename M, typename C, typename H>
+auto concurrent_map<K, M, C, H>::shard_count() const noexcept -> size_type {
+  return count_;
+}
+
+// CONCURRENT MAP MODIFIERS
+
+/**
+ * @brief Removes all elements, one shard after another.
+ */
+template <typename K, typename M, typename C, typename H>
+void concurrent_map<K, M, C, H>::clear() {
+  for (size_type i = 0; i < count_; ++i) {
+    std::unique_lock lock{shards_[i].mutex};
+
+    shards_[i].tree.clear();
+  }
+}
+
+/**
+ * @brief Inserts an element if its key is not present.
+ *
+ * @param[in] value The key-value pair to insert.
+ * @return bool - true if the element was inserted, false otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+bool concurrent_map<K, M, C, H>::insert(const_reference value) {
+  Shard &shard = shardOf(value.first);
+  std::unique_lock lock{shard.mutex};
+
+  return shard.tree.try_emplace(value.first, value.second).second;
+}
+
+/**
+ * @brief Inserts an element if its key is not present.
+ *
+ * @param[in] key The key of the element.
+ * @param[in] obj The value of the element.
+ * @return bool - true if the element was inserted, false otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+bool concurrent_map<K, M, C, H>::insert(const key_type &key,
+                                        const mapped_type &obj) {
+  Shard &shard = shardOf(key);
+  std::unique_lock lock{shard.mutex};
+
+  return shard.tree.try_emplace(key, obj).second;
+}
+
+/**
+ * @brief Inserts an element or assigns to the value of an existing one.
+ *
+ * @param[in] key The key of the element.
+ * @param[in] obj The value to insert or assign.
+ * @return bool - true if the element was inserted, false if it was assigned.
+ */
+template <typename K, typename M, typename C, typename H>
+bool concurrent_map<K, M, C, H>::insert_or_assign(const key_type &key,
+                                                  const mapped_type &obj) {
+  Shard &shard = shardOf(key);
+  std::unique_lock lock{shard.mutex};
+
+  return shard.tree.insert_or_assign(key, obj).second;
+}
+
+/**
+ * @brief Removes the element with the given key.
+ *
+ * @param[in] key The key of the element to remove.
+ * @return size_type - the number of removed elements (0 or 1).
+ */
+template <typename K, typename M, typename C, typename H>
+auto concurrent_map<K, M, C, H>::erase(const key_type &key) -> size_type {
+  Shard &shard = shardOf(key);
+  std::unique_lock lock{shard.mutex};
+  size_type count = shard.tree.count(key);
+
+  if (count) {
+    shard.tree.erase(key);
+  }
+
+  return count;
+}
+
+// CONCURRENT MAP LOOKUP
+
+/**
+ * @brief Searches for the element with the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return std::optional<mapped_type> - a copy of the value, or nothing if the
+ * key is not present.
+ */
+template <typename K, typename M, typename C, typename H>
+auto concurrent_map<K, M, C, H>::find(const key_type &key) const
+    -> std::optional<mapped_type> {
+  Shard &shard = shardOf(key);
+  std::shared_lock lock{shard.mutex};
+  auto it = shard.tree.find(key);
+
+  if (it == shard.tree.end()) {
+    return std::nullopt;
+  }
+
+  return (*it).second;
+}
+
+/**
+ * @brief Checks whether an element with the given key is present.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+bool concurrent_map<K, M, C, H>::contains(const key_type &key) const {
+  Shard &shard = shardOf(key);
+  std::shared_lock lock{shard.mutex};
+
+  return shard.tree.count(key);
+}
+
+/**
+ * @brief Calls a function with the value of the given key under the lock.
+ *
+ * @details
+ * The shard of the key is locked for writing, so the function may modify the
+ * value in place (a read-modify-write such as incrementing a counter is then
+ * atomic). It must not call back into the map.
+ *
+ * @tparam F The type of the function.
+ * @param[in] key The key of the element.
+ * @param[in] fn The function called with a reference to the value.
+ * @return bool - true if the key was present and the function was called,
+ * false otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+template <typename F>
+bool concurrent_map<K, M, C, H>::visit(const key_type &key, F &&fn) {
+  Shard &shard = shardOf(key);
+  std::unique_lock lock{shard.mutex};
+  auto it = shard.tree.find(key);
+
+  if (it == shard.tree.end()) {
+    return false;
+  }
+
+  fn((*it).second);
+
+  return true;
+}
+
+// CONCURRENT MAP ORDERED TRAVERSAL
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * All shards are locked for reading during the traversal, so it sees the map
+ * at one moment. The function may stop the traversal early by returning
+ * false; it must not call back into the map for writing.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a constant reference to each
+ * key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+template <typename F>
+bool concurrent_map<K, M, C, H>::for_each(F &&fn) const {
+  return visitMerged(nullptr, nullptr, fn);
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * The elements are visited as in for_each().
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with a constant reference to each
+ * key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+template <typename F>
+bool concurrent_map<K, M, C, H>::for_each_in_range(const key_type &lo,
+                                                   const key_type &hi,
+                                                   F &&fn) const {
+  return visitMerged(&lo, &hi, fn);
+}
+
+// CONCURRENT MAP HELPERS
+
+/**
+ * @brief Returns the shard holding a key.
+ *
+ * @param[in] key The key.
+ * @return Shard& - the shard selected by the hash of the key.
+ */
+template <typename K, typename M, typename C, typename H>
+auto concurrent_map<K, M, C, H>::shardOf(const key_type &key) const noexcept
+    -> Shard & {
+  return shards_[hash_(key) % count_];
+}
+
+/**
+ * @brief Merges the shards in key order and calls a function for each element.
+ *
+ * @details
+ * The read locks are taken in shard order, which cannot deadlock with the
+ * single-shard operations. Each shard contributes a cursor starting at its
+ * first key not less than lo, and a min-heap of cursors yields the elements
+ * in order.
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit, or nullptr for no bound.
+ * @param[in] hi The key to stop at, or nullptr for no bound.
+ * @param[in] fn The function called with a constant reference to each pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, typename H>
+template <typename F>
+bool concurrent_map<K, M, C, H>::visitMerged(const key_type *lo,
+                                             const key_type *hi,
+                                             F &fn) const {
+  auto locks = std::make_unique<std::shared_lock<std::shared_mutex>[]>(count_);
+  auto cursors = std::make_unique<Cursor[]>(count_);
+  Cursor *begin = cursors.get();
+  Cursor *end = begin;
+  bool completed = true;
+  auto later = [this](const Cursor &a, const Cursor &b) {
+    return comp_((*b.first).first, (*a.first).first);
+  };
+
+  for (size_type i = 0; i < count_; ++i) {
+    const tree_type &tree = shards_[i].tree;
+
+    locks[i] = std::shared_lock{shards_[i].mutex};
+
+    auto first = lo ? tree.lower_bound(*lo) : tree.cbegin();
+
+    if (first != tree.cend()) {
+      *end++ = {first, tree.cend()};
+    }
+  }
+
+  std::make_heap(begin, end, later);
+
+  while (completed && begin != end) {
+    std::pop_heap(begin, end, later);
+
+    Cursor &top = *(end - 1);
+    const value_type &pair = *top.first;
+
+    if (hi && !comp_(pair.first, *hi)) {
+      break;
+    }
+
+    if constexpr (std::is_void_v<
+                      std::invoke_result_t<F &, const value_type &>>) {
+      fn(pair);
+    } else {
+      completed = static_cast<bool>(fn(pair));
+    }
+
+    if (++top.first == top.second) {
+      --end;
+    } else {
+      std::push_heap(begin, end, later);
+    }
+  }
+
+  return completed;
+}
\ No newline at end of file
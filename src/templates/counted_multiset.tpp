@@ -0,0 +1,640 @@
+/**
+ * @file counted_multiset.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the counted mode of the multiset container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_multiset.h"
+
+using namespace s21;
+
+// COUNTED MULTISET CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty multiset ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool L>
+multiset<K, C, L, true>::multiset(const C &comp) : tree_{comp} {}
+
+/**
+ * @brief Constructs a multiset with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of values to insert into the multiset.
+ */
+template <typename K, typename C, bool L>
+multiset<K, C, L, true>::multiset(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+/**
+ * @brief Copy constructor for the multiset.
+ *
+ * @param[in] ms The multiset to copy from.
+ */
+template <typename K, typename C, bool L>
+multiset<K, C, L, true>::multiset(const multiset &ms)
+    : tree_{ms.tree_}, size_{ms.size_} {}
+
+/**
+ * @brief Move constructor for the multiset.
+ *
+ * @param[in] ms The multiset to move from, left empty.
+ */
+template <typename K, typename C, bool L>
+multiset<K, C, L, true>::multiset(multiset &&ms) noexcept(
+    std::is_nothrow_copy_constructible_v<C>)
+    : tree_{std::move(ms.tree_)}, size_{std::exchange(ms.size_, 0)} {}
+
+/**
+ * @brief Move assignment operator for the multiset.
+ *
+ * @param[in] ms The multiset to move from.
+ * @return multiset<K, C, L, true>& - reference to the assigned multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::operator=(multiset &&ms) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) -> multiset & {
+  if (this != &ms) {
+    tree_.clear();
+    new (this) multiset{std::move(ms)};
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Copy assignment operator for the multiset.
+ *
+ * @param[in] ms The multiset to copy from.
+ * @return multiset<K, C, L, true>& - reference to the assigned multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::operator=(const multiset &ms) -> multiset & {
+  if (this != &ms) {
+    tree_.clear();
+    new (this) multiset{ms};
+  }
+
+  return *this;
+}
+
+// COUNTED MULTISET ITERATORS
+
+/**
+ * @brief Returns an iterator to the first occurrence of the lowest key.
+ *
+ * @return iterator - an iterator to the beginning of the multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::begin() const noexcept -> iterator {
+  return iterator{tree_.cbegin()};
+}
+
+/**
+ * @brief Returns an iterator past the last occurrence of the greatest key.
+ *
+ * @return iterator - an iterator to the end of the multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::end() const noexcept -> iterator {
+  return iterator{tree_.cend()};
+}
+
+/**
+ * @brief Returns a const iterator to the beginning of the multiset.
+ *
+ * @return const_iterator - a const iterator to the beginning of the multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::cbegin() const noexcept -> const_iterator {
+  return begin();
+}
+
+/**
+ * @brief Returns a const iterator to the end of the multiset.
+ *
+ * @return const_iterator - a const iterator to the end of the multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::cend() const noexcept -> const_iterator {
+  return end();
+}
+
+// COUNTED MULTISET CAPACITY
+
+/**
+ * @brief Checks if the multiset is empty.
+ *
+ * @return bool - true if the multiset is empty, false otherwise.
+ */
+template <typename K, typename C, bool L>
+bool multiset<K, C, L, true>::empty() const noexcept {
+  return !size_;
+}
+
+/**
+ * @brief Returns the number of elements, counting every occurrence.
+ *
+ * @return size_type - the number of elements in the multiset.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::size() const noexcept -> size_type {
+  return size_;
+}
+
+/**
+ * @brief Returns the maximum number of elements the multiset can hold.
+ *
+ * @return size_type - the maximum number of elements.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::max_size() const noexcept -> size_type {
+  return std::numeric_limits<size_type>::max();
+}
+
+/**
+ * @brief Returns the number of distinct keys, that is the number of nodes.
+ *
+ * @return size_type - the number of distinct keys.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::distinct() const noexcept -> size_type {
+  return tree_.size();
+}
+
+// COUNTED MULTISET MODIFIERS
+
+/**
+ * @brief Clears the contents of the multiset.
+ */
+template <typename K, typename C, bool L>
+void multiset<K, C, L, true>::clear() {
+  tree_.clear();
+  size_ = 0;
+}
+
+/**
+ * @brief Inserts one occurrence of a value.
+ *
+ * @param[in] value The value to insert.
+ * @return iterator - an iterator to the inserted occurrence, the last of its
+ * run.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::insert(const_reference value) -> iterator {
+  return insert(value, 1);
+}
+
+/**
+ * @brief Inserts several occurrences of a value at once.
+ *
+ * @details
+ * Takes a single search whatever the number of occurrences.
+ *
+ * @param[in] value The value to insert.
+ * @param[in] occurrences The number of occurrences to insert.
+ * @return iterator - an iterator to the last inserted occurrence, or the
+ * result of find() if no occurrence is inserted.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::insert(const_reference value,
+                                     size_type occurrences) -> iterator {
+  if (!occurrences) {
+    return find(value);
+  }
+
+  auto it = tree_.try_emplace(value, 0).first;
+
+  (*it).second += occurrences;
+  size_ += occurrences;
+
+  return iterator{it, (*it).second - 1};
+}
+
+/**
+ * @brief Erases the occurrence at the specified position.
+ *
+ * @details
+ * The node of the key is only removed with its last occurrence.
+ *
+ * @param[in] pos The position of the occurrence to erase.
+ * @return iterator - an iterator to the occurrence following the erased one,
+ * or end() if the erased occurrence was the last one.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::erase(const_iterator pos) -> iterator {
+  auto node = pos.node_.toIterator();
+  size_type &run = (*node).second;
+
+  --size_;
+
+  if (!--run) {
+    return iterator{tree_.erase(pos.node_)};
+  }
+
+  return (pos.index_ < run) ? pos : iterator{++node};
+}
+
+/**
+ * @brief Erases every occurrence of a key.
+ *
+ * @details
+ * Removes a single node, so it takes O(log n) whatever the number of
+ * occurrences.
+ *
+ * @param[in] key The key to erase.
+ * @return size_type - the number of erased occurrences.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::erase(const key_type &key) -> size_type {
+  size_type erased = count(key);
+
+  if (erased) {
+    tree_.erase(key);
+    size_ -= erased;
+  }
+
+  return erased;
+}
+
+/**
+ * @brief Swaps the contents of the multiset with another multiset.
+ *
+ * @param[in,out] other The multiset to swap with.
+ */
+template <typename K, typename C, bool L>
+void multiset<K, C, L, true>::swap(multiset &other) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
+  std::swap(tree_, other.tree_);
+  std::swap(size_, other.size_);
+}
+
+/**
+ * @brief Moves every occurrence of another multiset into the multiset.
+ *
+ * @details
+ * The runs are added to each other, so the cost depends on the number of
+ * distinct keys of the other multiset only.
+ *
+ * @param[in,out] other The multiset to merge with, left empty.
+ */
+template <typename K, typename C, bool L>
+void multiset<K, C, L, true>::merge(multiset &other) {
+  if (this != &other) {
+    other.for_each_run(
+        [this](const_reference key, size_type run) { insert(key, run); });
+    other.clear();
+  }
+}
+
+/**
+ * @brief Inserts one occurrence of a value constructed from arguments.
+ *
+ * @details
+ * The value is built first, to be searched for: a present key only increases
+ * its run.
+ *
+ * @tparam Args The types of the arguments to forward to the constructor of the
+ * element.
+ * @param args The arguments to forward to the constructor of the element.
+ * @return iterator - an iterator to the inserted occurrence.
+ */
+template <typename K, typename C, bool L>
+template <typename... Args>
+auto multiset<K, C, L, true>::emplace(Args &&...args) -> iterator {
+  return insert(std::remove_const_t<K>(std::forward<Args>(args)...));
+}
+
+/**
+ * @brief Inserts one occurrence of every argument.
+ *
+ * @param args The values to insert.
+ * @return A vector containing pairs of <iterator,bool> in the order of the
+ * arguments, where bool is always true.
+ */
+template <typename K, typename C, bool L>
+template <typename... Args>
+auto multiset<K, C, L, true>::insert_many(Args &&...args)
+    -> vector<std::pair<iterator, bool>> {
+  vector<std::pair<iterator, bool>> result;
+
+  result.reserve(sizeof...(args));
+  (result.push_back({insert(std::forward<Args>(args)), true}), ...);
+
+  return result;
+}
+
+/**
+ * @brief Inserts one occurrence of every element of the range [first, last).
+ *
+ * @param[in] first The beginning of the range of elements.
+ * @param[in] last The end of the range of elements.
+ * @return A vector containing pairs of <iterator,bool> in the order of the
+ * range, where bool is always true.
+ */
+template <typename K, typename C, bool L>
+template <typename InputIt>
+auto multiset<K, C, L, true>::insert_range(InputIt first, InputIt last)
+    -> vector<std::pair<iterator, bool>> {
+  vector<std::pair<iterator, bool>> result;
+
+  for (; first != last; ++first) {
+    result.push_back({insert(*first), true});
+  }
+
+  return result;
+}
+
+// COUNTED MULTISET LOOKUP
+
+/**
+ * @brief Counts the occurrences of a key.
+ *
+ * @details
+ * A single search reads the run of the key, so it takes O(log n) in the
+ * number of distinct keys.
+ *
+ * @param[in] key The key to search for.
+ * @return size_type - the number of occurrences of the key.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::count(const key_type &key) const noexcept
+    -> size_type {
+  auto it = tree_.find(key);
+
+  return (it != tree_.end()) ? (*it).second : 0;
+}
+
+/**
+ * @brief Searches for the first occurrence of a key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the first occurrence, or `end()` if the
+ * key is not found.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::find(const key_type &key) const noexcept
+    -> iterator {
+  return iterator{tree_.find(key)};
+}
+
+/**
+ * @brief Checks if the multiset contains a key.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename C, bool L>
+bool multiset<K, C, L, true>::contains(const key_type &key) const noexcept {
+  return tree_.find(key) != tree_.end();
+}
+
+/**
+ * @brief Returns the range of the occurrences of a key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator_range - a pair of iterators representing the range.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::equal_range(const key_type &key) const noexcept
+    -> iterator_range {
+  return iterator_range{lower_bound(key), upper_bound(key)};
+}
+
+/**
+ * @brief Finds the first occurrence of the lowest key not less than a key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found occurrence, or `end()`.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::lower_bound(const key_type &key) const noexcept
+    -> iterator {
+  return iterator{tree_.lower_bound(key)};
+}
+
+/**
+ * @brief Finds the first occurrence of the lowest key greater than a key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found occurrence, or `end()`.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::upper_bound(const key_type &key) const noexcept
+    -> iterator {
+  return iterator{tree_.upper_bound(key)};
+}
+
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return C - a copy of the comparator.
+ */
+template <typename K, typename C, bool L>
+C multiset<K, C, L, true>::key_comp() const {
+  return tree_.key_comp();
+}
+
+/**
+ * @brief Returns a string representation of the tree structure.
+ *
+ * @return std::string - a string representation of the tree structure.
+ */
+template <typename K, typename C, bool L>
+std::string multiset<K, C, L, true>::structure() const noexcept {
+  return tree_.structure();
+}
+
+// COUNTED MULTISET VISITATION
+
+/**
+ * @brief Calls a function for every occurrence in ascending key order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false; a function
+ * returning void always visits every occurrence (see tree::for_each()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with each key, once per occurrence.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename F>
+bool multiset<K, C, L, true>::for_each(F &&fn) const {
+  return tree_.for_each(
+      [&fn](const auto &run) { return visitRun(fn, run); });
+}
+
+/**
+ * @brief Calls a function for every occurrence of a key in [lo, hi).
+ *
+ * @details
+ * Only the part of the tree overlapping the range is traversed, in ascending
+ * key order (see tree::for_each_in_range()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with each key, once per occurrence.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename F>
+bool multiset<K, C, L, true>::for_each_in_range(const key_type &lo,
+                                                const key_type &hi,
+                                                F &&fn) const {
+  return tree_.for_each_in_range(
+      lo, hi, [&fn](const auto &run) { return visitRun(fn, run); });
+}
+
+/**
+ * @brief Calls a function for every distinct key with its number of
+ * occurrences.
+ *
+ * @details
+ * The keys are visited in ascending order, once each, and the function may
+ * stop the traversal early as in for_each().
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with each key and its number of
+ * occurrences.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename F>
+bool multiset<K, C, L, true>::for_each_run(F &&fn) const {
+  return tree_.for_each([&fn](const auto &run) -> decltype(auto) {
+    return fn(run.first, run.second);
+  });
+}
+
+/**
+ * @brief Calls a visitor once per occurrence of a key.
+ *
+ * @tparam F The type of the visitor.
+ * @param[in] fn The visitor.
+ * @param[in] run The key and its number of occurrences.
+ * @return bool - false if the visitor asks to stop, true otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename F>
+bool multiset<K, C, L, true>::visitRun(
+    F &fn, const typename tree_type::value_type &run) {
+  for (size_type i = 0; i < run.second; ++i) {
+    if constexpr (std::is_void_v<std::invoke_result_t<F &, const_reference>>) {
+      fn(run.first);
+    } else if (!fn(run.first)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// COUNTED MULTISET ITERATOR OPERATORS
+
+/**
+ * @brief Pre-increment operator for the counted multiset iterator.
+ *
+ * @return iterator& - reference to the incremented iterator.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::iterator::operator++() noexcept -> iterator & {
+  if (++index_ >= (*node_).second) {
+    ++node_;
+    index_ = 0;
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for the counted multiset iterator.
+ *
+ * @return iterator& - reference to the decremented iterator.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::iterator::operator--() noexcept -> iterator & {
+  if (index_) {
+    --index_;
+  } else {
+    --node_;
+    index_ = (*node_).second - 1;
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Post-increment operator for the counted multiset iterator.
+ *
+ * @return iterator - the original iterator before the increment.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::iterator::operator++(int) noexcept -> iterator {
+  iterator copy{*this};
+
+  ++*this;
+
+  return copy;
+}
+
+/**
+ * @brief Post-decrement operator for the counted multiset iterator.
+ *
+ * @return iterator - the original iterator before the decrement.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::iterator::operator--(int) noexcept -> iterator {
+  iterator copy{*this};
+
+  --*this;
+
+  return copy;
+}
+
+/**
+ * @brief Equality comparison operator for the counted multiset iterator.
+ *
+ * @param[in] other The iterator to compare with.
+ * @return true if both iterators point to the same occurrence.
+ */
+template <typename K, typename C, bool L>
+bool multiset<K, C, L, true>::iterator::operator==(
+    const iterator &other) const noexcept {
+  return node_ == other.node_ && index_ == other.index_;
+}
+
+/**
+ * @brief Inequality comparison operator for the counted multiset iterator.
+ *
+ * @param[in] other The iterator to compare with.
+ * @return true if the iterators point to different occurrences.
+ */
+template <typename K, typename C, bool L>
+bool multiset<K, C, L, true>::iterator::operator!=(
+    const iterator &other) const noexcept {
+  return !(*this == other);
+}
+
+/**
+ * @brief Dereference operator for the counted multiset iterator.
+ *
+ * @return const_reference - const reference to the key of the occurrence.
+ */
+template <typename K, typename C, bool L>
+auto multiset<K, C, L, true>::iterator::operator*() const noexcept
+    -> const_reference {
+  return (*node_).first;
+}
\ No newline at end of file
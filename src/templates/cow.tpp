@@ -0,0 +1,214 @@
+/**
+ * @file cow.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the copy-on-write container handle.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_cow.h"
+
+using namespace s21;
+
+// COW CONSTRUCTORS
+
+/**
+ * @brief Constructs a handle to an empty container.
+ */
+template <typename T>
+cow<T>::cow() : block_{new Block{std::in_place}} {}
+
+/**
+ * @brief Constructs a handle to a copy of a container.
+ *
+ * @param[in] value The container to copy.
+ */
+template <typename T>
+cow<T>::cow(const value_type &value)
+    : block_{new Block{std::in_place, value}} {}
+
+/**
+ * @brief Constructs a handle taking the elements of a container.
+ *
+ * @param[in] value The container to move from.
+ */
+template <typename T>
+cow<T>::cow(value_type &&value)
+    : block_{new Block{std::in_place, std::move(value)}} {}
+
+/**
+ * @brief Constructs a handle to a container built from arguments.
+ *
+ * @param[in] args The arguments for the container constructor.
+ */
+template <typename T>
+template <typename... Args>
+cow<T>::cow(std::in_place_t, Args &&...args)
+    : block_{new Block{std::in_place, std::forward<Args>(args)...}} {}
+
+/**
+ * @brief Copy constructor. Shares the container of another handle in O(1).
+ *
+ * @param[in] other The handle to copy.
+ */
+template <typename T>
+cow<T>::cow(const cow &other) noexcept : block_{other.block_} {
+  if (block_) {
+    block_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Move constructor. Takes the container of another handle.
+ *
+ * @details
+ * The moved from handle holds no container: it reads as an empty one until
+ * it is written or assigned to.
+ *
+ * @param[in] other The handle to move from.
+ */
+template <typename T>
+cow<T>::cow(cow &&other) noexcept
+    : block_{std::exchange(other.block_, nullptr)} {}
+
+/**
+ * @brief Assignment operator. Releases the held container.
+ *
+ * @param[in] other The handle to assign from.
+ * @return cow& - a reference to this handle.
+ */
+template <typename T>
+auto cow<T>::operator=(cow other) noexcept -> cow & {
+  swap(other);
+
+  return *this;
+}
+
+/**
+ * @brief Destructor. Deletes the container with its last handle.
+ */
+template <typename T>
+cow<T>::~cow() {
+  if (block_ && block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete block_;
+  }
+}
+
+// COW ACCESS
+
+/**
+ * @brief Accesses the container for reading.
+ *
+ * @return const value_type& - the shared container.
+ */
+template <typename T>
+auto cow<T>::operator*() const noexcept -> const value_type & {
+  return shared();
+}
+
+/**
+ * @brief Accesses the container for reading.
+ *
+ * @return const value_type* - the shared container.
+ */
+template <typename T>
+auto cow<T>::operator->() const noexcept -> const value_type * {
+  return &shared();
+}
+
+/**
+ * @brief Accesses the container for reading.
+ *
+ * @return const value_type& - the shared container.
+ */
+template <typename T>
+auto cow<T>::read() const noexcept -> const value_type & {
+  return shared();
+}
+
+/**
+ * @brief Accesses the container for writing.
+ *
+ * @details
+ * If other handles share the container, it is copied first and this handle
+ * keeps the copy, which costs one copy of the container the first time only.
+ * A moved from handle gets a new empty container.
+ *
+ * @return value_type& - the container owned by this handle alone.
+ * @throws std::logic_error if the handle was moved from and the container
+ * is not default constructible.
+ */
+template <typename T>
+auto cow<T>::write() -> value_type & {
+  if (!block_) {
+    if constexpr (std::is_default_constructible_v<T>) {
+      cow{}.swap(*this);
+    } else {
+      throw std::logic_error("cow::write() - moved from handle");
+    }
+  } else if (!unique()) {
+    cow{std::in_place, block_->value}.swap(*this);
+  }
+
+  return block_->value;
+}
+
+// COW SHARING
+
+/**
+ * @brief Returns the number of handles sharing the container.
+ *
+ * @return size_type - the number of handles, this one included.
+ */
+template <typename T>
+auto cow<T>::use_count() const noexcept -> size_type {
+  return block_ ? block_->refs.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * @brief Checks whether the handle owns its container alone.
+ *
+ * @return bool - true if no other handle shares the container.
+ */
+template <typename T>
+bool cow<T>::unique() const noexcept {
+  return use_count() == 1;
+}
+
+/**
+ * @brief Swaps the containers of two handles.
+ *
+ * @param[in] other The handle to swap with.
+ */
+template <typename T>
+void cow<T>::swap(cow &other) noexcept {
+  std::swap(block_, other.block_);
+}
+
+// COW PRIVATE ACCESS
+
+/**
+ * @brief Returns the container held by the handle.
+ *
+ * @details
+ * A moved from handle holds none, and reads a static empty container instead
+ * when the type is default constructible.
+ *
+ * @return const value_type& - the shared container.
+ */
+template <typename T>
+auto cow<T>::shared() const noexcept -> const value_type & {
+  if constexpr (std::is_default_constructible_v<T>) {
+    if (!block_) {
+      static const value_type empty{};
+
+      return empty;
+    }
+  }
+
+  return block_->value;
+}
\ No newline at end of file
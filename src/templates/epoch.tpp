@@ -0,0 +1,260 @@
+/**
+ * @file epoch.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the epoch-based memory reclamation.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/epoch.h"
+
+using namespace s21;
+
+// EPOCH DOMAIN DESTRUCTOR
+
+/**
+ * @brief Destructor. Deletes every node still pending and the records.
+ *
+ * @details
+ * Runs at program exit, after the threads have left their nodes to the
+ * domain.
+ */
+inline epoch_domain::~epoch_domain() {
+  for (size_type i = 0; i < orphans_.size(); ++i) {
+    orphans_[i].deleter(orphans_[i].ptr);
+  }
+
+  for (Record *record = records_.load(); record;) {
+    delete std::exchange(record, record->next);
+  }
+}
+
+// EPOCH DOMAIN ACCESS
+
+/**
+ * @brief Returns the domain shared by all containers.
+ *
+ * @return epoch_domain& - the domain of the program.
+ */
+inline auto epoch_domain::instance() -> epoch_domain & {
+  static epoch_domain domain;
+
+  return domain;
+}
+
+// EPOCH DOMAIN RECLAMATION
+
+/**
+ * @brief Hands an unlinked node over for deletion.
+ *
+ * @details
+ * The node must no longer be reachable from any container: only threads
+ * already inside a guard may still read it. Every kCOLLECT_EVERY retirements
+ * of a thread trigger a collect().
+ *
+ * @param[in] ptr The unlinked node.
+ * @param[in] deleter The function deleting the node.
+ */
+inline void epoch_domain::retire(void *ptr, deleter_type deleter) {
+  Local &state = local();
+
+  state.retired.push_back({ptr, deleter, epoch_.load()});
+
+  if (state.retired.size() % kCOLLECT_EVERY == 0) {
+    collect();
+  }
+}
+
+/**
+ * @brief Advances the epoch if possible and deletes the nodes now safe.
+ *
+ * @details
+ * Deletes the nodes retired by the calling thread, and those left by exited
+ * threads unless another thread is deleting them, two epochs after their
+ * retirement.
+ */
+inline void epoch_domain::collect() {
+  tryAdvance();
+
+  std::uint64_t epoch = epoch_.load();
+
+  reclaim(local().retired, epoch);
+
+  std::unique_lock lock{orphans_mutex_, std::try_to_lock};
+
+  if (lock) {
+    reclaim(orphans_, epoch);
+  }
+}
+
+/**
+ * @brief Returns the number of nodes waiting for their deletion.
+ *
+ * @return size_type - the nodes retired by the calling thread and left by
+ * exited threads.
+ */
+inline auto epoch_domain::pending() const -> size_type {
+  std::lock_guard lock{orphans_mutex_};
+
+  return local().retired.size() + orphans_.size();
+}
+
+// EPOCH DOMAIN HELPERS
+
+/**
+ * @brief Returns the state of the calling thread.
+ *
+ * @return Local& - the state, built on the first call of the thread.
+ */
+inline auto epoch_domain::local() -> Local & {
+  thread_local Local state;
+
+  return state;
+}
+
+/**
+ * @brief Takes a free record or registers a new one.
+ *
+ * @details
+ * Records are never unregistered, so the list only grows to the greatest
+ * number of threads alive at once and is read without locks.
+ *
+ * @return Record* - a record owned by the calling thread.
+ */
+inline auto epoch_domain::acquireRecord() -> Record * {
+  for (Record *record = records_.load(); record; record = record->next) {
+    bool expected = false;
+
+    if (record->taken.compare_exchange_strong(expected, true)) {
+      return record;
+    }
+  }
+
+  Record *record = new Record;
+
+  record->next = records_.load();
+
+  while (!records_.compare_exchange_weak(record->next, record)) {
+  }
+
+  return record;
+}
+
+/**
+ * @brief Advances the global epoch if every thread inside a guard is in it.
+ *
+ * @return bool - true if the epoch advanced, false otherwise.
+ */
+inline bool epoch_domain::tryAdvance() noexcept {
+  std::uint64_t epoch = epoch_.load();
+
+  for (Record *record = records_.load(); record; record = record->next) {
+    std::uint64_t announced = record->epoch.load();
+
+    if (announced != kIDLE && announced != epoch) {
+      return false;
+    }
+  }
+
+  return epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+/**
+ * @brief Deletes the retired nodes no guard can see any more.
+ *
+ * @param[in] retired The nodes to check, replaced by those kept.
+ * @param[in] epoch The current global epoch.
+ */
+inline void epoch_domain::reclaim(vector<Retired> &retired,
+                                  std::uint64_t epoch) {
+  vector<Retired> kept;
+
+  for (size_type i = 0; i < retired.size(); ++i) {
+    if (retired[i].epoch + 2 <= epoch) {
+      retired[i].deleter(retired[i].ptr);
+    } else {
+      kept.push_back(retired[i]);
+    }
+  }
+
+  retired.swap(kept);
+}
+
+// EPOCH DOMAIN LOCAL
+
+/**
+ * @brief Destructor. Leaves the pending nodes and the record of an exiting
+ * thread to the domain.
+ */
+inline epoch_domain::Local::~Local() {
+  epoch_domain &domain = instance();
+
+  if (retired.size()) {
+    std::lock_guard lock{domain.orphans_mutex_};
+
+    for (size_type i = 0; i < retired.size(); ++i) {
+      domain.orphans_.push_back(retired[i]);
+    }
+  }
+
+  if (record) {
+    record->epoch.store(kIDLE);
+    record->taken.store(false);
+  }
+}
+
+// EPOCH GUARD
+
+/**
+ * @brief Enters the current epoch, unless the thread is already inside a
+ * guard.
+ *
+ * @details
+ * The announcement is sequentially consistent, so it is ordered before every
+ * later read of shared nodes: a node unlinked after it cannot be deleted
+ * while the guard lives.
+ */
+inline epoch_guard::epoch_guard() {
+  epoch_domain &domain = epoch_domain::instance();
+  epoch_domain::Local &state = epoch_domain::local();
+
+  if (state.depth++ == 0) {
+    if (!state.record) {
+      state.record = domain.acquireRecord();
+    }
+
+    state.record->epoch.store(domain.epoch_.load());
+  }
+}
+
+/**
+ * @brief Copy constructor. Nests another guard in the same thread.
+ */
+inline epoch_guard::epoch_guard(const epoch_guard &) {
+  ++epoch_domain::local().depth;
+}
+
+/**
+ * @brief Assignment operator. Both guards already protect the thread.
+ *
+ * @return epoch_guard& - a reference to this guard.
+ */
+inline auto epoch_guard::operator=(const epoch_guard &) noexcept
+    -> epoch_guard & {
+  return *this;
+}
+
+/**
+ * @brief Destructor. Leaves the epoch with the last guard of the thread.
+ */
+inline epoch_guard::~epoch_guard() {
+  epoch_domain::Local &state = epoch_domain::local();
+
+  if (--state.depth == 0) {
+    state.record->epoch.store(epoch_domain::kIDLE);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,924 @@
+/**
+ * @file flat_map.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the flat map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_flat_map.h"
+
+using namespace s21;
+
+// FLAT MAP CONSTRUCTORS/ASSIGNMENT OPERATORS
+
+/**
+ * @brief Constructs an empty flat map with a comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C>
+flat_map<K, M, C>::flat_map(const C &comp) : comp_{comp} {}
+
+/**
+ * @brief Constructs a flat map with pairs from an initializer list.
+ *
+ * @details
+ * Of pairs with equivalent keys the first is kept.
+ *
+ * @param[in] items The pairs, in any order.
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C>
+flat_map<K, M, C>::flat_map(std::initializer_list<value_type> const &items,
+                            const C &comp)
+    : comp_{comp} {
+  keys_.reserve(items.size());
+  values_.reserve(items.size());
+  for (const value_type &item : items) {
+    keys_.push_back(item.first);
+    values_.push_back(item.second);
+  }
+  sortPairs();
+}
+
+/**
+ * @brief Constructs a flat map taking over a vector of keys and a vector of
+ * values.
+ *
+ * @details
+ * The pairs are sorted once, stably; of pairs with equivalent keys the first
+ * is kept.
+ *
+ * @param[in] keys The keys, in any order.
+ * @param[in] values The values, values[i] belonging to keys[i].
+ * @param[in] comp The comparator ordering the keys.
+ * @throws std::invalid_argument if the vectors differ in size.
+ */
+template <typename K, typename M, typename C>
+flat_map<K, M, C>::flat_map(key_container_type keys,
+                            mapped_container_type values, const C &comp)
+    : keys_{std::move(keys)}, values_{std::move(values)}, comp_{comp} {
+  checkSizes();
+  sortPairs();
+}
+
+/**
+ * @brief Constructs a flat map taking over vectors of sorted keys and their
+ * values.
+ *
+ * @details
+ * The keys are neither sorted nor checked: they must be sorted by comp,
+ * without equivalent keys.
+ *
+ * @param[in] keys The sorted keys.
+ * @param[in] values The values, values[i] belonging to keys[i].
+ * @param[in] comp The comparator ordering the keys.
+ * @throws std::invalid_argument if the vectors differ in size.
+ */
+template <typename K, typename M, typename C>
+flat_map<K, M, C>::flat_map(sorted_unique_t, key_container_type keys,
+                            mapped_container_type values, const C &comp)
+    : keys_{std::move(keys)}, values_{std::move(values)}, comp_{comp} {
+  checkSizes();
+}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param[in] other The flat map to copy.
+ * @return flat_map& - reference to the assigned flat map.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::operator=(const flat_map &other) -> flat_map & {
+  if (this != &other) {
+    keys_ = key_container_type(other.keys_);
+    values_ = mapped_container_type(other.values_);
+    comp_ = other.comp_;
+  }
+  return *this;
+}
+
+// FLAT MAP ELEMENT ACCESS
+
+/**
+ * @brief Accesses the value of a key.
+ *
+ * @param[in] key The key of the value.
+ * @return mapped_type& - the value.
+ * @throws std::out_of_range if the key is missing.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::at(const key_type &key) -> mapped_type & {
+  size_type index = findIndex(key);
+
+  if (index == size()) {
+    throw std::out_of_range("flat_map::at() - missing element");
+  }
+  return values_[index];
+}
+
+/**
+ * @brief Accesses the value of a key.
+ *
+ * @param[in] key The key of the value.
+ * @return const mapped_type& - the value.
+ * @throws std::out_of_range if the key is missing.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::at(const key_type &key) const -> const mapped_type & {
+  size_type index = findIndex(key);
+
+  if (index == size()) {
+    throw std::out_of_range("flat_map::at() - missing element");
+  }
+  return values_[index];
+}
+
+/**
+ * @brief Accesses the value of a key, inserting a value-initialized one if
+ * the key is missing.
+ *
+ * @param[in] key The key of the value.
+ * @return mapped_type& - the value.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::operator[](const key_type &key) -> mapped_type & {
+  return (*tryInsert(key).first).second;
+}
+
+/**
+ * @brief Accesses the value of a key, inserting a value-initialized one if
+ * the key is missing.
+ *
+ * @param[in] key The key of the value, moved in if inserted.
+ * @return mapped_type& - the value.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::operator[](key_type &&key) -> mapped_type & {
+  return (*tryInsert(std::move(key)).first).second;
+}
+
+// FLAT MAP ITERATORS
+
+/// @brief Returns an iterator to the first element.
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::begin() noexcept -> iterator {
+  return iteratorAt(0);
+}
+
+/// @brief Returns an iterator past the last element.
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::end() noexcept -> iterator {
+  return iteratorAt(size());
+}
+
+/// @brief Returns a const iterator to the first element.
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::begin() const noexcept -> const_iterator {
+  return iteratorAt(0);
+}
+
+/// @brief Returns a const iterator past the last element.
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::end() const noexcept -> const_iterator {
+  return iteratorAt(size());
+}
+
+/// @brief Returns a const iterator to the first element.
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::cbegin() const noexcept -> const_iterator {
+  return begin();
+}
+
+/// @brief Returns a const iterator past the last element.
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::cend() const noexcept -> const_iterator {
+  return end();
+}
+
+// FLAT MAP CAPACITY
+
+/**
+ * @brief Checks whether the flat map is empty.
+ *
+ * @return bool - true if the flat map is empty, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool flat_map<K, M, C>::empty() const noexcept {
+  return keys_.empty();
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::size() const noexcept -> size_type {
+  return keys_.size();
+}
+
+/**
+ * @brief Returns the maximum number of elements.
+ *
+ * @return size_type - the maximum number of elements.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::max_size() const noexcept -> size_type {
+  return std::min(keys_.max_size(), values_.max_size());
+}
+
+/**
+ * @brief Makes room for at least size elements in both vectors.
+ *
+ * @param[in] size The number of elements to make room for.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::reserve(size_type size) {
+  keys_.reserve(size);
+  values_.reserve(size);
+}
+
+// FLAT MAP MODIFIERS
+
+/**
+ * @brief Erases all elements.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::clear() noexcept {
+  keys_.clear();
+  values_.clear();
+}
+
+/**
+ * @brief Inserts a copy of a pair unless its key is present.
+ *
+ * @param[in] value The pair to copy.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::insert(const value_type &value) -> iterator_bool {
+  return tryInsert(value.first, value.second);
+}
+
+/**
+ * @brief Inserts a pair by moving it unless its key is present.
+ *
+ * @param[in] value The pair to move.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::insert(value_type &&value) -> iterator_bool {
+  return tryInsert(std::move(value.first), std::move(value.second));
+}
+
+/**
+ * @brief Inserts a key and a value unless the key is present.
+ *
+ * @param[in] key The key to copy.
+ * @param[in] obj The value to copy.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::insert(const key_type &key, const mapped_type &obj)
+    -> iterator_bool {
+  return tryInsert(key, obj);
+}
+
+/**
+ * @brief Inserts a key and a value, or assigns the value if the key is
+ * present.
+ *
+ * @param[in] key The key to copy.
+ * @param[in] obj The value to copy.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::insert_or_assign(const key_type &key,
+                                         const mapped_type &obj)
+    -> iterator_bool {
+  size_type index = findIndex(key);
+
+  if (index == size()) {
+    return tryInsert(key, obj);
+  }
+  values_[index] = obj;
+  return {iteratorAt(index), false};
+}
+
+/**
+ * @brief Erases the element at pos.
+ *
+ * @param[in] pos The position of the element, dereferenceable.
+ * @return iterator - following the erased element.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::erase(const_iterator pos) -> iterator {
+  return erase(pos, pos + 1);
+}
+
+/**
+ * @brief Erases the elements in [first, last), shifting the tail once.
+ *
+ * @param[in] first The first element to erase.
+ * @param[in] last The element past the last one to erase.
+ * @return iterator - following the erased elements.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::erase(const_iterator first, const_iterator last)
+    -> iterator {
+  difference_type index = first - cbegin();
+  difference_type stop = last - cbegin();
+
+  keys_.erase(keys_.begin() + index, keys_.begin() + stop);
+  values_.erase(values_.begin() + index, values_.begin() + stop);
+  return iteratorAt(index);
+}
+
+/**
+ * @brief Erases the element with a key.
+ *
+ * @param[in] key The key to erase.
+ * @return size_type - the number of erased elements, 0 or 1.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::erase(const key_type &key) -> size_type {
+  size_type index = findIndex(key);
+
+  if (index == size()) {
+    return 0;
+  }
+  erase(iteratorAt(index));
+  return 1;
+}
+
+/**
+ * @brief Swaps the elements and comparators with other.
+ *
+ * @param[in] other The flat map to swap with.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::swap(flat_map &other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+  std::swap(comp_, other.comp_);
+}
+
+/**
+ * @brief Moves the elements of other with missing keys into the flat map.
+ *
+ * @details
+ * They are merged in at once; the elements with keys already present stay
+ * in other. Merging a flat map into itself does nothing.
+ *
+ * @param[in] other The flat map to take the elements of.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::merge(flat_map &other) {
+  if (&other == this) {
+    return;
+  }
+
+  size_type old = size();
+  flat_map kept(other.comp_);
+
+  for (size_type i = 0; i < other.size(); ++i) {
+    K &key = other.keys_[i];
+    bool present =
+        std::binary_search(keys_.data(), keys_.data() + old, key, comp_);
+    flat_map &dest = present ? kept : *this;
+
+    dest.keys_.push_back(std::move(key));
+    dest.values_.push_back(std::move(other.values_[i]));
+  }
+  mergeTail(old);
+  other = std::move(kept);
+}
+
+/**
+ * @brief Constructs a pair in place and inserts it unless its key is
+ * present.
+ *
+ * @tparam Args The types of the constructor arguments of value_type.
+ * @param args The constructor arguments.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+template <typename... Args>
+auto flat_map<K, M, C>::emplace(Args &&...args) -> iterator_bool {
+  value_type pair(std::forward<Args>(args)...);
+
+  return tryInsert(std::move(pair.first), std::move(pair.second));
+}
+
+/**
+ * @brief Inserts a key with a value constructed in place, unless the key is
+ * present; then args are not touched.
+ *
+ * @tparam Args The types of the constructor arguments of the value.
+ * @param[in] key The key to copy.
+ * @param args The constructor arguments of the value.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+template <typename... Args>
+auto flat_map<K, M, C>::try_emplace(const key_type &key, Args &&...args)
+    -> iterator_bool {
+  return tryInsert(key, std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Inserts a key with a value constructed in place, unless the key is
+ * present; then neither key nor args are touched.
+ *
+ * @tparam Args The types of the constructor arguments of the value.
+ * @param[in] key The key to move.
+ * @param args The constructor arguments of the value.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+template <typename... Args>
+auto flat_map<K, M, C>::try_emplace(key_type &&key, Args &&...args)
+    -> iterator_bool {
+  return tryInsert(std::move(key), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Inserts one pair per argument in a single merge.
+ *
+ * @details
+ * The pairs are appended, sorted and merged in at once: O(n + m log m) for m
+ * pairs instead of m shifts of the tail. The result is the one m insert()
+ * calls would give, in the order of the arguments.
+ *
+ * @tparam Args The types of the arguments, each convertible to value_type.
+ * @param args The arguments, one per pair.
+ * @return vector<iterator_bool> - for each argument, the element with its key
+ * and whether it was inserted.
+ */
+template <typename K, typename M, typename C>
+template <typename... Args>
+auto flat_map<K, M, C>::insert_many(Args &&...args) -> vector<iterator_bool> {
+  size_type old = size();
+
+  try {
+    (appendPair(value_type(std::forward<Args>(args))), ...);
+  } catch (...) {
+    truncate(old);
+    throw;
+  }
+  return mergeTail(old);
+}
+
+/**
+ * @brief Inserts the pairs of a range in a single merge (see insert_many()).
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @return vector<iterator_bool> - for each pair of the range, the element
+ * with its key and whether it was inserted.
+ */
+template <typename K, typename M, typename C>
+template <typename InputIt>
+auto flat_map<K, M, C>::insert_range(InputIt first, InputIt last)
+    -> vector<iterator_bool> {
+  size_type old = size();
+
+  try {
+    for (; first != last; ++first) {
+      appendPair(value_type(*first));
+    }
+  } catch (...) {
+    truncate(old);
+    throw;
+  }
+  return mergeTail(old);
+}
+
+// FLAT MAP STORAGE
+
+/**
+ * @brief Returns the sorted keys.
+ *
+ * @return const key_container_type& - the keys.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::keys() const noexcept -> const key_container_type & {
+  return keys_;
+}
+
+/**
+ * @brief Returns the values, in the order of the keys.
+ *
+ * @return const mapped_container_type& - the values.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::values() const noexcept
+    -> const mapped_container_type & {
+  return values_;
+}
+
+/**
+ * @brief Takes the keys and the values out, leaving the flat map empty.
+ *
+ * @return containers - the sorted keys and their values.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::extract() && -> containers {
+  containers result{std::move(keys_), std::move(values_)};
+
+  clear();
+  return result;
+}
+
+/**
+ * @brief Replaces the elements with vectors of sorted keys and their values.
+ *
+ * @details
+ * As for the sorted_unique constructor, the keys are not checked.
+ *
+ * @param[in] keys The sorted keys.
+ * @param[in] values The values, values[i] belonging to keys[i].
+ * @throws std::invalid_argument if the vectors differ in size.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::replace(key_container_type keys,
+                                mapped_container_type values) {
+  if (keys.size() != values.size()) {
+    throw std::invalid_argument(
+        "flat_map::replace() - keys and values differ in size");
+  }
+  keys_ = std::move(keys);
+  values_ = std::move(values);
+}
+
+// FLAT MAP LOOKUP
+
+/**
+ * @brief Finds the element with a key by binary search.
+ *
+ * @param[in] key The key to find.
+ * @return iterator - to the element, or end() if none.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::find(const key_type &key) -> iterator {
+  return iteratorAt(findIndex(key));
+}
+
+/**
+ * @brief Finds the element with a key by binary search.
+ *
+ * @param[in] key The key to find.
+ * @return const_iterator - to the element, or end() if none.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::find(const key_type &key) const -> const_iterator {
+  return iteratorAt(findIndex(key));
+}
+
+/**
+ * @brief Counts the elements with a key.
+ *
+ * @param[in] key The key to count.
+ * @return size_type - 1 if the key is present, 0 otherwise.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::count(const key_type &key) const -> size_type {
+  return contains(key) ? 1 : 0;
+}
+
+/**
+ * @brief Checks whether a key is present.
+ *
+ * @param[in] key The key to look for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool flat_map<K, M, C>::contains(const key_type &key) const {
+  return findIndex(key) != size();
+}
+
+/**
+ * @brief Returns the first element whose key is not ordered before key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - to the element, or end().
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::lower_bound(const key_type &key) -> iterator {
+  return iteratorAt(lowerIndex(key));
+}
+
+/**
+ * @brief Returns the first element whose key is not ordered before key.
+ *
+ * @param[in] key The key to compare with.
+ * @return const_iterator - to the element, or end().
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::lower_bound(const key_type &key) const
+    -> const_iterator {
+  return iteratorAt(lowerIndex(key));
+}
+
+/**
+ * @brief Returns the first element whose key is ordered after key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - to the element, or end().
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::upper_bound(const key_type &key) -> iterator {
+  return iteratorAt(upperIndex(key));
+}
+
+/**
+ * @brief Returns the first element whose key is ordered after key.
+ *
+ * @param[in] key The key to compare with.
+ * @return const_iterator - to the element, or end().
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::upper_bound(const key_type &key) const
+    -> const_iterator {
+  return iteratorAt(upperIndex(key));
+}
+
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return key_compare - a copy of the comparator.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::key_comp() const -> key_compare {
+  return comp_;
+}
+
+// FLAT MAP POSITIONS
+
+/**
+ * @brief Returns the index of the first key not ordered before key.
+ *
+ * @param[in] key The key to compare with.
+ * @return size_type - the index, size() if every key is less.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::lowerIndex(const key_type &key) const -> size_type {
+  const K *first = keys_.data();
+
+  return std::lower_bound(first, first + size(), key, comp_) - first;
+}
+
+/**
+ * @brief Returns the index of the first key ordered after key.
+ *
+ * @param[in] key The key to compare with.
+ * @return size_type - the index, size() if no key is greater.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::upperIndex(const key_type &key) const -> size_type {
+  const K *first = keys_.data();
+
+  return std::upper_bound(first, first + size(), key, comp_) - first;
+}
+
+/**
+ * @brief Returns the index of a key.
+ *
+ * @param[in] key The key to find.
+ * @return size_type - the index, size() if the key is missing.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::findIndex(const key_type &key) const -> size_type {
+  size_type index = lowerIndex(key);
+
+  return (index != size() && !comp_(key, keys_[index])) ? index : size();
+}
+
+/**
+ * @brief Returns an iterator to the element at an index.
+ *
+ * @param[in] index The index, at most size().
+ * @return iterator - to the element.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::iteratorAt(size_type index) noexcept -> iterator {
+  return iterator(keys_.data() + index, values_.data() + index);
+}
+
+/**
+ * @brief Returns a const iterator to the element at an index.
+ *
+ * @param[in] index The index, at most size().
+ * @return const_iterator - to the element.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::iteratorAt(size_type index) const noexcept
+    -> const_iterator {
+  return const_iterator(keys_.data() + index, values_.data() + index);
+}
+
+// FLAT MAP INSERTION
+
+/**
+ * @brief Inserts a key and a value built from args unless the key is
+ * present.
+ *
+ * @details
+ * The key goes in first; if building the value throws it is taken out again,
+ * leaving the flat map unchanged.
+ *
+ * @tparam Key The type of the key argument.
+ * @tparam Args The types of the constructor arguments of the value.
+ * @param[in] key The key to insert.
+ * @param args The constructor arguments of the value.
+ * @return iterator_bool - the element with the key, and whether it was
+ * inserted.
+ */
+template <typename K, typename M, typename C>
+template <typename Key, typename... Args>
+auto flat_map<K, M, C>::tryInsert(Key &&key, Args &&...args)
+    -> iterator_bool {
+  size_type index = lowerIndex(key);
+
+  if (index != size() && !comp_(key, keys_[index])) {
+    return {iteratorAt(index), false};
+  }
+  keys_.emplace(keys_.cbegin() + index, std::forward<Key>(key));
+  try {
+    values_.emplace(values_.cbegin() + index, std::forward<Args>(args)...);
+  } catch (...) {
+    keys_.erase(keys_.begin() + index, keys_.begin() + index + 1);
+    throw;
+  }
+  return {iteratorAt(index), true};
+}
+
+/**
+ * @brief Appends a pair at the end of the vectors, out of order.
+ *
+ * @param[in] pair The pair to move.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::appendPair(value_type &&pair) {
+  keys_.push_back(std::move(pair.first));
+  values_.push_back(std::move(pair.second));
+}
+
+/**
+ * @brief Erases the elements from an index on, in both vectors.
+ *
+ * @param[in] size The number of elements to keep.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::truncate(size_type size) {
+  keys_.erase(keys_.begin() + size, keys_.end());
+  values_.erase(values_.begin() + size, values_.end());
+}
+
+// FLAT MAP BATCHES
+
+/**
+ * @brief Checks that every key has a value.
+ *
+ * @throws std::invalid_argument if the vectors differ in size.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::checkSizes() const {
+  if (keys_.size() != values_.size()) {
+    throw std::invalid_argument(
+        "flat_map::flat_map() - keys and values differ in size");
+  }
+}
+
+/**
+ * @brief Sorts the pairs stably by key and drops the later duplicates.
+ *
+ * @details
+ * The indices are sorted and the pairs moved to new vectors in their order.
+ */
+template <typename K, typename M, typename C>
+void flat_map<K, M, C>::sortPairs() {
+  size_type count = size();
+  vector<size_type> order(count);
+  key_container_type keys;
+  mapped_container_type values;
+
+  std::iota(order.data(), order.data() + count, size_type(0));
+  std::stable_sort(order.data(), order.data() + count,
+                   [this](size_type a, size_type b) {
+                     return comp_(keys_[a], keys_[b]);
+                   });
+  keys.reserve(count);
+  values.reserve(count);
+  for (size_type i = 0; i < count; ++i) {
+    size_type from = order[i];
+
+    if (keys.empty() || comp_(keys.back(), keys_[from])) {
+      keys.push_back(std::move(keys_[from]));
+      values.push_back(std::move(values_[from]));
+    }
+  }
+  keys_ = std::move(keys);
+  values_ = std::move(values);
+}
+
+/**
+ * @brief Merges the pairs appended after the first old ones into place.
+ *
+ * @details
+ * The appended pairs are ordered by a stable sort of their indices, so the
+ * earlier of two with equivalent keys wins, and dropped if their key is
+ * already present. This pass only compares keys and gives the final position
+ * of every appended pair: its rank among the old keys plus the number of kept
+ * pairs before it. The kept ones and the old pairs are then moved into new
+ * vectors, reserved beforehand. If anything throws before the moves the
+ * appended pairs are dropped and the old ones kept; if a move throws the
+ * flat map is cleared.
+ *
+ * @param[in] old The number of sorted pairs before the appended ones.
+ * @return vector<iterator_bool> - for each appended pair, in order, the
+ * element with its key and whether it was kept.
+ */
+template <typename K, typename M, typename C>
+auto flat_map<K, M, C>::mergeTail(size_type old) -> vector<iterator_bool> {
+  size_type added = size() - old;
+  vector<std::pair<size_type, bool>> placed;
+  vector<iterator_bool> results;
+  bool moving = false;
+
+  try {
+    K *tail = keys_.data() + old;
+    vector<size_type> order(added);
+    vector<std::pair<size_type, size_type>> kept;
+    key_container_type keys;
+    mapped_container_type values;
+    size_type rank = 0;
+    size_type next = 0;
+
+    std::iota(order.data(), order.data() + added, size_type(0));
+    std::stable_sort(order.data(), order.data() + added,
+                     [&](size_type a, size_type b) {
+                       return comp_(tail[a], tail[b]);
+                     });
+    placed = vector<std::pair<size_type, bool>>(added);
+    kept.reserve(added);
+    for (size_type i = 0; i < added; ++i) {
+      const K &key = tail[order[i]];
+
+      rank = std::lower_bound(keys_.data() + rank, tail, key, comp_) -
+             keys_.data();
+      if (rank != old && !comp_(key, keys_[rank])) {
+        placed[order[i]] = {rank + kept.size(), false};
+      } else if (!kept.empty() && !comp_(tail[kept.back().second], key)) {
+        placed[order[i]] = {rank + kept.size() - 1, false};
+      } else {
+        placed[order[i]] = {rank + kept.size(), true};
+        kept.push_back({rank, order[i]});
+      }
+    }
+    keys.reserve(old + kept.size());
+    values.reserve(old + kept.size());
+    results.reserve(added);
+    moving = true;
+    for (const auto &[before, from] : kept) {
+      for (; next < before; ++next) {
+        keys.push_back(std::move(keys_[next]));
+        values.push_back(std::move(values_[next]));
+      }
+      keys.push_back(std::move(tail[from]));
+      values.push_back(std::move(values_[old + from]));
+    }
+    for (; next < old; ++next) {
+      keys.push_back(std::move(keys_[next]));
+      values.push_back(std::move(values_[next]));
+    }
+    keys_ = std::move(keys);
+    values_ = std::move(values);
+  } catch (...) {
+    if (moving) {
+      clear();
+    } else {
+      truncate(old);
+    }
+    throw;
+  }
+
+  for (size_type i = 0; i < added; ++i) {
+    results.push_back({iteratorAt(placed[i].first), placed[i].second});
+  }
+  return results;
+}
\ No newline at end of file
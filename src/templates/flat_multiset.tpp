@@ -0,0 +1,72 @@
+/**
+ * @file flat_multiset.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the flat multiset container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_flat_multiset.h"
+
+using namespace s21;
+
+// FLAT MULTISET MODIFIERS
+
+/**
+ * @brief Inserts a copy of a key after its equivalents.
+ *
+ * @param[in] value The key to copy.
+ * @return iterator - to the inserted key.
+ */
+template <typename K, typename C>
+auto flat_multiset<K, C>::insert(const value_type &value) -> iterator {
+  return base::insert(value).first;
+}
+
+/**
+ * @brief Inserts a key after its equivalents by moving it.
+ *
+ * @param[in] value The key to move.
+ * @return iterator - to the inserted key.
+ */
+template <typename K, typename C>
+auto flat_multiset<K, C>::insert(value_type &&value) -> iterator {
+  return base::insert(std::move(value)).first;
+}
+
+/**
+ * @brief Constructs a key in place and inserts it after its equivalents.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param args The constructor arguments.
+ * @return iterator - to the inserted key.
+ */
+template <typename K, typename C>
+template <typename... Args>
+auto flat_multiset<K, C>::emplace(Args &&...args) -> iterator {
+  return base::emplace(std::forward<Args>(args)...).first;
+}
+
+/**
+ * @brief Swaps the keys and comparators with other.
+ *
+ * @param[in] other The flat multiset to swap with.
+ */
+template <typename K, typename C>
+void flat_multiset<K, C>::swap(flat_multiset &other) {
+  base::swap(other);
+}
+
+/**
+ * @brief Moves all keys of other into the flat multiset in one merge.
+ *
+ * @param[in] other The flat multiset to take the keys of.
+ */
+template <typename K, typename C>
+void flat_multiset<K, C>::merge(flat_multiset &other) {
+  base::merge(other);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+/**
+ * @file flat_set.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the flat set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_flat_set.h"
+
+using namespace s21;
+
+// FLAT SET MODIFIERS
+
+/**
+ * @brief Swaps the keys and comparators with other.
+ *
+ * @param[in] other The flat set to swap with.
+ */
+template <typename K, typename C>
+void flat_set<K, C>::swap(flat_set &other) {
+  base::swap(other);
+}
+
+/**
+ * @brief Moves the keys of other missing from the flat set into it.
+ *
+ * @details
+ * The keys are merged in at once; the ones already present stay in other.
+ *
+ * @param[in] other The flat set to take the keys of.
+ */
+template <typename K, typename C>
+void flat_set<K, C>::merge(flat_set &other) {
+  base::merge(other);
+}
\ No newline at end of file
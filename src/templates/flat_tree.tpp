@@ -0,0 +1,561 @@
+/**
+ * @file flat_tree.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the sorted array behind flat_set and flat_multiset.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/flat_tree.h"
+
+using namespace s21;
+
+// FLAT TREE CONSTRUCTORS/ASSIGNMENT OPERATORS
+
+/**
+ * @brief Constructs an empty flat tree with a comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool Unique>
+flat_tree<K, C, Unique>::flat_tree(const C &comp) : comp_{comp} {}
+
+/**
+ * @brief Constructs a flat tree with keys from an initializer list.
+ *
+ * @param[in] items The keys, in any order.
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool Unique>
+flat_tree<K, C, Unique>::flat_tree(
+    std::initializer_list<value_type> const &items, const C &comp)
+    : keys_{items}, comp_{comp} {
+  sortKeys();
+}
+
+/**
+ * @brief Constructs a flat tree taking over a vector of keys.
+ *
+ * @details
+ * The keys are sorted once, stably; with Unique the first of equivalent keys
+ * is kept.
+ *
+ * @param[in] keys The keys, in any order.
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool Unique>
+flat_tree<K, C, Unique>::flat_tree(container_type keys, const C &comp)
+    : keys_{std::move(keys)}, comp_{comp} {
+  sortKeys();
+}
+
+/**
+ * @brief Constructs a flat tree taking over a vector of sorted keys.
+ *
+ * @details
+ * The keys are neither sorted nor checked: they must be sorted by comp, and
+ * without equivalent keys with Unique.
+ *
+ * @param[in] keys The sorted keys.
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool Unique>
+flat_tree<K, C, Unique>::flat_tree(sorted_tag, container_type keys,
+                                   const C &comp)
+    : keys_{std::move(keys)}, comp_{comp} {}
+
+/**
+ * @brief Copy assignment operator.
+ *
+ * @param[in] other The flat tree to copy.
+ * @return flat_tree& - reference to the assigned flat tree.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::operator=(const flat_tree &other)
+    -> flat_tree & {
+  if (this != &other) {
+    keys_ = container_type(other.keys_);
+    comp_ = other.comp_;
+  }
+  return *this;
+}
+
+// FLAT TREE ITERATORS
+
+/// @brief Returns an iterator to the first key.
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::begin() const noexcept -> iterator {
+  return keys_.data();
+}
+
+/// @brief Returns an iterator past the last key.
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::end() const noexcept -> iterator {
+  return keys_.data() + keys_.size();
+}
+
+/// @brief Returns a const iterator to the first key.
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::cbegin() const noexcept -> const_iterator {
+  return begin();
+}
+
+/// @brief Returns a const iterator past the last key.
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::cend() const noexcept -> const_iterator {
+  return end();
+}
+
+// FLAT TREE CAPACITY
+
+/**
+ * @brief Checks whether the flat tree is empty.
+ *
+ * @return bool - true if the flat tree is empty, false otherwise.
+ */
+template <typename K, typename C, bool Unique>
+bool flat_tree<K, C, Unique>::empty() const noexcept {
+  return keys_.empty();
+}
+
+/**
+ * @brief Returns the number of keys.
+ *
+ * @return size_type - the number of keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::size() const noexcept -> size_type {
+  return keys_.size();
+}
+
+/**
+ * @brief Returns the maximum number of keys.
+ *
+ * @return size_type - the maximum number of keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::max_size() const noexcept -> size_type {
+  return keys_.max_size();
+}
+
+/**
+ * @brief Makes room for at least size keys.
+ *
+ * @param[in] size The number of keys to make room for.
+ */
+template <typename K, typename C, bool Unique>
+void flat_tree<K, C, Unique>::reserve(size_type size) {
+  keys_.reserve(size);
+}
+
+// FLAT TREE MODIFIERS
+
+/**
+ * @brief Erases all keys.
+ */
+template <typename K, typename C, bool Unique>
+void flat_tree<K, C, Unique>::clear() noexcept {
+  keys_.clear();
+}
+
+/**
+ * @brief Inserts a copy of a key at its place.
+ *
+ * @details
+ * With Unique nothing is inserted if an equivalent key is present; otherwise
+ * the key goes after its equivalents. The keys after it shift by one.
+ *
+ * @param[in] value The key to copy.
+ * @return iterator_bool - the key or its equivalent, and whether it was
+ * inserted.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::insert(const value_type &value)
+    -> iterator_bool {
+  return emplace(value);
+}
+
+/**
+ * @brief Inserts a key at its place by moving it.
+ *
+ * @param[in] value The key to move.
+ * @return iterator_bool - the key or its equivalent, and whether it was
+ * inserted.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::insert(value_type &&value) -> iterator_bool {
+  return emplace(std::move(value));
+}
+
+/**
+ * @brief Erases the key at pos.
+ *
+ * @param[in] pos The position of the key, dereferenceable.
+ * @return iterator - following the erased key.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::erase(const_iterator pos) -> iterator {
+  return erase(pos, pos + 1);
+}
+
+/**
+ * @brief Erases the keys in [first, last), shifting the tail once.
+ *
+ * @param[in] first The first key to erase.
+ * @param[in] last The key past the last one to erase.
+ * @return iterator - following the erased keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::erase(const_iterator first, const_iterator last)
+    -> iterator {
+  difference_type index = first - begin();
+
+  keys_.erase(keys_.begin() + index, keys_.begin() + (last - begin()));
+  return begin() + index;
+}
+
+/**
+ * @brief Erases the keys equivalent to key.
+ *
+ * @param[in] key The key to erase.
+ * @return size_type - the number of erased keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::erase(const key_type &key) -> size_type {
+  auto [first, last] = equal_range(key);
+  size_type erased = last - first;
+
+  erase(first, last);
+  return erased;
+}
+
+/**
+ * @brief Swaps the keys and comparators with other.
+ *
+ * @param[in] other The flat tree to swap with.
+ */
+template <typename K, typename C, bool Unique>
+void flat_tree<K, C, Unique>::swap(flat_tree &other) {
+  keys_.swap(other.keys_);
+  std::swap(comp_, other.comp_);
+}
+
+/**
+ * @brief Moves the keys of other into the flat tree in one merge.
+ *
+ * @details
+ * With Unique the keys equivalent to a present one stay in other. Merging
+ * a flat tree into itself does nothing.
+ *
+ * @param[in] other The flat tree to take the keys of.
+ */
+template <typename K, typename C, bool Unique>
+void flat_tree<K, C, Unique>::merge(flat_tree &other) {
+  if (&other == this) {
+    return;
+  }
+
+  size_type old = keys_.size();
+  container_type kept;
+
+  for (K &key : other.keys_) {
+    if (Unique &&
+        std::binary_search(keys_.data(), keys_.data() + old, key, comp_)) {
+      kept.push_back(std::move(key));
+    } else {
+      keys_.push_back(std::move(key));
+    }
+  }
+  std::inplace_merge(keys_.data(), keys_.data() + old,
+                     keys_.data() + keys_.size(), comp_);
+  other.keys_ = std::move(kept);
+}
+
+/**
+ * @brief Constructs a key in place and inserts it at its place.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param args The constructor arguments.
+ * @return iterator_bool - the key or its equivalent, and whether it was
+ * inserted.
+ */
+template <typename K, typename C, bool Unique>
+template <typename... Args>
+auto flat_tree<K, C, Unique>::emplace(Args &&...args) -> iterator_bool {
+  K key(std::forward<Args>(args)...);
+  iterator pos = Unique ? lower_bound(key) : upper_bound(key);
+  difference_type index = pos - begin();
+
+  if (Unique && pos != end() && !comp_(key, *pos)) {
+    return {pos, false};
+  }
+  keys_.insert(keys_.begin() + index, std::move(key));
+  return {begin() + index, true};
+}
+
+/**
+ * @brief Inserts one key per argument in a single merge.
+ *
+ * @details
+ * The keys are appended, sorted and merged in at once: O(n + m log m) for m
+ * keys instead of m shifts of the tail. The result is the one m insert()
+ * calls would give, in the order of the arguments.
+ *
+ * @tparam Args The types of the arguments.
+ * @param args The arguments, one per key.
+ * @return vector<iterator_bool> - for each argument, its key or the
+ * equivalent key and whether it was inserted.
+ */
+template <typename K, typename C, bool Unique>
+template <typename... Args>
+auto flat_tree<K, C, Unique>::insert_many(Args &&...args)
+    -> vector<iterator_bool> {
+  size_type old = keys_.size();
+
+  keys_.insert_many_back(std::forward<Args>(args)...);
+  return mergeTail(old);
+}
+
+/**
+ * @brief Inserts the keys of a range in a single merge (see insert_many()).
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @return vector<iterator_bool> - for each key of the range, its key or the
+ * equivalent key and whether it was inserted.
+ */
+template <typename K, typename C, bool Unique>
+template <typename InputIt>
+auto flat_tree<K, C, Unique>::insert_range(InputIt first, InputIt last)
+    -> vector<iterator_bool> {
+  size_type old = keys_.size();
+
+  keys_.insert(keys_.end(), first, last);
+  return mergeTail(old);
+}
+
+// FLAT TREE STORAGE
+
+/**
+ * @brief Returns the sorted keys.
+ *
+ * @return const container_type& - the keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::keys() const noexcept -> const container_type & {
+  return keys_;
+}
+
+/**
+ * @brief Takes the sorted keys out, leaving the flat tree empty.
+ *
+ * @return container_type - the keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::extract() && -> container_type {
+  container_type keys = std::move(keys_);
+
+  keys_.clear();
+  return keys;
+}
+
+/**
+ * @brief Replaces the keys with a vector of sorted keys.
+ *
+ * @details
+ * As for the sorted_tag constructor, the keys are not checked.
+ *
+ * @param[in] keys The sorted keys.
+ */
+template <typename K, typename C, bool Unique>
+void flat_tree<K, C, Unique>::replace(container_type keys) {
+  keys_ = std::move(keys);
+}
+
+// FLAT TREE LOOKUP
+
+/**
+ * @brief Finds a key equivalent to key by binary search.
+ *
+ * @param[in] key The key to find.
+ * @return iterator - to the first equivalent key, or end() if none.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::find(const key_type &key) const -> iterator {
+  iterator pos = lower_bound(key);
+
+  return (pos != end() && !comp_(key, *pos)) ? pos : end();
+}
+
+/**
+ * @brief Counts the keys equivalent to key.
+ *
+ * @param[in] key The key to count.
+ * @return size_type - the number of equivalent keys.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::count(const key_type &key) const -> size_type {
+  if constexpr (Unique) {
+    return contains(key) ? 1 : 0;
+  }
+
+  auto [first, last] = equal_range(key);
+
+  return last - first;
+}
+
+/**
+ * @brief Checks whether a key equivalent to key is present.
+ *
+ * @param[in] key The key to look for.
+ * @return bool - true if an equivalent key is present, false otherwise.
+ */
+template <typename K, typename C, bool Unique>
+bool flat_tree<K, C, Unique>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+/**
+ * @brief Returns the range of keys equivalent to key.
+ *
+ * @param[in] key The key to look for.
+ * @return std::pair<iterator, iterator> - the lower and upper bounds.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::equal_range(const key_type &key) const
+    -> std::pair<iterator, iterator> {
+  return std::equal_range(begin(), end(), key, comp_);
+}
+
+/**
+ * @brief Returns the first key not ordered before key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - to the first key not less than key, or end().
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::lower_bound(const key_type &key) const
+    -> iterator {
+  return std::lower_bound(begin(), end(), key, comp_);
+}
+
+/**
+ * @brief Returns the first key ordered after key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - to the first key greater than key, or end().
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::upper_bound(const key_type &key) const
+    -> iterator {
+  return std::upper_bound(begin(), end(), key, comp_);
+}
+
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return key_compare - a copy of the comparator.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::key_comp() const -> key_compare {
+  return comp_;
+}
+
+// FLAT TREE BATCHES
+
+/**
+ * @brief Sorts the keys stably and, with Unique, drops the later duplicates.
+ */
+template <typename K, typename C, bool Unique>
+void flat_tree<K, C, Unique>::sortKeys() {
+  K *first = keys_.data();
+  K *last = first + keys_.size();
+
+  std::stable_sort(first, last, comp_);
+  if constexpr (Unique) {
+    K *kept = std::unique(first, last, [this](const K &a, const K &b) {
+      return !comp_(a, b);
+    });
+
+    keys_.erase(keys_.begin() + (kept - first), keys_.end());
+  }
+}
+
+/**
+ * @brief Merges the keys appended after the first old ones into place.
+ *
+ * @details
+ * The appended keys are ordered by a stable sort of their indices, so the
+ * earlier of two equivalent keys wins with Unique and comes first otherwise.
+ * The kept ones are merged with the old keys by std::inplace_merge(), which
+ * puts old keys before equivalent new ones. The final position of every key
+ * is known before the merge: its rank among the old keys plus the number of
+ * kept keys before it. If anything throws before the merge the appended keys
+ * are dropped and the old ones kept; if the merge itself throws the order is
+ * lost and the flat tree is cleared.
+ *
+ * @param[in] old The number of sorted keys before the appended ones.
+ * @return vector<iterator_bool> - for each appended key, in order, its final
+ * position and whether it was kept.
+ */
+template <typename K, typename C, bool Unique>
+auto flat_tree<K, C, Unique>::mergeTail(size_type old)
+    -> vector<iterator_bool> {
+  size_type added = keys_.size() - old;
+  vector<std::pair<size_type, bool>> placed;
+  vector<iterator_bool> results;
+  bool merging = false;
+
+  try {
+    placed = vector<std::pair<size_type, bool>>(added);
+    results.reserve(added);
+    K *tail = keys_.data() + old;
+    vector<size_type> order(added);
+    container_type fresh;
+
+    std::iota(order.data(), order.data() + added, size_type(0));
+    std::stable_sort(order.data(), order.data() + added,
+                     [&](size_type a, size_type b) {
+                       return comp_(tail[a], tail[b]);
+                     });
+    fresh.reserve(added);
+    for (size_type i = 0; i < added; ++i) {
+      K &key = tail[order[i]];
+      const K *rank = Unique ? std::lower_bound(keys_.data(), tail, key, comp_)
+                             : std::upper_bound(keys_.data(), tail, key, comp_);
+      size_type index = (rank - keys_.data()) + fresh.size();
+
+      if (Unique && rank != tail && !comp_(key, *rank)) {
+        placed[order[i]] = {index, false};
+      } else if (Unique && !fresh.empty() && !comp_(fresh.back(), key)) {
+        placed[order[i]] = {index - 1, false};
+      } else {
+        placed[order[i]] = {index, true};
+        fresh.push_back(std::move(key));
+      }
+    }
+    keys_.erase(keys_.begin() + old, keys_.end());
+    keys_.insert(keys_.end(), std::make_move_iterator(fresh.data()),
+                 std::make_move_iterator(fresh.data() + fresh.size()));
+    merging = true;
+    std::inplace_merge(keys_.data(), keys_.data() + old,
+                       keys_.data() + keys_.size(), comp_);
+  } catch (...) {
+    if (merging) {
+      keys_.clear();
+    } else {
+      keys_.erase(keys_.begin() + old, keys_.end());
+    }
+    throw;
+  }
+
+  for (size_type i = 0; i < added; ++i) {
+    results.push_back({begin() + placed[i].first, placed[i].second});
+  }
+  return results;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+ * @file growth_policy.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the growth policies of vector.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/growth_policy.h"
+
+using namespace s21;
+
+// GROWTH MAPPED STORAGE
+
+/**
+ * @brief Allocates a block, mapping it if it is large.
+ *
+ * @param[in] bytes The size of the block.
+ * @param[in] align The alignment of the block.
+ * @return void* - the block.
+ * @throws std::bad_alloc if the mapping fails.
+ */
+template <typename Base, std::size_t Threshold, bool HugePages>
+void *growth_mapped<Base, Threshold, HugePages>::allocate(std::size_t bytes,
+                                                          std::size_t align) {
+#ifdef __linux__
+  if (mapped(bytes, align)) {
+    void *block = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (block == MAP_FAILED) throw std::bad_alloc();
+    advise(block, bytes);
+    return block;
+  }
+#endif
+  return Base::allocate(bytes, align);
+}
+
+/**
+ * @brief Frees a block from allocate() or remap().
+ *
+ * @param[in] block The block.
+ * @param[in] bytes The size of the block.
+ * @param[in] align The alignment of the block.
+ */
+template <typename Base, std::size_t Threshold, bool HugePages>
+void growth_mapped<Base, Threshold, HugePages>::deallocate(
+    void *block, std::size_t bytes, std::size_t align) noexcept {
+#ifdef __linux__
+  if (mapped(bytes, align)) {
+    munmap(block, bytes);
+    return;
+  }
+#endif
+  Base::deallocate(block, bytes, align);
+}
+
+/**
+ * @brief Resizes a mapped block, moving its pages if needed.
+ *
+ * @details
+ * Only a mapped block can be resized into another mapped block; any other
+ * pair of sizes is left to Base, which normally has the elements copied.
+ * Whether a block is mapped is decided as in allocate(), alignment included,
+ * so a block from Base is never passed to mremap().
+ *
+ * @param[in] block The block.
+ * @param[in] old_bytes The size of the block.
+ * @param[in] new_bytes The new size of the block.
+ * @param[in] align The alignment of the block.
+ * @return void* - the resized block, or nullptr if it must be copied.
+ */
+template <typename Base, std::size_t Threshold, bool HugePages>
+void *growth_mapped<Base, Threshold, HugePages>::remap(
+    void *block, std::size_t old_bytes, std::size_t new_bytes,
+    std::size_t align) noexcept {
+#ifdef __linux__
+  if (mapped(old_bytes, align) && mapped(new_bytes, align)) {
+    void *moved = mremap(block, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (moved == MAP_FAILED) return nullptr;
+    advise(moved, new_bytes);
+    return moved;
+  }
+#endif
+  return Base::remap(block, old_bytes, new_bytes, align);
+}
+
+/**
+ * @brief Tells whether a block of the given size is mapped.
+ *
+ * @param[in] bytes The size of the block.
+ * @param[in] align The alignment of the block.
+ * @return bool - true if the block is mapped, false if it comes from Base.
+ */
+template <typename Base, std::size_t Threshold, bool HugePages>
+bool growth_mapped<Base, Threshold, HugePages>::mapped(
+    std::size_t bytes, std::size_t align) noexcept {
+  return bytes >= Threshold && align <= 4096;
+}
+
+/**
+ * @brief Advises transparent huge pages for a mapping if HugePages is set.
+ *
+ * @details
+ * The advice is a hint: failing to follow it is not an error.
+ *
+ * @param[in] block The mapping.
+ * @param[in] bytes The size of the mapping.
+ */
+template <typename Base, std::size_t Threshold, bool HugePages>
+void growth_mapped<Base, Threshold, HugePages>::advise(
+    void *block, std::size_t bytes) noexcept {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if constexpr (HugePages) madvise(block, bytes, MADV_HUGEPAGE);
+#endif
+  (void)block, (void)bytes;
+}
\ No newline at end of file
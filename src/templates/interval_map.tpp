@@ -0,0 +1,385 @@
+/**
+ * @file interval_map.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the interval map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_interval_map.h"
+
+using namespace s21;
+
+// INTERVAL QUERIES
+
+/**
+ * @brief Calls a function for every interval overlapping [lo, hi).
+ *
+ * @details
+ * A subtree is entered only if its greatest end is after lo, and the
+ * traversal stops at the first interval starting at or after hi. The
+ * intervals are visited in ascending order.
+ *
+ * @tparam Tree The type of the tree, summarized with max_end.
+ * @tparam F The type of the function.
+ * @param[in] tree The tree to search.
+ * @param[in] lo The start of the query range.
+ * @param[in] hi The end of the query range, not included itself.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C>
+template <typename Tree, typename F>
+bool interval_traits<K, C>::overlapping(const Tree &tree, const K &lo,
+                                        const K &hi, F &fn) {
+  C comp{};
+  bool stopped = false;
+
+  tree.for_each_summarized(
+      [&](const K &end) { return comp(lo, end); },
+      [&](auto &item) {
+        if (!comp(item.first.first, hi)) {
+          return false;
+        }
+
+        stopped = comp(lo, item.first.second) && !visit(fn, item);
+
+        return !stopped;
+      });
+
+  return !stopped;
+}
+
+/**
+ * @brief Calls a function for every interval containing a point.
+ *
+ * @details
+ * Searches like overlapping(), with a query range holding only the point.
+ *
+ * @tparam Tree The type of the tree, summarized with max_end.
+ * @tparam F The type of the function.
+ * @param[in] tree The tree to search.
+ * @param[in] point The point the intervals must contain.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C>
+template <typename Tree, typename F>
+bool interval_traits<K, C>::stabbing(const Tree &tree, const K &point,
+                                     F &fn) {
+  C comp{};
+  bool stopped = false;
+
+  tree.for_each_summarized(
+      [&](const K &end) { return comp(point, end); },
+      [&](auto &item) {
+        if (comp(point, item.first.first)) {
+          return false;
+        }
+
+        stopped = comp(point, item.first.second) && !visit(fn, item);
+
+        return !stopped;
+      });
+
+  return !stopped;
+}
+
+/**
+ * @brief Calls a visitor with an element.
+ *
+ * @tparam F The type of the visitor.
+ * @tparam T The type of the element.
+ * @param[in] fn The visitor.
+ * @param[in] item The element to visit.
+ * @return bool - false if the visitor asks to stop, true otherwise.
+ */
+template <typename K, typename C>
+template <typename F, typename T>
+bool interval_traits<K, C>::visit(F &fn, T &item) {
+  if constexpr (std::is_void_v<std::invoke_result_t<F &, T &>>) {
+    fn(item);
+
+    return true;
+  } else {
+    return static_cast<bool>(fn(item));
+  }
+}
+
+// INTERVAL MAP CONSTRUCTORS
+
+/**
+ * @brief Constructs an interval map with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of interval-value pairs to insert.
+ * @throws std::invalid_argument if an interval is empty.
+ */
+template <typename K, typename V, typename C>
+interval_map<K, V, C>::interval_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+// INTERVAL MAP ELEMENT ACCESS
+
+/**
+ * @brief Returns the value of the element with the given interval.
+ *
+ * @param[in] interval The interval of the element.
+ * @return mapped_type& - the value of the element.
+ * @throws std::out_of_range if the interval is not present.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::at(const key_type &interval) const
+    -> mapped_type & {
+  iterator it = tree_.find(interval);
+
+  if (it == end()) {
+    throw std::out_of_range("interval_map::at() - missing element");
+  }
+
+  return (*it).second;
+}
+
+// INTERVAL MAP ITERATORS
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return iterator - an iterator to the first element.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::begin() const noexcept -> iterator {
+  return tree_.begin();
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return iterator - an iterator past the last element.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::end() const noexcept -> iterator {
+  return tree_.end();
+}
+
+/**
+ * @brief Returns a constant iterator to the first element.
+ *
+ * @return const_iterator - a constant iterator to the first element.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::cbegin() const noexcept -> const_iterator {
+  return tree_.cbegin();
+}
+
+/**
+ * @brief Returns a constant iterator past the last element.
+ *
+ * @return const_iterator - a constant iterator past the last element.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::cend() const noexcept -> const_iterator {
+  return tree_.cend();
+}
+
+// INTERVAL MAP CAPACITY
+
+/**
+ * @brief Checks whether the interval map is empty.
+ *
+ * @return bool - true if there are no elements, false otherwise.
+ */
+template <typename K, typename V, typename C>
+bool interval_map<K, V, C>::empty() const noexcept {
+  return !tree_.size();
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::size() const noexcept -> size_type {
+  return tree_.size();
+}
+
+// INTERVAL MAP MODIFIERS
+
+/**
+ * @brief Removes all elements.
+ */
+template <typename K, typename V, typename C>
+void interval_map<K, V, C>::clear() noexcept {
+  tree_.clear();
+}
+
+/**
+ * @brief Inserts an element if its interval is not present.
+ *
+ * @param[in] value The interval-value pair to insert.
+ * @return iterator_bool - an iterator to the element with the interval and
+ * whether the insertion took place.
+ * @throws std::invalid_argument if the interval is empty.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::insert(const_reference value) -> iterator_bool {
+  if (!C{}(value.first.first, value.first.second)) {
+    throw std::invalid_argument("interval_map::insert() - empty interval");
+  }
+
+  return tree_.try_emplace(value.first, value.second);
+}
+
+/**
+ * @brief Inserts an element if its interval is not present.
+ *
+ * @param[in] start The start of the interval.
+ * @param[in] end The end of the interval, not included itself.
+ * @param[in] obj The value to insert.
+ * @return iterator_bool - an iterator to the element with the interval and
+ * whether the insertion took place.
+ * @throws std::invalid_argument if the interval is empty.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::insert(const point_type &start,
+                                   const point_type &end,
+                                   const mapped_type &obj) -> iterator_bool {
+  return insert({{start, end}, obj});
+}
+
+/**
+ * @brief Removes the element at the given position.
+ *
+ * @param[in] pos An iterator to the element to remove.
+ * @return iterator - an iterator to the element following the removed one.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::erase(const_iterator pos) -> iterator {
+  return tree_.erase(pos);
+}
+
+/**
+ * @brief Removes the element with the given interval.
+ *
+ * @param[in] interval The interval of the element to remove.
+ * @return size_type - the number of removed elements (0 or 1).
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::erase(const key_type &interval) -> size_type {
+  size_type count = tree_.count(interval);
+
+  tree_.erase(interval);
+
+  return count;
+}
+
+// INTERVAL MAP LOOKUP
+
+/**
+ * @brief Searches for the element with the given interval.
+ *
+ * @param[in] interval The interval to search for.
+ * @return iterator - an iterator to the element, or end() if not found.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::find(const key_type &interval) const
+    -> iterator {
+  return tree_.find(interval);
+}
+
+/**
+ * @brief Checks whether an element with the given interval is present.
+ *
+ * @param[in] interval The interval to search for.
+ * @return bool - true if the interval is present, false otherwise.
+ */
+template <typename K, typename V, typename C>
+bool interval_map<K, V, C>::contains(const key_type &interval) const {
+  return tree_.count(interval);
+}
+
+// INTERVAL MAP INTERVAL QUERIES
+
+/**
+ * @brief Returns the elements whose intervals overlap [lo, hi).
+ *
+ * @param[in] lo The start of the query range.
+ * @param[in] hi The end of the query range, not included itself.
+ * @return vector<entry_type> - copies of the elements in ascending order.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::overlapping(const point_type &lo,
+                                        const point_type &hi) const
+    -> vector<entry_type> {
+  vector<entry_type> result;
+
+  for_each_overlapping(
+      lo, hi, [&result](const_reference item) { result.push_back(item); });
+
+  return result;
+}
+
+/**
+ * @brief Returns the elements whose intervals contain a point.
+ *
+ * @param[in] point The point to search for.
+ * @return vector<entry_type> - copies of the elements in ascending order.
+ */
+template <typename K, typename V, typename C>
+auto interval_map<K, V, C>::stabbing(const point_type &point) const
+    -> vector<entry_type> {
+  vector<entry_type> result;
+
+  for_each_stabbing(
+      point, [&result](const_reference item) { result.push_back(item); });
+
+  return result;
+}
+
+/**
+ * @brief Calls a function for every element whose interval overlaps [lo, hi).
+ *
+ * @details
+ * The elements are visited in ascending order without being copied (see
+ * interval_traits for the cost) and the function may stop the traversal
+ * early by returning false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The start of the query range.
+ * @param[in] hi The end of the query range, not included itself.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename V, typename C>
+template <typename F>
+bool interval_map<K, V, C>::for_each_overlapping(const point_type &lo,
+                                                 const point_type &hi,
+                                                 F &&fn) const {
+  return traits::overlapping(tree_, lo, hi, fn);
+}
+
+/**
+ * @brief Calls a function for every element whose interval contains a point.
+ *
+ * @details
+ * The elements are visited as in for_each_overlapping().
+ *
+ * @tparam F The type of the function.
+ * @param[in] point The point to search for.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename V, typename C>
+template <typename F>
+bool interval_map<K, V, C>::for_each_stabbing(const point_type &point,
+                                              F &&fn) const {
+  return traits::stabbing(tree_, point, fn);
+}
\ No newline at end of file
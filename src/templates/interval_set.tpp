@@ -0,0 +1,322 @@
+/**
+ * @file interval_set.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the interval set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_interval_set.h"
+
+using namespace s21;
+
+// INTERVAL SET CONSTRUCTORS
+
+/**
+ * @brief Constructs an interval set with intervals from an initializer list.
+ *
+ * @param[in] items The initializer list of intervals to insert.
+ * @throws std::invalid_argument if an interval is empty.
+ */
+template <typename K, typename C>
+interval_set<K, C>::interval_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+// INTERVAL SET ITERATORS
+
+/**
+ * @brief Returns an iterator to the first interval.
+ *
+ * @return iterator - an iterator to the first interval.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::begin() const noexcept -> iterator {
+  return tree_.cbegin();
+}
+
+/**
+ * @brief Returns an iterator past the last interval.
+ *
+ * @return iterator - an iterator past the last interval.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::end() const noexcept -> iterator {
+  return tree_.cend();
+}
+
+// INTERVAL SET CAPACITY
+
+/**
+ * @brief Checks whether the interval set is empty.
+ *
+ * @return bool - true if there are no intervals, false otherwise.
+ */
+template <typename K, typename C>
+bool interval_set<K, C>::empty() const noexcept {
+  return !tree_.size();
+}
+
+/**
+ * @brief Returns the number of intervals.
+ *
+ * @return size_type - the number of intervals.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::size() const noexcept -> size_type {
+  return tree_.size();
+}
+
+// INTERVAL SET MODIFIERS
+
+/**
+ * @brief Removes all intervals.
+ */
+template <typename K, typename C>
+void interval_set<K, C>::clear() noexcept {
+  tree_.clear();
+}
+
+/**
+ * @brief Inserts an interval if it is not present.
+ *
+ * @param[in] interval The interval to insert.
+ * @return iterator_bool - an iterator to the interval and whether the
+ * insertion took place.
+ * @throws std::invalid_argument if the interval is empty.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::insert(const_reference interval) -> iterator_bool {
+  if (!C{}(interval.first, interval.second)) {
+    throw std::invalid_argument("interval_set::insert() - empty interval");
+  }
+
+  auto [it, inserted] = tree_.try_emplace(interval);
+
+  return {it, inserted};
+}
+
+/**
+ * @brief Inserts an interval if it is not present.
+ *
+ * @param[in] start The start of the interval.
+ * @param[in] end The end of the interval, not included itself.
+ * @return iterator_bool - an iterator to the interval and whether the
+ * insertion took place.
+ * @throws std::invalid_argument if the interval is empty.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::insert(const point_type &start,
+                                const point_type &end) -> iterator_bool {
+  return insert({start, end});
+}
+
+/**
+ * @brief Removes the interval at the given position.
+ *
+ * @param[in] pos An iterator to the interval to remove.
+ * @return iterator - an iterator to the interval following the removed one.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::erase(const_iterator pos) -> iterator {
+  return tree_.erase(pos);
+}
+
+/**
+ * @brief Removes the given interval.
+ *
+ * @param[in] interval The interval to remove.
+ * @return size_type - the number of removed intervals (0 or 1).
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::erase(const key_type &interval) -> size_type {
+  size_type count = tree_.count(interval);
+
+  tree_.erase(interval);
+
+  return count;
+}
+
+// INTERVAL SET LOOKUP
+
+/**
+ * @brief Searches for the given interval.
+ *
+ * @param[in] interval The interval to search for.
+ * @return iterator - an iterator to the interval, or end() if not found.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::find(const key_type &interval) const -> iterator {
+  return tree_.find(interval);
+}
+
+/**
+ * @brief Checks whether the given interval is present.
+ *
+ * @param[in] interval The interval to search for.
+ * @return bool - true if the interval is present, false otherwise.
+ */
+template <typename K, typename C>
+bool interval_set<K, C>::contains(const key_type &interval) const {
+  return tree_.count(interval);
+}
+
+// INTERVAL SET INTERVAL QUERIES
+
+/**
+ * @brief Returns the intervals overlapping [lo, hi).
+ *
+ * @param[in] lo The start of the query range.
+ * @param[in] hi The end of the query range, not included itself.
+ * @return vector<value_type> - the intervals in ascending order.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::overlapping(const point_type &lo,
+                                     const point_type &hi) const
+    -> vector<value_type> {
+  vector<value_type> result;
+
+  for_each_overlapping(
+      lo, hi, [&result](const_reference item) { result.push_back(item); });
+
+  return result;
+}
+
+/**
+ * @brief Returns the intervals containing a point.
+ *
+ * @param[in] point The point to search for.
+ * @return vector<value_type> - the intervals in ascending order.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::stabbing(const point_type &point) const
+    -> vector<value_type> {
+  vector<value_type> result;
+
+  for_each_stabbing(
+      point, [&result](const_reference item) { result.push_back(item); });
+
+  return result;
+}
+
+/**
+ * @brief Calls a function for every interval overlapping [lo, hi).
+ *
+ * @details
+ * The intervals are visited in ascending order (see interval_traits for the
+ * cost) and the function may stop the traversal early by returning false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The start of the query range.
+ * @param[in] hi The end of the query range, not included itself.
+ * @param[in] fn The function called with a constant reference to each
+ * interval.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C>
+template <typename F>
+bool interval_set<K, C>::for_each_overlapping(const point_type &lo,
+                                              const point_type &hi,
+                                              F &&fn) const {
+  auto project = [&fn](const auto &pair) -> decltype(auto) {
+    return fn(pair.first);
+  };
+
+  return traits::overlapping(tree_, lo, hi, project);
+}
+
+/**
+ * @brief Calls a function for every interval containing a point.
+ *
+ * @details
+ * The intervals are visited as in for_each_overlapping().
+ *
+ * @tparam F The type of the function.
+ * @param[in] point The point to search for.
+ * @param[in] fn The function called with a constant reference to each
+ * interval.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C>
+template <typename F>
+bool interval_set<K, C>::for_each_stabbing(const point_type &point,
+                                           F &&fn) const {
+  auto project = [&fn](const auto &pair) -> decltype(auto) {
+    return fn(pair.first);
+  };
+
+  return traits::stabbing(tree_, point, project);
+}
+
+// INTERVAL SET ITERATOR OPERATORS
+
+/**
+ * @brief Pre-increment operator for the interval set iterator.
+ *
+ * @return iterator& - reference to the incremented iterator.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::iterator::operator++() noexcept -> iterator & {
+  *this += 1;
+
+  return *this;
+}
+
+/**
+ * @brief Pre-decrement operator for the interval set iterator.
+ *
+ * @return iterator& - reference to the decremented iterator.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::iterator::operator--() noexcept -> iterator & {
+  *this -= 1;
+
+  return *this;
+}
+
+/**
+ * @brief Post-increment operator for the interval set iterator.
+ *
+ * @return iterator - the original iterator before the increment.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::iterator::operator++(int) noexcept -> iterator {
+  iterator copy{*this};
+
+  *this += 1;
+
+  return copy;
+}
+
+/**
+ * @brief Post-decrement operator for the interval set iterator.
+ *
+ * @return iterator - the original iterator before the decrement.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::iterator::operator--(int) noexcept -> iterator {
+  iterator copy{*this};
+
+  *this -= 1;
+
+  return copy;
+}
+
+/**
+ * @brief Dereference operator for the interval set iterator.
+ *
+ * @return const_reference - const reference to the interval at the current
+ * position.
+ */
+template <typename K, typename C>
+auto interval_set<K, C>::iterator::operator*() const noexcept
+    -> const_reference {
+  return (*this->ptr_->pair).first;
+}
\ No newline at end of file
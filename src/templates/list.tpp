@@ -24,7 +24,7 @@ using namespace s21;
  *
  */
 template <typename T>
-list<T>::list() {
+list<T>::list() noexcept {
   Size = 0;
   head = nullptr;
   tail = nullptr;
@@ -93,7 +93,7 @@ list<T>::list(const list &l) : list() {
  * @param[in] l The list to move from.
  */
 template <typename T>
-list<T>::list(list &&l) : list() {
+list<T>::list(list &&l) noexcept : list() {
   if (this != &l) {
     head = l.head;
     tail = l.tail;
@@ -153,10 +153,10 @@ list<T> &list<T>::operator=(const list &l) {
  * @return list<T>& - reference to the assigned list.
  */
 template <typename T>
-list<T> &list<T>::operator=(list &&l) {
+list<T> &list<T>::operator=(list &&l) noexcept {
   if (this != &l) {
     list<T> tmp(std::move(l));
-    *this = tmp;
+    swap(tmp);
   }
   return *this;
 }
@@ -473,10 +473,10 @@ void list<T>::pop_front() {
  *
  */
 template <typename T>
-void list<T>::swap(list &other) {
-  list<T> temp(*this);
-  *this = other;
-  other = temp;
+void list<T>::swap(list &other) noexcept {
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(Size, other.Size);
 }
 
 /**
@@ -16,6 +16,14 @@ using namespace s21;
 
 // MAP CONSTRUCTORS
 
+/**
+ * @brief Constructs an empty map ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C, bool L>
+map<K, M, C, L>::map(const C &comp) : tree_{comp} {}
+
 /**
  * @brief Constructs a map with elements from an initializer list.
  *
@@ -27,8 +35,9 @@ using namespace s21;
  * @param[in] items The initializer list of key-value pairs to insert into the
  * map.
  */
-template <typename K, typename M>
-map<K, M>::map(std::initializer_list<value_type> const &items) : tree_{items} {}
+template <typename K, typename M, typename C, bool L>
+map<K, M, C, L>::map(std::initializer_list<value_type> const &items)
+    : tree_{items} {}
 
 /**
  * @brief Copy constructor for the map.
@@ -39,8 +48,8 @@ map<K, M>::map(std::initializer_list<value_type> const &items) : tree_{items} {}
  *
  * @param[in] m The map to copy from.
  */
-template <typename K, typename M>
-map<K, M>::map(const map &m) : tree_{m.tree_} {}
+template <typename K, typename M, typename C, bool L>
+map<K, M, C, L>::map(const map &m) : tree_{m.tree_} {}
 
 /**
  * @brief Move constructor for the map.
@@ -52,8 +61,10 @@ map<K, M>::map(const map &m) : tree_{m.tree_} {}
  *
  * @param[in] m The map to move from.
  */
-template <typename K, typename M>
-map<K, M>::map(map &&m) : tree_{std::move(m.tree_)} {}
+template <typename K, typename M, typename C, bool L>
+map<K, M, C, L>::map(map &&m) noexcept(
+    std::is_nothrow_copy_constructible_v<C>)
+    : tree_{std::move(m.tree_)} {}
 
 /**
  * @brief Move assignment operator for the map.
@@ -64,10 +75,11 @@ map<K, M>::map(map &&m) : tree_{std::move(m.tree_)} {}
  * source map.
  *
  * @param[in] m The map to move from.
- * @return map<K, M>& - reference to the assigned map.
+ * @return map<K, M, C, L>& - reference to the assigned map.
  */
-template <typename K, typename M>
-auto map<K, M>::operator=(map &&m) -> map & {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::operator=(map &&m) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) -> map & {
   if (this != &m) {
     tree_.clear();
     new (this) map{std::move(m)};
@@ -85,10 +97,10 @@ auto map<K, M>::operator=(map &&m) -> map & {
  * source map.
  *
  * @param[in] m The map to copy from.
- * @return map<K, M>& - reference to the assigned map.
+ * @return map<K, M, C, L>& - reference to the assigned map.
  */
-template <typename K, typename M>
-auto map<K, M>::operator=(const map &m) -> map & {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::operator=(const map &m) -> map & {
   if (this != &m) {
     tree_.clear();
     new (this) map{m};
@@ -110,8 +122,8 @@ auto map<K, M>::operator=(const map &m) -> map & {
  * @return mapped_type& - reference to the value associated with the key.
  * @throws std::out_of_range if the key is not found.
  */
-template <typename K, typename M>
-auto map<K, M>::at(const key_type &key) const -> mapped_type & {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::at(const key_type &key) const -> mapped_type & {
   auto it = tree_.find(key);
 
   if (it == tree_.end()) {
@@ -132,15 +144,25 @@ auto map<K, M>::at(const key_type &key) const -> mapped_type & {
  * @param[in] key The key to search for.
  * @return mapped_type& - reference to the value associated with the key.
  */
-template <typename K, typename M>
-auto map<K, M>::operator[](const key_type &key) noexcept -> mapped_type & {
-  auto it = tree_.find(key);
-
-  if (it == tree_.end()) {
-    it = tree_.insert({key, mapped_type{}});
-  }
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::operator[](const key_type &key) noexcept
+    -> mapped_type & {
+  return (*tree_.try_emplace(key).first).second;
+}
 
-  return (*it).second;
+/**
+ * @brief Accesses or inserts a value associated with a given key.
+ *
+ * @details
+ * Same as the overload above, but a missing key is moved into the map.
+ *
+ * @param[in] key The key to search for.
+ * @return mapped_type& - reference to the value associated with the key.
+ */
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::operator[](std::remove_const_t<key_type> &&key) noexcept
+    -> mapped_type & {
+  return (*tree_.try_emplace(std::move(key)).first).second;
 }
 
 // MAP ITERATORS
@@ -153,8 +175,8 @@ auto map<K, M>::operator[](const key_type &key) noexcept -> mapped_type & {
  *
  * @return iterator - an iterator to the beginning of the map.
  */
-template <typename K, typename M>
-auto map<K, M>::begin() const noexcept -> iterator {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::begin() const noexcept -> iterator {
   return tree_.begin();
 }
 
@@ -167,8 +189,8 @@ auto map<K, M>::begin() const noexcept -> iterator {
  *
  * @return iterator - an iterator to the end of the map.
  */
-template <typename K, typename M>
-auto map<K, M>::end() const noexcept -> iterator {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::end() const noexcept -> iterator {
   return tree_.end();
 }
 
@@ -180,8 +202,8 @@ auto map<K, M>::end() const noexcept -> iterator {
  *
  * @return const_iterator - a const iterator to the beginning of the map.
  */
-template <typename K, typename M>
-auto map<K, M>::cbegin() const noexcept -> const_iterator {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::cbegin() const noexcept -> const_iterator {
   return tree_.cbegin();
 }
 
@@ -194,8 +216,8 @@ auto map<K, M>::cbegin() const noexcept -> const_iterator {
  *
  * @return const_iterator - a const iterator to the end of the map.
  */
-template <typename K, typename M>
-auto map<K, M>::cend() const noexcept -> const_iterator {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::cend() const noexcept -> const_iterator {
   return tree_.cend();
 }
 
@@ -209,8 +231,8 @@ auto map<K, M>::cend() const noexcept -> const_iterator {
  *
  * @return bool - true if the map is empty, false otherwise.
  */
-template <typename K, typename M>
-bool map<K, M>::empty() const noexcept {
+template <typename K, typename M, typename C, bool L>
+bool map<K, M, C, L>::empty() const noexcept {
   return (!tree_.size()) ? true : false;
 }
 
@@ -222,8 +244,8 @@ bool map<K, M>::empty() const noexcept {
  *
  * @return size_type - the number of elements in the map.
  */
-template <typename K, typename M>
-auto map<K, M>::size() const noexcept -> size_type {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::size() const noexcept -> size_type {
   return tree_.size();
 }
 
@@ -232,8 +254,8 @@ auto map<K, M>::size() const noexcept -> size_type {
  *
  * @return size_type - the maximum number of elements.
  */
-template <typename K, typename M>
-auto map<K, M>::max_size() const noexcept -> size_type {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::max_size() const noexcept -> size_type {
   return tree_.max_size();
 }
 
@@ -246,8 +268,8 @@ auto map<K, M>::max_size() const noexcept -> size_type {
  * This method removes all elements from the map, leaving it empty.
  *
  */
-template <typename K, typename M>
-void map<K, M>::clear() {
+template <typename K, typename M, typename C, bool L>
+void map<K, M, C, L>::clear() {
   tree_.clear();
 }
 
@@ -263,14 +285,33 @@ void map<K, M>::clear() {
  * @return iterator_bool - a pair containing an iterator to the inserted element
  * and a bool indicating whether the insertion took place.
  */
-template <typename K, typename M>
-auto map<K, M>::insert(const_reference value) -> iterator_bool {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::insert(const_reference value) -> iterator_bool {
   auto it = tree_.insert(value);
 
   return (it != tree_.end()) ? iterator_bool{it, true}
                              : iterator_bool{tree_.find(value.first), false};
 }
 
+/**
+ * @brief Inserts a new element into the map, moving the given value.
+ *
+ * @details
+ * The value is moved into the map only if its key is not present yet,
+ * otherwise it is left intact and the existing element is returned.
+ *
+ * @param[in] value The value to insert.
+ * @return iterator_bool - a pair containing an iterator to the inserted element
+ * and a bool indicating whether the insertion took place.
+ */
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::insert(value_type &&value) -> iterator_bool {
+  auto it = tree_.insert(std::move(value));
+
+  return (it != tree_.end()) ? iterator_bool{it, true}
+                             : iterator_bool{tree_.find(value.first), false};
+}
+
 /**
  * @brief Inserts a new element with the given key and value into the map.
  *
@@ -284,8 +325,8 @@ auto map<K, M>::insert(const_reference value) -> iterator_bool {
  * @return iterator_bool - a pair containing an iterator to the inserted element
  * and a bool indicating whether the insertion took place.
  */
-template <typename K, typename M>
-auto map<K, M>::insert(const key_type &key, const mapped_type &obj)
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::insert(const key_type &key, const mapped_type &obj)
     -> iterator_bool {
   auto it = tree_.insert({key, obj});
 
@@ -307,8 +348,9 @@ auto map<K, M>::insert(const key_type &key, const mapped_type &obj)
  * @return iterator_bool - a pair containing an iterator to the inserted or
  * assigned element and a bool indicating whether the insertion took place.
  */
-template <typename K, typename M>
-auto map<K, M>::insert_or_assign(const key_type &key, const mapped_type &obj)
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::insert_or_assign(const key_type &key,
+                                       const mapped_type &obj)
     -> iterator_bool {
   auto it = tree_.find(key);
   bool obj_exists{false};
@@ -333,8 +375,8 @@ auto map<K, M>::insert_or_assign(const key_type &key, const mapped_type &obj)
  * @return iterator - an iterator to the element following the erased element,
  * or end() if the erased element was the last element.
  */
-template <typename K, typename M>
-auto map<K, M>::erase(const_iterator pos) -> iterator {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::erase(const_iterator pos) -> iterator {
   return tree_.erase((*pos).first);
 }
 
@@ -350,8 +392,9 @@ auto map<K, M>::erase(const_iterator pos) -> iterator {
  * element, or end() if the last erased element was the last element.
  * @throws std::range_error if the range is invalid.
  */
-template <typename K, typename M>
-auto map<K, M>::erase(const_iterator first, const_iterator last) -> iterator {
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::erase(const_iterator first, const_iterator last)
+    -> iterator {
   return tree_.erase(first, last);
 }
 
@@ -364,9 +407,34 @@ auto map<K, M>::erase(const_iterator first, const_iterator last) -> iterator {
  * @param[in] key The key of the elements to erase.
  * @return size_type - the number of elements erased.
  */
-template <typename K, typename M>
-auto map<K, M>::erase(const key_type &key) -> size_type {
-  return (tree_.erase(key) != tree_.end()) ? true : false;
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::erase(const key_type &key) -> size_type {
+  size_type count = tree_.count(key);
+
+  tree_.erase(key);
+
+  return count;
+}
+
+/**
+ * @brief Erases the element with a key equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator, so the value does not have to
+ * be converted to key_type first.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the keys with.
+ * @return size_type - the number of elements erased.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename Key, typename Cmp, typename, typename>
+auto map<K, M, C, L>::erase(const Key &key) -> size_type {
+  size_type count = tree_.count(key);
+
+  tree_.erase(key);
+
+  return count;
 }
 
 /**
@@ -377,8 +445,9 @@ auto map<K, M>::erase(const key_type &key) -> size_type {
  *
  * @param[in,out] other The map to swap with.
  */
-template <typename K, typename M>
-void map<K, M>::swap(map &other) {
+template <typename K, typename M, typename C, bool L>
+void map<K, M, C, L>::swap(map &other) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
   std::swap(tree_, other.tree_);
 }
 
@@ -391,8 +460,8 @@ void map<K, M>::swap(map &other) {
  *
  * @param[in,out] other The map to merge with.
  */
-template <typename K, typename M>
-void map<K, M>::merge(map &other) {
+template <typename K, typename M, typename C, bool L>
+void map<K, M, C, L>::merge(map &other) {
   tree_.merge(other.tree_);
 }
 
@@ -410,40 +479,120 @@ void map<K, M>::merge(map &other) {
  * element that prevented the insertion) and a bool denoting whether the
  * insertion took place.
  */
-template <typename K, typename M>
+template <typename K, typename M, typename C, bool L>
 template <typename... Args>
-auto map<K, M>::emplace(Args &&...args) -> std::pair<iterator, bool> {
+auto map<K, M, C, L>::emplace(Args &&...args) -> std::pair<iterator, bool> {
   return tree_.emplace(std::forward<Args>(args)...);
 }
 
+/**
+ * @brief Inserts an element with the given key if the key is not present.
+ *
+ * @details
+ * Unlike emplace(), nothing is constructed when the key is already present.
+ * Otherwise the value is constructed from args directly in the new node.
+ *
+ * @tparam Args The types of the arguments for the value constructor.
+ * @param[in] key The key of the element.
+ * @param args The arguments to forward to the constructor of the value.
+ * @return A pair consisting of an iterator to the inserted element (or to the
+ * element that prevented the insertion) and a bool denoting whether the
+ * insertion took place.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename... Args>
+auto map<K, M, C, L>::try_emplace(const key_type &key, Args &&...args)
+    -> std::pair<iterator, bool> {
+  return tree_.try_emplace(key, std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Inserts an element with the given key if the key is not present.
+ *
+ * @details
+ * Same as the overload above, but the key is moved into the new node.
+ *
+ * @tparam Args The types of the arguments for the value constructor.
+ * @param[in] key The key of the element.
+ * @param args The arguments to forward to the constructor of the value.
+ * @return A pair consisting of an iterator to the inserted element (or to the
+ * element that prevented the insertion) and a bool denoting whether the
+ * insertion took place.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename... Args>
+auto map<K, M, C, L>::try_emplace(std::remove_const_t<key_type> &&key,
+                                  Args &&...args)
+    -> std::pair<iterator, bool> {
+  return tree_.try_emplace(std::move(key), std::forward<Args>(args)...);
+}
+
 /**
  * @brief Inserts new elements into the map.
  *
  * @details
  * This method inserts new elements into the map and returns the result of the
- * insertion.
+ * insertion. The elements are sorted and inserted as one batch, so the cost
+ * does not grow with a full tree descent per element.
  *
  * @param args The arguments are std::initializer_list of pairs to insert.
  * @return A vector containing pairs of <iterator,bool>, where iterator is the
  * corresponding iterator of the element, bool is the result of insertion (true
  * if the element is inserted and false if the element is not inserted).
  */
-template <typename K, typename M>
+template <typename K, typename M, typename C, bool L>
 template <typename... Args>
-auto map<K, M>::insert_many(Args &&...args)
+auto map<K, M, C, L>::insert_many(Args &&...args)
+    -> vector<std::pair<iterator, bool>> {
+  return tree_.insert_many(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Inserts the elements of the range [first, last) into the map.
+ *
+ * @details
+ * The range is sorted and inserted as one batch, the same way as by
+ * insert_many().
+ *
+ * @param[in] first The beginning of the range of key-value pairs.
+ * @param[in] last The end of the range of key-value pairs.
+ * @return A vector containing pairs of <iterator,bool> in the order of the
+ * range, where bool is the result of insertion.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename InputIt>
+auto map<K, M, C, L>::insert_range(InputIt first, InputIt last)
     -> vector<std::pair<iterator, bool>> {
-  s21::vector<std::pair<iterator, bool>> v;
-  v.reserve(sizeof...(args));
-  (
-      [&v, this](Args &&arg) {
-        v.push_back(tree_.emplace(arg.first, arg.second));
-      }(std::forward<Args>(args)),
-      ...);
-  return v;
+  return tree_.insert_range(first, last, [](const auto &item) {
+    return value_type{item.first, item.second};
+  });
 }
 
 // MAP LOOKUP
 
+/**
+ * @brief Searches for an element with the specified key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the element with the specified key, or
+ * `end()` if the key is not found.
+ */
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::find(const key_type &key) const noexcept -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Counts the elements with the specified key.
+ *
+ * @param[in] key The key to search for.
+ * @return size_type - 1 if the key is present, 0 otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::count(const key_type &key) const noexcept -> size_type {
+  return tree_.count(key);
+}
+
 /**
  * @brief Checks if the map contains an element with the specified key.
  *
@@ -455,17 +604,174 @@ auto map<K, M>::insert_many(Args &&...args)
  * @return bool - true if the map contains an element with the specified key,
  * false otherwise.
  */
-template <typename K, typename M>
-bool map<K, M>::contains(const key_type &key) const noexcept {
+template <typename K, typename M, typename C, bool L>
+bool map<K, M, C, L>::contains(const key_type &key) const noexcept {
   return (tree_.find(key) != tree_.end()) ? true : false;
 }
 
+/**
+ * @brief Finds the first element whose key is not less than the given key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::lower_bound(const key_type &key) const noexcept
+    -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Finds the first element whose key is greater than the given key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+auto map<K, M, C, L>::upper_bound(const key_type &key) const noexcept
+    -> iterator {
+  return tree_.upper_bound(key);
+}
+
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return C - a copy of the comparator.
+ */
+template <typename K, typename M, typename C, bool L>
+C map<K, M, C, L>::key_comp() const {
+  return tree_.key_comp();
+}
+
+// MAP VISITATION
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false; a function
+ * returning void always visits every element (see tree::for_each()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a reference to each key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename F>
+bool map<K, M, C, L>::for_each(F &&fn) const {
+  return tree_.for_each(fn);
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * Only the part of the tree overlapping the range is traversed, in ascending
+ * key order (see tree::for_each_in_range()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with a reference to each key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename F>
+bool map<K, M, C, L>::for_each_in_range(const key_type &lo, const key_type &hi,
+                                        F &&fn) const {
+  return tree_.for_each_in_range(lo, hi, fn);
+}
+
+// MAP TRANSPARENT LOOKUP
+
+/**
+ * @brief Searches for an element with a key equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator, so the value (for example a
+ * std::string_view for std::string keys) is compared with the keys directly,
+ * without building a temporary key.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto map<K, M, C, L>::find(const Key &key) const noexcept -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Counts the elements with a key equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return size_type - 1 if such a key is present, 0 otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto map<K, M, C, L>::count(const Key &key) const noexcept -> size_type {
+  return tree_.count(key);
+}
+
+/**
+ * @brief Checks if the map contains a key equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return bool - true if such a key is present, false otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+bool map<K, M, C, L>::contains(const Key &key) const noexcept {
+  return tree_.find(key) != tree_.end();
+}
+
+/**
+ * @brief Finds the first element whose key is not less than the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto map<K, M, C, L>::lower_bound(const Key &key) const noexcept -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Finds the first element whose key is greater than the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto map<K, M, C, L>::upper_bound(const Key &key) const noexcept -> iterator {
+  return tree_.upper_bound(key);
+}
+
 /**
  * @brief Returns a string representation of the tree structure.
  *
  * @return std::string - a string representation of the tree structure.
  */
-template <typename K, typename M>
-std::string map<K, M>::structure() const noexcept {
+template <typename K, typename M, typename C, bool L>
+std::string map<K, M, C, L>::structure() const noexcept {
   return tree_.structure();
 }
\ No newline at end of file
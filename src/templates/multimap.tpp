@@ -0,0 +1,440 @@
+/**
+ * @file multimap.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the multimap container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_multimap.h"
+
+using namespace s21;
+
+// MULTIMAP CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty multimap ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C, bool L>
+multimap<K, M, C, L>::multimap(const C &comp)
+    : tree_{comp, tree_type::kNON_UNIQUE} {}
+
+/**
+ * @brief Constructs a multimap with elements from an initializer list.
+ *
+ * @details
+ * Every element of the list is inserted, elements with equal keys in the order
+ * of the list.
+ *
+ * @param[in] items The initializer list of key-value pairs to insert.
+ */
+template <typename K, typename M, typename C, bool L>
+multimap<K, M, C, L>::multimap(std::initializer_list<value_type> const &items)
+    : tree_{items, tree_type::kNON_UNIQUE} {}
+
+/**
+ * @brief Copy constructor for the multimap.
+ *
+ * @param[in] mm The multimap to copy from.
+ */
+template <typename K, typename M, typename C, bool L>
+multimap<K, M, C, L>::multimap(const multimap &mm) : tree_{mm.tree_} {}
+
+/**
+ * @brief Move constructor for the multimap.
+ *
+ * @details
+ * Takes ownership of the tree of the source multimap, leaving the source in a
+ * valid but unspecified state.
+ *
+ * @param[in] mm The multimap to move from.
+ */
+template <typename K, typename M, typename C, bool L>
+multimap<K, M, C, L>::multimap(multimap &&mm) noexcept(
+    std::is_nothrow_copy_constructible_v<C>)
+    : tree_{std::move(mm.tree_)} {}
+
+/**
+ * @brief Move assignment operator for the multimap.
+ *
+ * @param[in] mm The multimap to move from.
+ * @return multimap<K, M, C, L>& - reference to the assigned multimap.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::operator=(multimap &&mm) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) -> multimap & {
+  if (this != &mm) {
+    tree_.clear();
+    new (this) multimap{std::move(mm)};
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Copy assignment operator for the multimap.
+ *
+ * @param[in] mm The multimap to copy from.
+ * @return multimap<K, M, C, L>& - reference to the assigned multimap.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::operator=(const multimap &mm) -> multimap & {
+  if (this != &mm) {
+    tree_.clear();
+    new (this) multimap{mm};
+  }
+
+  return *this;
+}
+
+// MULTIMAP ITERATORS
+
+/**
+ * @brief Returns an iterator to the beginning of the multimap.
+ *
+ * @return iterator - an iterator to the first element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::begin() const noexcept -> iterator {
+  return tree_.begin();
+}
+
+/**
+ * @brief Returns an iterator to the end of the multimap.
+ *
+ * @return iterator - an iterator past the last element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::end() const noexcept -> iterator {
+  return tree_.end();
+}
+
+/**
+ * @brief Returns a const iterator to the beginning of the multimap.
+ *
+ * @return const_iterator - a const iterator to the first element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::cbegin() const noexcept -> const_iterator {
+  return tree_.cbegin();
+}
+
+/**
+ * @brief Returns a const iterator to the end of the multimap.
+ *
+ * @return const_iterator - a const iterator past the last element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::cend() const noexcept -> const_iterator {
+  return tree_.cend();
+}
+
+// MULTIMAP CAPACITY
+
+/**
+ * @brief Checks if the multimap is empty.
+ *
+ * @return bool - true if the multimap is empty, false otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+bool multimap<K, M, C, L>::empty() const noexcept {
+  return !tree_.size();
+}
+
+/**
+ * @brief Returns the number of elements in the multimap.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::size() const noexcept -> size_type {
+  return tree_.size();
+}
+
+/**
+ * @brief Returns the maximum number of elements the multimap can hold.
+ *
+ * @return size_type - the maximum number of elements.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::max_size() const noexcept -> size_type {
+  return tree_.max_size();
+}
+
+// MULTIMAP MODIFIERS
+
+/**
+ * @brief Removes all elements from the multimap.
+ */
+template <typename K, typename M, typename C, bool L>
+void multimap<K, M, C, L>::clear() {
+  tree_.clear();
+}
+
+/**
+ * @brief Inserts a new element into the multimap.
+ *
+ * @details
+ * The element is placed after every element with an equal key.
+ *
+ * @param[in] value The key-value pair to insert.
+ * @return iterator - an iterator to the inserted element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::insert(const_reference value) -> iterator {
+  return tree_.insert(value);
+}
+
+/**
+ * @brief Inserts a new element into the multimap, moving the given value.
+ *
+ * @param[in] value The key-value pair to insert.
+ * @return iterator - an iterator to the inserted element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::insert(value_type &&value) -> iterator {
+  return tree_.insert(std::move(value));
+}
+
+/**
+ * @brief Inserts a new element with the given key and value.
+ *
+ * @param[in] key The key of the element to insert.
+ * @param[in] obj The value of the element to insert.
+ * @return iterator - an iterator to the inserted element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::insert(const key_type &key, const mapped_type &obj)
+    -> iterator {
+  return tree_.try_emplace(key, obj).first;
+}
+
+/**
+ * @brief Erases the element at the specified position.
+ *
+ * @details
+ * Only that element is erased, the other elements with the same key keep
+ * their order.
+ *
+ * @param[in] pos The position of the element to erase.
+ * @return iterator - an iterator to the element following the erased element,
+ * or end() if the erased element was the last element.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::erase(const_iterator pos) -> iterator {
+  return tree_.erase(pos);
+}
+
+/**
+ * @brief Erases all elements with the specified key.
+ *
+ * @details
+ * The elements are erased in one walk from the lower bound to the upper
+ * bound of the key (see tree::erase_all()), without a search per element.
+ *
+ * @param[in] key The key of the elements to erase.
+ * @return size_type - the number of elements erased.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::erase(const key_type &key) -> size_type {
+  return tree_.erase_all(key);
+}
+
+/**
+ * @brief Swaps the contents of the multimap with another multimap.
+ *
+ * @param[in,out] other The multimap to swap with.
+ */
+template <typename K, typename M, typename C, bool L>
+void multimap<K, M, C, L>::swap(multimap &other) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
+  std::swap(tree_, other.tree_);
+}
+
+/**
+ * @brief Moves every element of another multimap into the current multimap.
+ *
+ * @details
+ * The moved elements are placed after the elements with equal keys already
+ * present and keep their own order.
+ *
+ * @param[in,out] other The multimap to merge with, left empty.
+ */
+template <typename K, typename M, typename C, bool L>
+void multimap<K, M, C, L>::merge(multimap &other) {
+  tree_.merge(other.tree_);
+}
+
+/**
+ * @brief Inserts a new element into the multimap, constructed in place.
+ *
+ * @tparam Args The types of the arguments to forward to the constructor of the
+ * key-value pair.
+ * @param args The arguments to forward to the constructor of the pair.
+ * @return iterator - an iterator to the inserted element.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename... Args>
+auto multimap<K, M, C, L>::emplace(Args &&...args) -> iterator {
+  return tree_.emplace(std::forward<Args>(args)...).first;
+}
+
+/**
+ * @brief Inserts new elements into the multimap.
+ *
+ * @details
+ * The elements are sorted and inserted as one batch, elements with equal keys
+ * in the order of the arguments.
+ *
+ * @param args The key-value pairs to insert.
+ * @return A vector containing pairs of <iterator,bool>, where iterator is the
+ * corresponding iterator of the element and bool is always true.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename... Args>
+auto multimap<K, M, C, L>::insert_many(Args &&...args)
+    -> vector<std::pair<iterator, bool>> {
+  return tree_.insert_many(value_type(std::forward<Args>(args))...);
+}
+
+// MULTIMAP LOOKUP
+
+/**
+ * @brief Counts the elements with the specified key.
+ *
+ * @details
+ * The number of elements ordered before the upper bound of the key minus the
+ * number before its lower bound, both read from the subtree counts in
+ * O(log n).
+ *
+ * @param[in] key The key to search for.
+ * @return size_type - the number of elements with the specified key.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::count(const key_type &key) const noexcept
+    -> size_type {
+  return tree_.aggregate_before(key, true).value_or(0) -
+         tree_.aggregate_before(key).value_or(0);
+}
+
+/**
+ * @brief Searches for the first element with the specified key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the first inserted element with the key,
+ * or `end()` if the key is not found.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::find(const key_type &key) const noexcept
+    -> iterator {
+  iterator it = tree_.lower_bound(key);
+
+  return (it != tree_.upper_bound(key)) ? it : end();
+}
+
+/**
+ * @brief Checks if the multimap contains an element with the specified key.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+bool multimap<K, M, C, L>::contains(const key_type &key) const noexcept {
+  return tree_.find(key) != tree_.end();
+}
+
+/**
+ * @brief Returns the range of elements with the specified key.
+ *
+ * @details
+ * The range lists the elements in their insertion order. Both bounds are found
+ * by a descent each, so the cost is O(log n).
+ *
+ * @param[in] key The key to search for.
+ * @return iterator_range - a pair of iterators representing the range.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::equal_range(const key_type &key) const noexcept
+    -> iterator_range {
+  return iterator_range{tree_.lower_bound(key), tree_.upper_bound(key)};
+}
+
+/**
+ * @brief Finds the first element whose key is not less than the given key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::lower_bound(const key_type &key) const noexcept
+    -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Finds the first element whose key is greater than the given key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename M, typename C, bool L>
+auto multimap<K, M, C, L>::upper_bound(const key_type &key) const noexcept
+    -> iterator {
+  return tree_.upper_bound(key);
+}
+
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return C - a copy of the comparator.
+ */
+template <typename K, typename M, typename C, bool L>
+C multimap<K, M, C, L>::key_comp() const {
+  return tree_.key_comp();
+}
+
+// MULTIMAP VISITATION
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false; a function
+ * returning void always visits every element (see tree::for_each()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a reference to each key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename F>
+bool multimap<K, M, C, L>::for_each(F &&fn) const {
+  return tree_.for_each(fn);
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * Only the part of the tree overlapping the range is traversed, in ascending
+ * key order (see tree::for_each_in_range()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with a reference to each key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L>
+template <typename F>
+bool multimap<K, M, C, L>::for_each_in_range(const key_type &lo,
+                                             const key_type &hi,
+                                             F &&fn) const {
+  return tree_.for_each_in_range(lo, hi, fn);
+}
\ No newline at end of file
@@ -16,6 +16,15 @@ using namespace s21;
 
 // MULTISET CONSTRUCTORS
 
+/**
+ * @brief Constructs an empty multiset ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool L, bool R>
+multiset<K, C, L, R>::multiset(const C &comp)
+    : tree_{comp, tree_type::kNON_UNIQUE} {}
+
 /**
  * @brief Constructs a multiset with elements from an initializer list.
  *
@@ -26,10 +35,10 @@ using namespace s21;
  *
  * @param[in] items The initializer list of values to insert into the multiset.
  */
-template <typename K>
-multiset<K>::multiset(std::initializer_list<value_type> const &items) {
+template <typename K, typename C, bool L, bool R>
+multiset<K, C, L, R>::multiset(std::initializer_list<value_type> const &items) {
   for (auto i : items) {
-    tree_.insert({i, i});
+    tree_.insert({i, {}});
   }
 }
 
@@ -42,8 +51,8 @@ multiset<K>::multiset(std::initializer_list<value_type> const &items) {
  *
  * @param[in] ms The multiset to copy from.
  */
-template <typename K>
-multiset<K>::multiset(const multiset &ms) : tree_{ms.tree_} {}
+template <typename K, typename C, bool L, bool R>
+multiset<K, C, L, R>::multiset(const multiset &ms) : tree_{ms.tree_} {}
 
 /**
  * @brief Move constructor for the multiset.
@@ -55,8 +64,10 @@ multiset<K>::multiset(const multiset &ms) : tree_{ms.tree_} {}
  *
  * @param[in] ms The multiset to move from.
  */
-template <typename K>
-multiset<K>::multiset(multiset &&s) : tree_{std::move(s.tree_)} {}
+template <typename K, typename C, bool L, bool R>
+multiset<K, C, L, R>::multiset(multiset &&s) noexcept(
+    std::is_nothrow_copy_constructible_v<C>)
+    : tree_{std::move(s.tree_)} {}
 
 /**
  * @brief Move assignment operator for the multiset.
@@ -67,10 +78,11 @@ multiset<K>::multiset(multiset &&s) : tree_{std::move(s.tree_)} {}
  * from the source multiset.
  *
  * @param[in] ms The multiset to move from.
- * @return multiset<K>& - reference to the assigned multiset.
+ * @return multiset<K, C, L, R>& - reference to the assigned multiset.
  */
-template <typename K>
-auto multiset<K>::operator=(multiset &&ms) -> multiset & {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::operator=(multiset &&ms) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) -> multiset & {
   if (this != &ms) {
     tree_.clear();
     new (this) multiset{std::move(ms)};
@@ -88,10 +100,10 @@ auto multiset<K>::operator=(multiset &&ms) -> multiset & {
  * elements from the source multiset.
  *
  * @param[in] ms The multiset to copy from.
- * @return multiset<K>& - reference to the assigned multiset.
+ * @return multiset<K, C, L, R>& - reference to the assigned multiset.
  */
-template <typename K>
-auto multiset<K>::operator=(const multiset &ms) -> multiset & {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::operator=(const multiset &ms) -> multiset & {
   if (this != &ms) {
     tree_.clear();
     new (this) multiset{ms};
@@ -110,8 +122,8 @@ auto multiset<K>::operator=(const multiset &ms) -> multiset & {
  *
  * @return iterator - an iterator to the beginning of the multiset.
  */
-template <typename K>
-auto multiset<K>::begin() const noexcept -> iterator {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::begin() const noexcept -> iterator {
   return tree_.begin();
 }
 
@@ -124,8 +136,8 @@ auto multiset<K>::begin() const noexcept -> iterator {
  *
  * @return iterator - an iterator to the end of the multiset.
  */
-template <typename K>
-auto multiset<K>::end() const noexcept -> iterator {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::end() const noexcept -> iterator {
   return tree_.end();
 }
 
@@ -137,8 +149,8 @@ auto multiset<K>::end() const noexcept -> iterator {
  *
  * @return const_iterator - a const iterator to the beginning of the multiset.
  */
-template <typename K>
-auto multiset<K>::cbegin() const noexcept -> const_iterator {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::cbegin() const noexcept -> const_iterator {
   return tree_.cbegin();
 }
 
@@ -151,8 +163,8 @@ auto multiset<K>::cbegin() const noexcept -> const_iterator {
  *
  * @return const_iterator - a const iterator to the end of the multiset.
  */
-template <typename K>
-auto multiset<K>::cend() const noexcept -> const_iterator {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::cend() const noexcept -> const_iterator {
   return tree_.cend();
 }
 
@@ -167,8 +179,8 @@ auto multiset<K>::cend() const noexcept -> const_iterator {
  *
  * @return bool - true if the multiset is empty, false otherwise.
  */
-template <typename K>
-bool multiset<K>::empty() const noexcept {
+template <typename K, typename C, bool L, bool R>
+bool multiset<K, C, L, R>::empty() const noexcept {
   return (!tree_.size()) ? true : false;
 }
 
@@ -180,8 +192,8 @@ bool multiset<K>::empty() const noexcept {
  *
  * @return size_type - the number of elements in the multiset.
  */
-template <typename K>
-auto multiset<K>::size() const noexcept -> size_type {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::size() const noexcept -> size_type {
   return tree_.size();
 }
 
@@ -190,8 +202,8 @@ auto multiset<K>::size() const noexcept -> size_type {
  *
  * @return size_type - the maximum number of elements.
  */
-template <typename K>
-auto multiset<K>::max_size() const noexcept -> size_type {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::max_size() const noexcept -> size_type {
   return tree_.max_size();
 }
 
@@ -203,8 +215,8 @@ auto multiset<K>::max_size() const noexcept -> size_type {
  * @details
  * This method removes all elements from the multiset, leaving it empty.
  */
-template <typename K>
-void multiset<K>::clear() {
+template <typename K, typename C, bool L, bool R>
+void multiset<K, C, L, R>::clear() {
   tree_.clear();
 }
 
@@ -219,9 +231,20 @@ void multiset<K>::clear() {
  * @param[in] value The value to insert.
  * @return iterator - an iterator to the inserted element.
  */
-template <typename K>
-auto multiset<K>::insert(const_reference value) -> iterator {
-  return tree_.insert({value, value});
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::insert(const_reference value) -> iterator {
+  return tree_.insert({value, {}});
+}
+
+/**
+ * @brief Inserts a new element into the multiset, moving the given value.
+ *
+ * @param[in] value The value to insert.
+ * @return iterator - an iterator to the inserted element.
+ */
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::insert(std::remove_const_t<K> &&value) -> iterator {
+  return tree_.try_emplace(std::move(value)).first;
 }
 
 /**
@@ -234,8 +257,8 @@ auto multiset<K>::insert(const_reference value) -> iterator {
  * @return iterator - an iterator to the element following the erased element,
  * or end() if the erased element was the last element.
  */
-template <typename K>
-auto multiset<K>::erase(const_iterator pos) -> iterator {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::erase(const_iterator pos) -> iterator {
   return tree_.erase(pos);
 }
 
@@ -248,8 +271,9 @@ auto multiset<K>::erase(const_iterator pos) -> iterator {
  *
  * @param[in,out] other The multiset to swap with.
  */
-template <typename K>
-void multiset<K>::swap(multiset &other) {
+template <typename K, typename C, bool L, bool R>
+void multiset<K, C, L, R>::swap(multiset &other) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
   std::swap(tree_, other.tree_);
 }
 
@@ -263,8 +287,8 @@ void multiset<K>::swap(multiset &other) {
  *
  * @param[in,out] other The multiset to merge with.
  */
-template <typename K>
-void multiset<K>::merge(multiset &other) {
+template <typename K, typename C, bool L, bool R>
+void multiset<K, C, L, R>::merge(multiset &other) {
   tree_.merge(other.tree_);
 }
 
@@ -283,11 +307,13 @@ void multiset<K>::merge(multiset &other) {
  * @param args The arguments to forward to the constructor of the element.
  * @return An iterator to the inserted element.
  */
-template <typename K>
+template <typename K, typename C, bool L, bool R>
 template <typename... Args>
-auto multiset<K>::emplace(Args &&...args) -> iterator {
-  return (tree_.emplace(std::forward<Args>(args)...,
-                        std::forward<Args>(args)...))
+auto multiset<K, C, L, R>::emplace(Args &&...args) -> iterator {
+  return tree_
+      .emplace(std::piecewise_construct,
+               std::forward_as_tuple(std::forward<Args>(args)...),
+               std::tuple<>{})
       .first;
 }
 
@@ -296,23 +322,42 @@ auto multiset<K>::emplace(Args &&...args) -> iterator {
  *
  * @details
  * This method inserts new elements into the multiset and returns the result of
- * the insertion.
+ * the insertion. The elements are sorted and inserted as one batch, equal
+ * elements keep the order of the arguments.
  *
  * @param args The arguments are std::initializer_list of elements to insert.
  * @return A vector containing pairs of <iterator,bool>, where iterator is the
  * corresponding iterator of the element, bool is the result of insertion (true
  * if the element is inserted and false if the element is not inserted).
  */
-template <typename K>
+template <typename K, typename C, bool L, bool R>
 template <typename... Args>
-auto multiset<K>::insert_many(Args &&...args)
+auto multiset<K, C, L, R>::insert_many(Args &&...args)
     -> vector<std::pair<iterator, bool>> {
-  s21::vector<std::pair<iterator, bool>> v;
-  v.reserve(sizeof...(args));
-  ([&v, this](Args &&arg) { v.push_back(tree_.emplace(arg, arg)); }(
-       std::forward<Args>(args)),
-   ...);
-  return v;
+  return tree_.template insert_many<iterator>(
+      std::pair<key_type, std::monostate>{args, {}}...);
+}
+
+/**
+ * @brief Inserts the elements of the range [first, last) into the multiset.
+ *
+ * @details
+ * The range is sorted and inserted as one batch, the same way as by
+ * insert_many().
+ *
+ * @param[in] first The beginning of the range of elements.
+ * @param[in] last The end of the range of elements.
+ * @return A vector containing pairs of <iterator,bool> in the order of the
+ * range, where bool is the result of insertion.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename InputIt>
+auto multiset<K, C, L, R>::insert_range(InputIt first, InputIt last)
+    -> vector<std::pair<iterator, bool>> {
+  return tree_.template insert_range<iterator>(
+      first, last, [](const auto &item) {
+        return std::pair<key_type, std::monostate>{item, {}};
+      });
 }
 
 // MULTISET LOOKUP
@@ -322,24 +367,16 @@ auto multiset<K>::insert_many(Args &&...args)
  *
  * @details
  * This method returns the number of elements in the multiset with the specified
- * key.
+ * key. The equal elements are counted from the lower bound, so the cost is
+ * O(log n + count).
  *
  * @param[in] key The key to search for.
  * @return size_type - the number of elements with the specified key.
  */
-template <typename K>
-auto multiset<K>::count(const key_type &key) const noexcept -> size_type {
-  size_type cnt{};
-
-  for (auto i : *this) {
-    if (i == key) {
-      ++cnt;
-    } else if (cnt) {
-      break;
-    }
-  }
-
-  return cnt;
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::count(const key_type &key) const noexcept
+    -> size_type {
+  return tree_.count(key);
 }
 
 /**
@@ -354,8 +391,9 @@ auto multiset<K>::count(const key_type &key) const noexcept -> size_type {
  * @return iterator - an iterator to the element with the specified key, or
  * `end()` if the key is not found.
  */
-template <typename K>
-auto multiset<K>::find(const key_type &key) const noexcept -> iterator {
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::find(const key_type &key) const noexcept
+    -> iterator {
   return tree_.find(key);
 }
 
@@ -370,8 +408,8 @@ auto multiset<K>::find(const key_type &key) const noexcept -> iterator {
  * @return bool - true if the multiset contains an element with the specified
  * key, false otherwise.
  */
-template <typename K>
-bool multiset<K>::contains(const key_type &key) const noexcept {
+template <typename K, typename C, bool L, bool R>
+bool multiset<K, C, L, R>::contains(const key_type &key) const noexcept {
   return (tree_.find(key) != tree_.end()) ? true : false;
 }
 
@@ -387,27 +425,10 @@ bool multiset<K>::contains(const key_type &key) const noexcept {
  * @return iterator_range - a pair of iterators representing the range of
  * elements with the specified key.
  */
-template <typename K>
-auto multiset<K>::equal_range(const key_type &key) const noexcept
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::equal_range(const key_type &key) const noexcept
     -> iterator_range {
-  iterator first{end()};
-  iterator last{end()};
-  size_type cnt{};
-
-  for (iterator i = begin(); i != end(); ++i) {
-    if (*i == key && !cnt) {
-      first = i;
-      ++cnt;
-    } else if (*i > key) {
-      last = i;
-      if (!cnt) {
-        first = i;
-      }
-      break;
-    }
-  }
-
-  return iterator_range{first, last};
+  return iterator_range{tree_.lower_bound(key), tree_.upper_bound(key)};
 }
 
 /**
@@ -423,21 +444,9 @@ auto multiset<K>::equal_range(const key_type &key) const noexcept
  * @return iterator - an iterator to the first element not less than the
  * specified key.
  */
-template <typename K>
-auto multiset<K>::lower_bound(const key_type &key) -> iterator {
-  iterator first{end()};
-
-  for (iterator i = begin(); i != end(); ++i) {
-    if (*i == key) {
-      first = i;
-      break;
-    } else if (*i > key) {
-      first = i;
-      break;
-    }
-  }
-
-  return first;
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::lower_bound(const key_type &key) -> iterator {
+  return tree_.lower_bound(key);
 }
 
 /**
@@ -453,18 +462,163 @@ auto multiset<K>::lower_bound(const key_type &key) -> iterator {
  * @return iterator - an iterator to the first element greater than the
  * specified key.
  */
-template <typename K>
-auto multiset<K>::upper_bound(const key_type &key) -> iterator {
-  iterator last{end()};
+template <typename K, typename C, bool L, bool R>
+auto multiset<K, C, L, R>::upper_bound(const key_type &key) -> iterator {
+  return tree_.upper_bound(key);
+}
 
-  for (iterator i = begin(); i != end(); ++i) {
-    if (*i > key) {
-      last = i;
-      break;
-    }
-  }
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return C - a copy of the comparator.
+ */
+template <typename K, typename C, bool L, bool R>
+C multiset<K, C, L, R>::key_comp() const {
+  return tree_.key_comp();
+}
+
+// MULTISET VISITATION
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false; a function
+ * returning void always visits every element (see tree::for_each()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with each key.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename F>
+bool multiset<K, C, L, R>::for_each(F &&fn) const {
+  return tree_.for_each(
+      [&fn](const auto &pair) -> decltype(auto) { return fn(pair.first); });
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * Only the part of the tree overlapping the range is traversed, in ascending
+ * key order (see tree::for_each_in_range()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with each key.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename F>
+bool multiset<K, C, L, R>::for_each_in_range(const key_type &lo,
+                                             const key_type &hi,
+                                             F &&fn) const {
+  return tree_.for_each_in_range(
+      lo, hi,
+      [&fn](const auto &pair) -> decltype(auto) { return fn(pair.first); });
+}
+
+// MULTISET TRANSPARENT LOOKUP
+
+/**
+ * @brief Counts the elements equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator, so the value (for example a
+ * std::string_view in a multiset of std::string) is compared with the elements
+ * directly, without building a temporary key.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return size_type - the number of equivalent elements.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename Key, typename Cmp, typename>
+auto multiset<K, C, L, R>::count(const Key &key) const noexcept -> size_type {
+  return tree_.count(key);
+}
 
-  return last;
+/**
+ * @brief Searches for an element equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename Key, typename Cmp, typename>
+auto multiset<K, C, L, R>::find(const Key &key) const noexcept -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Checks if the multiset contains an element equivalent to the value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return bool - true if such an element is present, false otherwise.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename Key, typename Cmp, typename>
+bool multiset<K, C, L, R>::contains(const Key &key) const noexcept {
+  return tree_.find(key) != tree_.end();
+}
+
+/**
+ * @brief Returns the range of elements equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return iterator_range - a pair of iterators representing the range.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename Key, typename Cmp, typename>
+auto multiset<K, C, L, R>::equal_range(const Key &key) const noexcept
+    -> iterator_range {
+  return iterator_range{tree_.lower_bound(key), tree_.upper_bound(key)};
+}
+
+/**
+ * @brief Finds the first element that is not less than the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename Key, typename Cmp, typename>
+auto multiset<K, C, L, R>::lower_bound(const Key &key) -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Finds the first element that is greater than the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L, bool R>
+template <typename Key, typename Cmp, typename>
+auto multiset<K, C, L, R>::upper_bound(const Key &key) -> iterator {
+  return tree_.upper_bound(key);
 }
 
 /**
@@ -472,7 +626,7 @@ auto multiset<K>::upper_bound(const key_type &key) -> iterator {
  *
  * @return std::string - a string representation of the tree structure.
  */
-template <typename K>
-std::string multiset<K>::structure() const noexcept {
+template <typename K, typename C, bool L, bool R>
+std::string multiset<K, C, L, R>::structure() const noexcept {
   return tree_.structure();
 }
\ No newline at end of file
@@ -0,0 +1,235 @@
+/**
+ * @file persistent_map.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the persistent map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_persistent_map.h"
+
+using namespace s21;
+
+// PERSISTENT MAP CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty persistent map ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename V, typename C>
+persistent_map<K, V, C>::persistent_map(const C &comp) : tree_{comp} {}
+
+/**
+ * @brief Constructs a persistent map with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of key-value pairs to insert.
+ */
+template <typename K, typename V, typename C>
+persistent_map<K, V, C>::persistent_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    tree_ = tree_.insert(item);
+  }
+}
+
+/**
+ * @brief Wraps a version of the tree.
+ *
+ * @param[in] tree The version to wrap.
+ */
+template <typename K, typename V, typename C>
+persistent_map<K, V, C>::persistent_map(tree_type tree) noexcept
+    : tree_{std::move(tree)} {}
+
+// PERSISTENT MAP ELEMENT ACCESS
+
+/**
+ * @brief Returns the value of the element with the given key.
+ *
+ * @param[in] key The key of the element.
+ * @return const mapped_type& - the value of the element.
+ * @throws std::out_of_range if the key is not present.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::at(const key_type &key) const
+    -> const mapped_type & {
+  iterator it = tree_.find(key);
+
+  if (it == end()) {
+    throw std::out_of_range("persistent_map::at() - missing element");
+  }
+
+  return (*it).second;
+}
+
+// PERSISTENT MAP ITERATORS
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return iterator - an iterator to the first element.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::begin() const noexcept -> iterator {
+  return tree_.begin();
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return iterator - an iterator past the last element.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::end() const noexcept -> iterator {
+  return tree_.end();
+}
+
+// PERSISTENT MAP CAPACITY
+
+/**
+ * @brief Checks whether the persistent map is empty.
+ *
+ * @return bool - true if there are no elements, false otherwise.
+ */
+template <typename K, typename V, typename C>
+bool persistent_map<K, V, C>::empty() const noexcept {
+  return !tree_.size();
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::size() const noexcept -> size_type {
+  return tree_.size();
+}
+
+// PERSISTENT MAP VERSIONS
+
+/**
+ * @brief Returns a version with the element inserted if its key is absent.
+ *
+ * @param[in] value The key-value pair to insert.
+ * @return persistent_map - the new version.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::insert(const_reference value) const
+    -> persistent_map {
+  return persistent_map{tree_.insert(value)};
+}
+
+/**
+ * @brief Returns a version with the element inserted if its key is absent.
+ *
+ * @param[in] key The key of the element.
+ * @param[in] obj The value of the element.
+ * @return persistent_map - the new version.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::insert(const key_type &key,
+                                     const mapped_type &obj) const
+    -> persistent_map {
+  return insert({key, obj});
+}
+
+/**
+ * @brief Returns a version with the element inserted or its value replaced.
+ *
+ * @param[in] key The key of the element.
+ * @param[in] obj The value to insert or assign.
+ * @return persistent_map - the new version.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::insert_or_assign(const key_type &key,
+                                               const mapped_type &obj) const
+    -> persistent_map {
+  return persistent_map{tree_.insert_or_assign({key, obj})};
+}
+
+/**
+ * @brief Returns a version without the element with the given key.
+ *
+ * @param[in] key The key of the element to remove.
+ * @return persistent_map - the new version.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::erase(const key_type &key) const
+    -> persistent_map {
+  return persistent_map{tree_.erase(key)};
+}
+
+/**
+ * @brief Checks whether two versions share their root.
+ *
+ * @details
+ * An update that changes nothing (inserting a present key, erasing an absent
+ * one) returns a version sharing the root.
+ *
+ * @param[in] other The version to compare with.
+ * @return bool - true if the versions share the root, false otherwise.
+ */
+template <typename K, typename V, typename C>
+bool persistent_map<K, V, C>::shares_root(
+    const persistent_map &other) const noexcept {
+  return tree_.shares_root(other.tree_);
+}
+
+// PERSISTENT MAP LOOKUP
+
+/**
+ * @brief Searches for the element with the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the element, or end() if not found.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::find(const key_type &key) const -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Checks whether an element with the given key is present.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename V, typename C>
+bool persistent_map<K, V, C>::contains(const key_type &key) const {
+  return tree_.find(key) != end();
+}
+
+/**
+ * @brief Returns an iterator to the first element not less than the key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the element, or end() if there is none.
+ */
+template <typename K, typename V, typename C>
+auto persistent_map<K, V, C>::lower_bound(const key_type &key) const
+    -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a constant reference to each
+ * key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename V, typename C>
+template <typename F>
+bool persistent_map<K, V, C>::for_each(F &&fn) const {
+  return tree_.for_each(fn);
+}
\ No newline at end of file
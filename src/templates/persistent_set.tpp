@@ -0,0 +1,222 @@
+/**
+ * @file persistent_set.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the persistent set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_persistent_set.h"
+
+using namespace s21;
+
+// PERSISTENT SET CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty persistent set ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C>
+persistent_set<K, C>::persistent_set(const C &comp) : tree_{comp} {}
+
+/**
+ * @brief Constructs a persistent set with keys from an initializer list.
+ *
+ * @param[in] items The initializer list of keys to insert.
+ */
+template <typename K, typename C>
+persistent_set<K, C>::persistent_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    tree_ = tree_.insert({item, {}});
+  }
+}
+
+/**
+ * @brief Wraps a version of the tree.
+ *
+ * @param[in] tree The version to wrap.
+ */
+template <typename K, typename C>
+persistent_set<K, C>::persistent_set(tree_type tree) noexcept
+    : tree_{std::move(tree)} {}
+
+// PERSISTENT SET ITERATORS
+
+/**
+ * @brief Returns an iterator to the first key.
+ *
+ * @return iterator - an iterator to the first key.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::begin() const noexcept -> iterator {
+  return tree_.begin();
+}
+
+/**
+ * @brief Returns an iterator past the last key.
+ *
+ * @return iterator - an iterator past the last key.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::end() const noexcept -> iterator {
+  return tree_.end();
+}
+
+// PERSISTENT SET CAPACITY
+
+/**
+ * @brief Checks whether the persistent set is empty.
+ *
+ * @return bool - true if there are no keys, false otherwise.
+ */
+template <typename K, typename C>
+bool persistent_set<K, C>::empty() const noexcept {
+  return !tree_.size();
+}
+
+/**
+ * @brief Returns the number of keys.
+ *
+ * @return size_type - the number of keys.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::size() const noexcept -> size_type {
+  return tree_.size();
+}
+
+// PERSISTENT SET VERSIONS
+
+/**
+ * @brief Returns a version with the key inserted.
+ *
+ * @param[in] value The key to insert.
+ * @return persistent_set - the new version.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::insert(const_reference value) const
+    -> persistent_set {
+  return persistent_set{tree_.insert({value, {}})};
+}
+
+/**
+ * @brief Returns a version without the given key.
+ *
+ * @param[in] key The key to remove.
+ * @return persistent_set - the new version.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::erase(const key_type &key) const
+    -> persistent_set {
+  return persistent_set{tree_.erase(key)};
+}
+
+/**
+ * @brief Checks whether two versions share their root.
+ *
+ * @param[in] other The version to compare with.
+ * @return bool - true if the versions share the root, false otherwise.
+ */
+template <typename K, typename C>
+bool persistent_set<K, C>::shares_root(
+    const persistent_set &other) const noexcept {
+  return tree_.shares_root(other.tree_);
+}
+
+// PERSISTENT SET LOOKUP
+
+/**
+ * @brief Searches for the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the key, or end() if not found.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::find(const key_type &key) const -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Checks whether the key is present.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename C>
+bool persistent_set<K, C>::contains(const key_type &key) const {
+  return tree_.find(key) != tree_.end();
+}
+
+/**
+ * @brief Returns an iterator to the first key not less than the given one.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the key, or end() if there is none.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::lower_bound(const key_type &key) const
+    -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Calls a function for every key in ascending order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a constant reference to each key.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C>
+template <typename F>
+bool persistent_set<K, C>::for_each(F &&fn) const {
+  return tree_.for_each(
+      [&fn](const auto &pair) -> decltype(auto) { return fn(pair.first); });
+}
+
+// PERSISTENT SET ITERATOR OPERATORS
+
+/**
+ * @brief Pre-increment operator for the persistent set iterator.
+ *
+ * @return iterator& - reference to the incremented iterator.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::iterator::operator++() noexcept -> iterator & {
+  _tree_it::operator++();
+
+  return *this;
+}
+
+/**
+ * @brief Post-increment operator for the persistent set iterator.
+ *
+ * @return iterator - the original iterator before the increment.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::iterator::operator++(int) noexcept -> iterator {
+  iterator copy{*this};
+
+  _tree_it::operator++();
+
+  return copy;
+}
+
+/**
+ * @brief Dereference operator for the persistent set iterator.
+ *
+ * @return const_reference - const reference to the key at the current
+ * position.
+ */
+template <typename K, typename C>
+auto persistent_set<K, C>::iterator::operator*() const noexcept
+    -> const_reference {
+  return _tree_it::operator*().first;
+}
\ No newline at end of file
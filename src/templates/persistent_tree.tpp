@@ -0,0 +1,743 @@
+/**
+ * @file persistent_tree.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the persistent RB tree.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/persistent_tree.h"
+
+using namespace s21;
+
+// PERSISTENT TREE CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty tree ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::persistent_tree(const C &comp) : comp_{comp} {}
+
+/**
+ * @brief Constructs a version from its root.
+ *
+ * @param[in] root The root of the version.
+ * @param[in] size The number of elements under the root.
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::persistent_tree(Ref root, size_type size,
+                                          const C &comp)
+    : root_{std::move(root)}, size_{size}, comp_{comp} {}
+
+// PERSISTENT TREE ITERATORS
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return iterator - an iterator to the first element.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::begin() const noexcept -> iterator {
+  iterator it;
+
+  it.pushLeft(root_.get());
+
+  return it;
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return iterator - an iterator past the last element.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::end() const noexcept -> iterator {
+  return iterator{};
+}
+
+// PERSISTENT TREE CAPACITY
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::size() const noexcept -> size_type {
+  return size_;
+}
+
+// PERSISTENT TREE VERSIONS
+
+/**
+ * @brief Returns a version with the element inserted.
+ *
+ * @details
+ * If the key is already present, the returned version shares the root of
+ * this one.
+ *
+ * @param[in] pair The pair of key/value to insert.
+ * @return persistent_tree - the new version.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::insert(const value_type &pair) const
+    -> persistent_tree {
+  return update(pair, false);
+}
+
+/**
+ * @brief Returns a version with the element inserted or its value replaced.
+ *
+ * @param[in] pair The pair of key/value to insert or assign.
+ * @return persistent_tree - the new version.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::insert_or_assign(const value_type &pair) const
+    -> persistent_tree {
+  return update(pair, true);
+}
+
+/**
+ * @brief Returns a version without the element with the given key.
+ *
+ * @details
+ * If the key is not present, the returned version shares the root of this
+ * one.
+ *
+ * @param[in] key The key of the element to remove.
+ * @return persistent_tree - the new version.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::erase(const key_type &key) const
+    -> persistent_tree {
+  if (find(key) == end()) {
+    return *this;
+  }
+
+  return {recolor(eraseNode(root_, key), kBLACK), size_ - 1, comp_};
+}
+
+/**
+ * @brief Checks whether two versions share their root.
+ *
+ * @details
+ * Versions sharing the root hold the same elements. Versions with different
+ * roots may still share most of their subtrees.
+ *
+ * @param[in] other The version to compare with.
+ * @return bool - true if the versions share the root, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool persistent_tree<K, M, C>::shares_root(
+    const persistent_tree &other) const noexcept {
+  return root_.get() == other.root_.get();
+}
+
+// PERSISTENT TREE LOOKUP
+
+/**
+ * @brief Searches for the element with the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the element, or end() if not found.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::find(const key_type &key) const -> iterator {
+  iterator it = lower_bound(key);
+
+  if (it != end() && comp_(key, (*it).first)) {
+    it = end();
+  }
+
+  return it;
+}
+
+/**
+ * @brief Returns an iterator to the first element not less than the key.
+ *
+ * @details
+ * The descent pushes every node it leaves to the left, which are exactly the
+ * ancestors the iterator still has to visit.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the element, or end() if there is none.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::lower_bound(const key_type &key) const
+    -> iterator {
+  iterator it;
+  const Node *node = root_.get();
+
+  while (node) {
+    if (comp_(node->pair.first, key)) {
+      node = node->child[kRIGHT].get();
+    } else {
+      it.path_[it.depth_++] = node;
+      node = comp_(key, node->pair.first) ? node->child[kLEFT].get() : nullptr;
+    }
+  }
+
+  return it;
+}
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The function may return void, or a value convertible to bool that stops the
+ * traversal when false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a constant reference to each pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C>
+template <typename F>
+bool persistent_tree<K, M, C>::for_each(F &&fn) const {
+  return visitNode(root_.get(), fn);
+}
+
+// PERSISTENT TREE BUILD VERSIONS
+
+/**
+ * @brief Returns a version with the element inserted or assigned.
+ *
+ * @param[in] pair The pair of key/value to insert.
+ * @param[in] assign Whether to replace the value of a present key.
+ * @return persistent_tree - the new version.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::update(const value_type &pair,
+                                      bool assign) const -> persistent_tree {
+  bool changed = false;
+  bool inserted = false;
+  Ref root = insertNode(root_, pair, assign, changed, inserted);
+
+  if (!changed) {
+    return *this;
+  }
+
+  return {recolor(root, kBLACK), size_ + inserted, comp_};
+}
+
+/**
+ * @brief Builds a subtree with the element inserted or assigned.
+ *
+ * @details
+ * A new red leaf is balanced on the way back up: a black node with a red child
+ * and grandchild on the path is replaced by a red node with two black
+ * children, which moves the violation two levels up until it reaches the
+ * root, which is blackened. Unchanged subtrees are returned as they are.
+ *
+ * @param[in] node The root of the subtree.
+ * @param[in] pair The pair of key/value to insert.
+ * @param[in] assign Whether to replace the value of a present key.
+ * @param[out] changed Set if the subtree changed.
+ * @param[out] inserted Set if a new element was added.
+ * @return Ref - the root of the new subtree.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::insertNode(const Ref &node,
+                                          const value_type &pair, bool assign,
+                                          bool &changed, bool &inserted) const
+    -> Ref {
+  if (!node) {
+    changed = inserted = true;
+
+    return makeNode(kRED, Ref{}, pair, Ref{});
+  }
+
+  const Ref &left = node->child[kLEFT];
+  const Ref &right = node->child[kRIGHT];
+  Ref result = node;
+
+  if (comp_(pair.first, node->pair.first)) {
+    Ref sub = insertNode(left, pair, assign, changed, inserted);
+
+    if (changed) {
+      result = (node->color == kBLACK)
+                   ? balance(std::move(sub), node->pair, right)
+                   : makeNode(kRED, std::move(sub), node->pair, right);
+    }
+  } else if (comp_(node->pair.first, pair.first)) {
+    Ref sub = insertNode(right, pair, assign, changed, inserted);
+
+    if (changed) {
+      result = (node->color == kBLACK)
+                   ? balance(left, node->pair, std::move(sub))
+                   : makeNode(kRED, left, node->pair, std::move(sub));
+    }
+  } else if (assign) {
+    changed = true;
+    result = makeNode(node->color, left, pair, right);
+  }
+
+  return result;
+}
+
+/**
+ * @brief Builds a subtree without the element with the given key.
+ *
+ * @details
+ * The key must be present. Removing from a black subtree makes it one black
+ * node shorter, which balanceLeft() and balanceRight() repair on the way back
+ * up; the removed node itself is replaced by the join of its children.
+ *
+ * @param[in] node The root of the subtree.
+ * @param[in] key The key of the element to remove.
+ * @return Ref - the root of the new subtree.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::eraseNode(const Ref &node,
+                                         const key_type &key) const -> Ref {
+  const Ref &left = node->child[kLEFT];
+  const Ref &right = node->child[kRIGHT];
+  Ref result;
+
+  if (comp_(key, node->pair.first)) {
+    result = isBlack(left)
+                 ? balanceLeft(eraseNode(left, key), node->pair, right)
+                 : makeNode(kRED, eraseNode(left, key), node->pair, right);
+  } else if (comp_(node->pair.first, key)) {
+    result = isBlack(right)
+                 ? balanceRight(left, node->pair, eraseNode(right, key))
+                 : makeNode(kRED, left, node->pair, eraseNode(right, key));
+  } else {
+    result = join(left, right);
+  }
+
+  return result;
+}
+
+// PERSISTENT TREE REBALANCING
+
+/**
+ * @brief Allocates a node.
+ *
+ * @param[in] color The color of the node.
+ * @param[in] left The left subtree.
+ * @param[in] pair The pair of key/value for node.
+ * @param[in] right The right subtree.
+ * @return Ref - the only reference to the node.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::makeNode(Colors color, Ref left,
+                                        const value_type &pair, Ref right)
+    -> Ref {
+  return Ref{new Node{color, std::move(left), pair, std::move(right)}};
+}
+
+/**
+ * @brief Returns a node of the given color with the same children.
+ *
+ * @param[in] node The node to recolor, or an empty reference.
+ * @param[in] color The color to give the node.
+ * @return Ref - the node itself if it already has the color, a copy otherwise.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::recolor(const Ref &node, Colors color) -> Ref {
+  if (!node || node->color == color) {
+    return node;
+  }
+
+  return makeNode(color, node->child[kLEFT], node->pair, node->child[kRIGHT]);
+}
+
+/**
+ * @brief Builds a black-rooted subtree, resolving a red-red violation.
+ *
+ * @details
+ * If a child and one of its children are both red, the three nodes are
+ * rebuilt as a red node with two black children. Otherwise the result is a
+ * black node over the given subtrees.
+ *
+ * @param[in] left The left subtree.
+ * @param[in] pair The pair of key/value for the root.
+ * @param[in] right The right subtree.
+ * @return Ref - the root of the subtree.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::balance(Ref left, const value_type &pair,
+                                       Ref right) -> Ref {
+  Ref result;
+
+  if (isRed(left) && isRed(right)) {
+    result = makeNode(kRED, recolor(left, kBLACK), pair,
+                      recolor(right, kBLACK));
+  } else if (isRed(left) && isRed(left->child[kLEFT])) {
+    result = makeNode(kRED, recolor(left->child[kLEFT], kBLACK),
+                      left->pair,
+                      makeNode(kBLACK, left->child[kRIGHT], pair, right));
+  } else if (isRed(left) && isRed(left->child[kRIGHT])) {
+    const Ref &mid = left->child[kRIGHT];
+
+    result = makeNode(
+        kRED, makeNode(kBLACK, left->child[kLEFT], left->pair,
+                       mid->child[kLEFT]),
+        mid->pair, makeNode(kBLACK, mid->child[kRIGHT], pair, right));
+  } else if (isRed(right) && isRed(right->child[kRIGHT])) {
+    result = makeNode(kRED, makeNode(kBLACK, left, pair, right->child[kLEFT]),
+                      right->pair, recolor(right->child[kRIGHT], kBLACK));
+  } else if (isRed(right) && isRed(right->child[kLEFT])) {
+    const Ref &mid = right->child[kLEFT];
+
+    result = makeNode(
+        kRED, makeNode(kBLACK, left, pair, mid->child[kLEFT]), mid->pair,
+        makeNode(kBLACK, mid->child[kRIGHT], right->pair,
+                 right->child[kRIGHT]));
+  } else {
+    result = makeNode(kBLACK, std::move(left), pair, std::move(right));
+  }
+
+  return result;
+}
+
+/**
+ * @brief Builds a subtree whose left subtree lost one black node.
+ *
+ * @param[in] left The shortened left subtree.
+ * @param[in] pair The pair of key/value for the root.
+ * @param[in] right The right subtree.
+ * @return Ref - the root of the subtree, one black node shorter than before
+ * the removal only if it is black.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::balanceLeft(Ref left, const value_type &pair,
+                                           Ref right) -> Ref {
+  Ref result;
+
+  if (isRed(left)) {
+    result = makeNode(kRED, recolor(left, kBLACK), pair, std::move(right));
+  } else if (isBlack(right)) {
+    result = balance(std::move(left), pair, recolor(right, kRED));
+  } else {
+    const Ref &mid = right->child[kLEFT];
+
+    result = makeNode(
+        kRED, makeNode(kBLACK, std::move(left), pair, mid->child[kLEFT]),
+        mid->pair,
+        balance(mid->child[kRIGHT], right->pair,
+                recolor(right->child[kRIGHT], kRED)));
+  }
+
+  return result;
+}
+
+/**
+ * @brief Builds a subtree whose right subtree lost one black node.
+ *
+ * @param[in] left The left subtree.
+ * @param[in] pair The pair of key/value for the root.
+ * @param[in] right The shortened right subtree.
+ * @return Ref - the root of the subtree, one black node shorter than before
+ * the removal only if it is black.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::balanceRight(Ref left, const value_type &pair,
+                                            Ref right) -> Ref {
+  Ref result;
+
+  if (isRed(right)) {
+    result = makeNode(kRED, std::move(left), pair, recolor(right, kBLACK));
+  } else if (isBlack(left)) {
+    result = balance(recolor(left, kRED), pair, std::move(right));
+  } else {
+    const Ref &mid = left->child[kRIGHT];
+
+    result = makeNode(
+        kRED,
+        balance(recolor(left->child[kLEFT], kRED), left->pair,
+                mid->child[kLEFT]),
+        mid->pair,
+        makeNode(kBLACK, mid->child[kRIGHT], pair, std::move(right)));
+  }
+
+  return result;
+}
+
+/**
+ * @brief Joins two subtrees of the same black height.
+ *
+ * @details
+ * Every key of the left subtree is less than every key of the right one. The
+ * result replaces their removed parent.
+ *
+ * @param[in] left The left subtree.
+ * @param[in] right The right subtree.
+ * @return Ref - the root of the joined subtree.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::join(const Ref &left, const Ref &right) -> Ref {
+  if (!left || !right) {
+    return left ? left : right;
+  }
+
+  Ref result;
+
+  if (left->color == right->color) {
+    Ref mid = join(left->child[kRIGHT], right->child[kLEFT]);
+    Colors color = left->color;
+
+    if (isRed(mid)) {
+      result = makeNode(
+          kRED, makeNode(color, left->child[kLEFT], left->pair,
+                         mid->child[kLEFT]),
+          mid->pair,
+          makeNode(color, mid->child[kRIGHT], right->pair,
+                   right->child[kRIGHT]));
+    } else if (color == kRED) {
+      result = makeNode(
+          kRED, left->child[kLEFT], left->pair,
+          makeNode(kRED, std::move(mid), right->pair, right->child[kRIGHT]));
+    } else {
+      result = balanceLeft(
+          left->child[kLEFT], left->pair,
+          makeNode(kBLACK, std::move(mid), right->pair,
+                   right->child[kRIGHT]));
+    }
+  } else if (isRed(right)) {
+    result = makeNode(kRED, join(left, right->child[kLEFT]), right->pair,
+                      right->child[kRIGHT]);
+  } else {
+    result = makeNode(kRED, left->child[kLEFT], left->pair,
+                      join(left->child[kRIGHT], right));
+  }
+
+  return result;
+}
+
+/**
+ * @brief Checks whether a subtree has a red root.
+ *
+ * @param[in] node The root of the subtree.
+ * @return bool - true if the root exists and is red, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool persistent_tree<K, M, C>::isRed(const Ref &node) noexcept {
+  return node && node->color == kRED;
+}
+
+/**
+ * @brief Checks whether a subtree has a black root.
+ *
+ * @param[in] node The root of the subtree.
+ * @return bool - true if the root exists and is black, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool persistent_tree<K, M, C>::isBlack(const Ref &node) noexcept {
+  return node && node->color == kBLACK;
+}
+
+// PERSISTENT TREE VISITATION
+
+/**
+ * @brief Calls a function for every element of a subtree in order.
+ *
+ * @tparam F The type of the function.
+ * @param[in] node The root of the subtree.
+ * @param[in] fn The function called with a constant reference to each pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C>
+template <typename F>
+bool persistent_tree<K, M, C>::visitNode(const Node *node, F &fn) {
+  if (!node) {
+    return true;
+  }
+
+  if (!visitNode(node->child[kLEFT].get(), fn)) {
+    return false;
+  }
+
+  if constexpr (std::is_void_v<std::invoke_result_t<F &,
+                                                    const value_type &>>) {
+    fn(node->pair);
+  } else if (!fn(node->pair)) {
+    return false;
+  }
+
+  return visitNode(node->child[kRIGHT].get(), fn);
+}
+
+// REF CONSTRUCTORS
+
+/**
+ * @brief Adopts a newly built node without incrementing its counter.
+ *
+ * @param[in] node The node to adopt.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::Ref::Ref(Node *node) noexcept : node_{node} {}
+
+/**
+ * @brief Copy constructor. Shares the node of another reference.
+ *
+ * @param[in] other The reference to copy.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::Ref::Ref(const Ref &other) noexcept
+    : node_{other.node_} {
+  if (node_) {
+    node_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Move constructor. Takes the node of another reference.
+ *
+ * @param[in] other The reference to move from, left empty.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::Ref::Ref(Ref &&other) noexcept
+    : node_{std::exchange(other.node_, nullptr)} {}
+
+/**
+ * @brief Assignment operator. Releases the held node.
+ *
+ * @param[in] other The reference to assign from.
+ * @return Ref& - a reference to this reference.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::Ref::operator=(Ref other) noexcept -> Ref & {
+  std::swap(node_, other.node_);
+
+  return *this;
+}
+
+/**
+ * @brief Destructor. Deletes the node with its last reference.
+ *
+ * @details
+ * The release ordering makes the writes of every owner visible to the thread
+ * deleting the node.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::Ref::~Ref() {
+  if (node_ && node_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete node_;
+  }
+}
+
+// REF ACCESS
+
+/**
+ * @brief Returns the referenced node.
+ *
+ * @return const Node* - the node, or nullptr for an empty reference.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::Ref::get() const noexcept -> const Node * {
+  return node_;
+}
+
+/**
+ * @brief Accesses the referenced node.
+ *
+ * @return const Node* - the node.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::Ref::operator->() const noexcept
+    -> const Node * {
+  return node_;
+}
+
+/**
+ * @brief Checks whether the reference holds a node.
+ *
+ * @return bool - true if it holds a node, false otherwise.
+ */
+template <typename K, typename M, typename C>
+persistent_tree<K, M, C>::Ref::operator bool() const noexcept {
+  return node_;
+}
+
+// PERSISTENT ITERATOR OPERATORS
+
+/**
+ * @brief Dereferences the iterator.
+ *
+ * @return const value_type& - the pair of the current element.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::PersistentIterator::operator*() const noexcept
+    -> const value_type & {
+  return path_[depth_ - 1]->pair;
+}
+
+/**
+ * @brief Moves to the next element.
+ *
+ * @details
+ * Pops the current node and pushes the left spine of its right subtree.
+ *
+ * @return iterator& - a reference to the updated iterator.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::PersistentIterator::operator++() noexcept
+    -> iterator & {
+  const Node *node = path_[--depth_];
+
+  pushLeft(node->child[kRIGHT].get());
+
+  return *this;
+}
+
+/**
+ * @brief Moves to the next element.
+ *
+ * @return iterator - a copy of the iterator before the move.
+ */
+template <typename K, typename M, typename C>
+auto persistent_tree<K, M, C>::PersistentIterator::operator++(int) noexcept
+    -> iterator {
+  iterator tmp = *this;
+
+  ++(*this);
+
+  return tmp;
+}
+
+/**
+ * @brief Checks whether two iterators point to the same element.
+ *
+ * @param[in] other The iterator to compare with.
+ * @return bool - true if they point to the same element, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool persistent_tree<K, M, C>::PersistentIterator::operator==(
+    const iterator &other) const noexcept {
+  return depth_ == other.depth_ &&
+         (!depth_ || path_[depth_ - 1] == other.path_[depth_ - 1]);
+}
+
+/**
+ * @brief Checks whether two iterators point to different elements.
+ *
+ * @param[in] other The iterator to compare with.
+ * @return bool - true if they point to different elements, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool persistent_tree<K, M, C>::PersistentIterator::operator!=(
+    const iterator &other) const noexcept {
+  return !(*this == other);
+}
+
+/**
+ * @brief Pushes a node and its chain of left children.
+ *
+ * @param[in] node The node to start from, or nullptr.
+ */
+template <typename K, typename M, typename C>
+void persistent_tree<K, M, C>::PersistentIterator::pushLeft(
+    const Node *node) noexcept {
+  for (; node; node = node->child[kLEFT].get()) {
+    path_[depth_++] = node;
+  }
+}
\ No newline at end of file
@@ -24,7 +24,7 @@ using namespace s21;
  *
  */
 template <typename T>
-queue<T>::queue() {
+queue<T>::queue() noexcept {
   Size = 0;
   head = nullptr;
   tail = nullptr;
@@ -76,7 +76,7 @@ queue<T>::queue(const queue &q) : queue() {
  * @param[in] q The queue to move from.
  */
 template <typename T>
-queue<T>::queue(queue &&q) : queue() {
+queue<T>::queue(queue &&q) noexcept : queue() {
   if (this != &q) {
     head = q.head;
     tail = q.tail;
@@ -136,10 +136,10 @@ queue<T> &queue<T>::operator=(const queue &q) {
  * @return queue<T>& - reference to the assigned queue.
  */
 template <typename T>
-queue<T> &queue<T>::operator=(queue &&q) {
+queue<T> &queue<T>::operator=(queue &&q) noexcept {
   if (this != &q) {
     queue<T> tmp(std::move(q));
-    *this = tmp;
+    swap(tmp);
   }
   return *this;
 }
@@ -279,9 +279,9 @@ void queue<T>::pop() {
  */
 template <typename T>
 void queue<T>::swap(queue &other) noexcept {
-  queue<T> temp(*this);
-  *this = other;
-  other = temp;
+  std::swap(head, other.head);
+  std::swap(tail, other.tail);
+  std::swap(Size, other.Size);
 }
 
 /**
@@ -0,0 +1,165 @@
+/**
+ * @file raw_storage.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the raw storage algorithms shared by the vectors.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/raw_storage.h"
+
+using namespace s21;
+
+// RAW STORAGE RELOCATION
+
+/**
+ * @brief Constructs the elements of a range in other storage.
+ *
+ * @details
+ * Trivially relocatable elements are copied bitwise with a single memcpy();
+ * the copies then own the resources and the source elements must not be
+ * destroyed. Other elements are moved when the move constructor of T cannot
+ * throw (or T cannot be copied), and copied otherwise: if a copy throws, the
+ * copies already made are destroyed and the source range is left unchanged,
+ * so a reallocation either succeeds or changes nothing.
+ *
+ * @param[in] first The first element to relocate.
+ * @param[in] last The element past the last one to relocate.
+ * @param[in] dest Uninitialized storage with room for the range.
+ */
+template <typename T>
+void raw_storage<T>::relocate(T *first, T *last, T *dest) {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), first, (last - first) * sizeof(T));
+    }
+  } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                       !std::is_copy_constructible_v<T>) {
+    std::uninitialized_move(first, last, dest);
+  } else {
+    std::uninitialized_copy(first, last, dest);
+  }
+}
+
+// RAW STORAGE INSERTION
+
+/**
+ * @brief Inserts count elements built by fill by shifting the tail in place.
+ *
+ * @details
+ * Requires kSHIFTS and room for count more elements past size. fill(dest)
+ * must construct count elements at dest, and destroy the ones it built if
+ * one of them throws. The elements are built past the end and then brought
+ * to index, so the arguments of fill may refer to the old elements.
+ *
+ * Trivially relocatable elements are set aside in a buffer while the tail is
+ * shifted with a single memmove(); the buffer is on the stack for small
+ * batches. Other elements are rotated into place, each element of the tail
+ * moving once.
+ *
+ * If fill throws nothing changes. If a move throws while rotating, size
+ * already counts the new elements and the elements are left valid in
+ * unspecified order.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] array The storage.
+ * @param[in,out] size The number of elements, increased by count.
+ * @param[in] index Position of the first new element, less than size.
+ * @param[in] count Number of elements to insert.
+ * @param[in] fill Callable constructing the elements.
+ */
+template <typename T>
+template <typename Fill>
+void raw_storage<T>::shiftIn(T *array, size_type &size, size_type index,
+                             size_type count, Fill &fill) {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    alignas(T) unsigned char stack[kSTASH];
+    size_type bytes = count * sizeof(T);
+    void *heap = (bytes > kSTASH) ? ::operator new(
+                                        bytes, std::align_val_t(alignof(T)))
+                                  : nullptr;
+    void *stash = (heap) ? heap : stack;
+
+    try {
+      fill(array + size);
+    } catch (...) {
+      ::operator delete(heap, std::align_val_t(alignof(T)));
+      throw;
+    }
+    std::memcpy(stash, static_cast<void *>(array + size), bytes);
+    std::memmove(static_cast<void *>(array + index + count), array + index,
+                 (size - index) * sizeof(T));
+    std::memcpy(static_cast<void *>(array + index), stash, bytes);
+    ::operator delete(heap, std::align_val_t(alignof(T)));
+    size += count;
+  } else if constexpr (std::is_move_assignable_v<T>) {
+    fill(array + size);
+    size += count;
+    std::rotate(array + index, array + size - count, array + size);
+  }
+}
+
+/**
+ * @brief Builds count elements in other storage and relocates the old ones
+ * around them.
+ *
+ * @details
+ * The new elements are built by fill at dest + index first, so the arguments
+ * of fill may refer to the old elements; then the old elements are relocated
+ * before and after them (see relocate()). If anything throws, the elements
+ * built in dest are destroyed and the old ones are unchanged; dest itself is
+ * left to the caller.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] array The storage of the old elements.
+ * @param[in] size The number of old elements.
+ * @param[in] index Position of the first new element, at most size.
+ * @param[in] count Number of elements to insert.
+ * @param[in] dest Uninitialized storage for size + count elements.
+ * @param[in] fill Callable constructing the elements.
+ */
+template <typename T>
+template <typename Fill>
+void raw_storage<T>::buildAround(T *array, size_type size, size_type index,
+                                 size_type count, T *dest, Fill &fill) {
+  fill(dest + index);
+  try {
+    relocate(array, array + index, dest);
+  } catch (...) {
+    std::destroy_n(dest + index, count);
+    throw;
+  }
+  try {
+    relocate(array + index, array + size, dest + index + count);
+  } catch (...) {
+    std::destroy_n(dest, index + count);
+    throw;
+  }
+}
+
+/**
+ * @brief Constructs one element from each argument in consecutive storage.
+ *
+ * @details
+ * If a constructor throws, the elements already built are destroyed.
+ *
+ * @tparam Args The types of the arguments.
+ * @param[in] dest Raw storage for sizeof...(Args) elements.
+ * @param args The arguments, one per element.
+ */
+template <typename T>
+template <typename... Args>
+void raw_storage<T>::constructEach(T *dest, Args &&...args) {
+  size_type built = 0;
+
+  try {
+    ((new (dest + built) T(std::forward<Args>(args)), ++built), ...);
+  } catch (...) {
+    std::destroy_n(dest, built);
+    throw;
+  }
+}
\ No newline at end of file
@@ -16,6 +16,14 @@ using namespace s21;
 
 // SET CONSTRUCTORS
 
+/**
+ * @brief Constructs an empty set ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C, bool L>
+set<K, C, L>::set(const C &comp) : tree_{comp} {}
+
 /**
  * @brief Constructs a set with elements from an initializer list.
  *
@@ -26,10 +34,10 @@ using namespace s21;
  *
  * @param[in] items The initializer list of values to insert into the set.
  */
-template <typename K>
-set<K>::set(std::initializer_list<value_type> const &items) {
+template <typename K, typename C, bool L>
+set<K, C, L>::set(std::initializer_list<value_type> const &items) {
   for (auto i : items) {
-    tree_.insert({i, i});
+    tree_.insert({i, {}});
   }
 }
 
@@ -42,8 +50,8 @@ set<K>::set(std::initializer_list<value_type> const &items) {
  *
  * @param[in] s The set to copy from.
  */
-template <typename K>
-set<K>::set(const set &s) : tree_{s.tree_} {}
+template <typename K, typename C, bool L>
+set<K, C, L>::set(const set &s) : tree_{s.tree_} {}
 
 /**
  * @brief Move constructor for the set.
@@ -55,8 +63,10 @@ set<K>::set(const set &s) : tree_{s.tree_} {}
  *
  * @param[in] s The set to move from.
  */
-template <typename K>
-set<K>::set(set &&s) : tree_{std::move(s.tree_)} {}
+template <typename K, typename C, bool L>
+set<K, C, L>::set(set &&s) noexcept(
+    std::is_nothrow_copy_constructible_v<C>)
+    : tree_{std::move(s.tree_)} {}
 
 /**
  * @brief Move assignment operator for the set.
@@ -67,10 +77,11 @@ set<K>::set(set &&s) : tree_{std::move(s.tree_)} {}
  * source set.
  *
  * @param[in] s The set to move from.
- * @return set<K>& - reference to the assigned set.
+ * @return set<K, C, L>& - reference to the assigned set.
  */
-template <typename K>
-set<K> &set<K>::operator=(set &&s) {
+template <typename K, typename C, bool L>
+set<K, C, L> &set<K, C, L>::operator=(set &&s) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
   if (this != &s) {
     tree_.clear();
     new (this) set{std::move(s)};
@@ -88,10 +99,10 @@ set<K> &set<K>::operator=(set &&s) {
  * source set.
  *
  * @param[in] s The set to copy from.
- * @return set<K>& - reference to the assigned set.
+ * @return set<K, C, L>& - reference to the assigned set.
  */
-template <typename K>
-set<K> &set<K>::operator=(const set &s) {
+template <typename K, typename C, bool L>
+set<K, C, L> &set<K, C, L>::operator=(const set &s) {
   if (this != &s) {
     tree_.clear();
     new (this) set{s};
@@ -110,8 +121,8 @@ set<K> &set<K>::operator=(const set &s) {
  *
  * @return iterator - an iterator to the beginning of the set.
  */
-template <typename K>
-auto set<K>::begin() const noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::begin() const noexcept -> iterator {
   return tree_.begin();
 }
 
@@ -124,8 +135,8 @@ auto set<K>::begin() const noexcept -> iterator {
  *
  * @return iterator - an iterator to the end of the set.
  */
-template <typename K>
-auto set<K>::end() const noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::end() const noexcept -> iterator {
   return tree_.end();
 }
 
@@ -137,8 +148,8 @@ auto set<K>::end() const noexcept -> iterator {
  *
  * @return const_iterator - a const iterator to the beginning of the set.
  */
-template <typename K>
-auto set<K>::cbegin() const noexcept -> const_iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::cbegin() const noexcept -> const_iterator {
   return tree_.cbegin();
 }
 
@@ -151,8 +162,8 @@ auto set<K>::cbegin() const noexcept -> const_iterator {
  *
  * @return const_iterator - a const iterator to the end of the set.
  */
-template <typename K>
-auto set<K>::cend() const noexcept -> const_iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::cend() const noexcept -> const_iterator {
   return tree_.cend();
 }
 
@@ -167,8 +178,8 @@ auto set<K>::cend() const noexcept -> const_iterator {
  *
  * @return bool - true if the set is empty, false otherwise.
  */
-template <typename K>
-bool set<K>::empty() const noexcept {
+template <typename K, typename C, bool L>
+bool set<K, C, L>::empty() const noexcept {
   return (!tree_.size()) ? true : false;
 }
 
@@ -180,8 +191,8 @@ bool set<K>::empty() const noexcept {
  *
  * @return size_type - the number of elements in the set.
  */
-template <typename K>
-auto set<K>::size() const noexcept -> size_type {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::size() const noexcept -> size_type {
   return tree_.size();
 }
 
@@ -190,8 +201,8 @@ auto set<K>::size() const noexcept -> size_type {
  *
  * @return size_type - the maximum number of elements.
  */
-template <typename K>
-auto set<K>::max_size() const noexcept -> size_type {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::max_size() const noexcept -> size_type {
   return tree_.max_size();
 }
 
@@ -203,8 +214,8 @@ auto set<K>::max_size() const noexcept -> size_type {
  * @details
  * This method removes all elements from the set, leaving it empty.
  */
-template <typename K>
-void set<K>::clear() {
+template <typename K, typename C, bool L>
+void set<K, C, L>::clear() {
   tree_.clear();
 }
 
@@ -220,14 +231,31 @@ void set<K>::clear() {
  * @return iterator_bool - a pair containing an iterator to the inserted element
  * and a bool indicating whether the insertion took place.
  */
-template <typename K>
-auto set<K>::insert(const_reference value) -> iterator_bool {
-  iterator it = tree_.insert({value, value});
+template <typename K, typename C, bool L>
+auto set<K, C, L>::insert(const_reference value) -> iterator_bool {
+  iterator it = tree_.insert({value, {}});
 
   return (it != end()) ? iterator_bool{it, true}
                        : iterator_bool{tree_.find(value), false};
 }
 
+/**
+ * @brief Inserts a new element into the set, moving the given value.
+ *
+ * @details
+ * The value is moved into the set only if it is not present yet, otherwise it
+ * is left intact.
+ *
+ * @param[in] value The value to insert.
+ * @return iterator_bool - a pair containing an iterator to the inserted element
+ * (or to the element that prevented the insertion) and a bool indicating
+ * whether the insertion took place.
+ */
+template <typename K, typename C, bool L>
+auto set<K, C, L>::insert(std::remove_const_t<K> &&value) -> iterator_bool {
+  return tree_.try_emplace(std::move(value));
+}
+
 /**
  * @brief Erases the element at the specified position.
  *
@@ -238,8 +266,8 @@ auto set<K>::insert(const_reference value) -> iterator_bool {
  * @return iterator - an iterator to the element following the erased element,
  * or end() if the erased element was the last element.
  */
-template <typename K>
-auto set<K>::erase(const_iterator pos) -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::erase(const_iterator pos) -> iterator {
   return tree_.erase(*pos);
 }
 
@@ -255,11 +283,48 @@ auto set<K>::erase(const_iterator pos) -> iterator {
  * element, or end() if the last erased element was the last element.
  * @throws std::range_error if the range is invalid.
  */
-template <typename K>
-auto set<K>::erase(const_iterator first, const_iterator last) -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::erase(const_iterator first, const_iterator last)
+    -> iterator {
   return tree_.erase(first, last);
 }
 
+/**
+ * @brief Erases the element with the specified key.
+ *
+ * @param[in] key The key of the element to erase.
+ * @return size_type - the number of elements erased.
+ */
+template <typename K, typename C, bool L>
+auto set<K, C, L>::erase(const key_type &key) -> size_type {
+  size_type count = tree_.count(key);
+
+  tree_.erase(key);
+
+  return count;
+}
+
+/**
+ * @brief Erases the element equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator, so the value does not have to
+ * be converted to key_type first.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return size_type - the number of elements erased.
+ */
+template <typename K, typename C, bool L>
+template <typename Key, typename Cmp, typename, typename>
+auto set<K, C, L>::erase(const Key &key) -> size_type {
+  size_type count = tree_.count(key);
+
+  tree_.erase(key);
+
+  return count;
+}
+
 /**
  * @brief Swaps the contents of the set with another set.
  *
@@ -268,8 +333,9 @@ auto set<K>::erase(const_iterator first, const_iterator last) -> iterator {
  *
  * @param[in,out] other The set to swap with.
  */
-template <typename K>
-void set<K>::swap(set &other) {
+template <typename K, typename C, bool L>
+void set<K, C, L>::swap(set &other) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
   std::swap(tree_, other.tree_);
 }
 
@@ -282,8 +348,8 @@ void set<K>::swap(set &other) {
  *
  * @param[in,out] other The set to merge with.
  */
-template <typename K>
-void set<K>::merge(set &other) {
+template <typename K, typename C, bool L>
+void set<K, C, L>::merge(set &other) {
   tree_.merge(other.tree_);
 }
 
@@ -304,11 +370,12 @@ void set<K>::merge(set &other) {
  * element that prevented the insertion) and a bool indicating whether the
  * insertion took place.
  */
-template <typename K>
+template <typename K, typename C, bool L>
 template <typename... Args>
-auto set<K>::emplace(Args &&...args) -> std::pair<iterator, bool> {
-  return tree_.emplace(std::forward<Args>(args)...,
-                       std::forward<Args>(args)...);
+auto set<K, C, L>::emplace(Args &&...args) -> std::pair<iterator, bool> {
+  return tree_.emplace(std::piecewise_construct,
+                       std::forward_as_tuple(std::forward<Args>(args)...),
+                       std::tuple<>{});
 }
 
 /**
@@ -316,22 +383,42 @@ auto set<K>::emplace(Args &&...args) -> std::pair<iterator, bool> {
  *
  * @details
  * This method inserts new elements into the set and returns the result of the
- * insertion.
+ * insertion. The elements are sorted and inserted as one batch, so the cost
+ * does not grow with a full tree descent per element.
  *
  * @param args The arguments are std::initializer_list of elements to insert.
  * @return A vector containing pairs of <iterator,bool>, where iterator is the
  * corresponding iterator of the element, bool is the result of insertion (true
  * if the element is inserted and false if the element is not inserted).
  */
-template <typename K>
+template <typename K, typename C, bool L>
 template <typename... Args>
-auto set<K>::insert_many(Args &&...args) -> vector<std::pair<iterator, bool>> {
-  s21::vector<std::pair<iterator, bool>> v;
-  v.reserve(sizeof...(args));
-  ([&v, this](Args &&arg) { v.push_back(tree_.emplace(arg, arg)); }(
-       std::forward<Args>(args)),
-   ...);
-  return v;
+auto set<K, C, L>::insert_many(Args &&...args)
+    -> vector<std::pair<iterator, bool>> {
+  return tree_.template insert_many<iterator>(
+      std::pair<key_type, std::monostate>{args, {}}...);
+}
+
+/**
+ * @brief Inserts the elements of the range [first, last) into the set.
+ *
+ * @details
+ * The range is sorted and inserted as one batch, the same way as by
+ * insert_many().
+ *
+ * @param[in] first The beginning of the range of elements.
+ * @param[in] last The end of the range of elements.
+ * @return A vector containing pairs of <iterator,bool> in the order of the
+ * range, where bool is the result of insertion.
+ */
+template <typename K, typename C, bool L>
+template <typename InputIt>
+auto set<K, C, L>::insert_range(InputIt first, InputIt last)
+    -> vector<std::pair<iterator, bool>> {
+  return tree_.template insert_range<iterator>(
+      first, last, [](const auto &item) {
+        return std::pair<key_type, std::monostate>{item, {}};
+      });
 }
 
 // SET LOOKUP
@@ -348,8 +435,8 @@ auto set<K>::insert_many(Args &&...args) -> vector<std::pair<iterator, bool>> {
  * @return iterator - an iterator to the element with the specified key, or
  * `end()` if the key is not found.
  */
-template <typename K>
-auto set<K>::find(const key_type &key) const noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::find(const key_type &key) const noexcept -> iterator {
   return tree_.find(key);
 }
 
@@ -364,11 +451,180 @@ auto set<K>::find(const key_type &key) const noexcept -> iterator {
  * @return bool - true if the set contains an element with the specified key,
  * false otherwise.
  */
-template <typename K>
-bool set<K>::contains(const key_type &key) const noexcept {
+template <typename K, typename C, bool L>
+bool set<K, C, L>::contains(const key_type &key) const noexcept {
   return (tree_.find(key) != tree_.end()) ? true : false;
 }
 
+/**
+ * @brief Counts the elements with the specified key.
+ *
+ * @param[in] key The key to search for.
+ * @return size_type - 1 if the key is present, 0 otherwise.
+ */
+template <typename K, typename C, bool L>
+auto set<K, C, L>::count(const key_type &key) const noexcept -> size_type {
+  return tree_.count(key);
+}
+
+/**
+ * @brief Finds the first element that is not less than the given key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L>
+auto set<K, C, L>::lower_bound(const key_type &key) const noexcept -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Finds the first element that is greater than the given key.
+ *
+ * @param[in] key The key to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L>
+auto set<K, C, L>::upper_bound(const key_type &key) const noexcept -> iterator {
+  return tree_.upper_bound(key);
+}
+
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return C - a copy of the comparator.
+ */
+template <typename K, typename C, bool L>
+C set<K, C, L>::key_comp() const {
+  return tree_.key_comp();
+}
+
+// SET VISITATION
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The function may stop the traversal early by returning false; a function
+ * returning void always visits every element (see tree::for_each()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with each key.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename F>
+bool set<K, C, L>::for_each(F &&fn) const {
+  return tree_.for_each(
+      [&fn](const auto &pair) -> decltype(auto) { return fn(pair.first); });
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * Only the part of the tree overlapping the range is traversed, in ascending
+ * key order (see tree::for_each_in_range()).
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with each key.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename F>
+bool set<K, C, L>::for_each_in_range(const key_type &lo, const key_type &hi,
+                                     F &&fn) const {
+  return tree_.for_each_in_range(
+      lo, hi,
+      [&fn](const auto &pair) -> decltype(auto) { return fn(pair.first); });
+}
+
+// SET TRANSPARENT LOOKUP
+
+/**
+ * @brief Searches for an element equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator, so the value (for example a
+ * std::string_view in a set of std::string) is compared with the elements
+ * directly, without building a temporary key.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto set<K, C, L>::find(const Key &key) const noexcept -> iterator {
+  return tree_.find(key);
+}
+
+/**
+ * @brief Counts the elements equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return size_type - 1 if such an element is present, 0 otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto set<K, C, L>::count(const Key &key) const noexcept -> size_type {
+  return tree_.count(key);
+}
+
+/**
+ * @brief Checks if the set contains an element equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to search for.
+ * @return bool - true if such an element is present, false otherwise.
+ */
+template <typename K, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+bool set<K, C, L>::contains(const Key &key) const noexcept {
+  return tree_.find(key) != tree_.end();
+}
+
+/**
+ * @brief Finds the first element that is not less than the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto set<K, C, L>::lower_bound(const Key &key) const noexcept -> iterator {
+  return tree_.lower_bound(key);
+}
+
+/**
+ * @brief Finds the first element that is greater than the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the value.
+ * @param[in] key The value to compare the elements with.
+ * @return iterator - an iterator to the found element, or `end()`.
+ */
+template <typename K, typename C, bool L>
+template <typename Key, typename Cmp, typename>
+auto set<K, C, L>::upper_bound(const Key &key) const noexcept -> iterator {
+  return tree_.upper_bound(key);
+}
+
 // SET ITERATOR OPERATORS
 
 /**
@@ -377,8 +633,9 @@ bool set<K>::contains(const key_type &key) const noexcept {
  * @param[in] other The iterator to assign from.
  * @return iterator& - reference to the assigned iterator.
  */
-template <typename K>
-auto set<K>::iterator::operator=(const iterator &other) noexcept -> iterator & {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator=(const iterator &other) noexcept
+    -> iterator & {
   this->ptr_ = other.ptr_;
   this->first_ = other.first_;
   this->last_ = other.last_;
@@ -391,8 +648,8 @@ auto set<K>::iterator::operator=(const iterator &other) noexcept -> iterator & {
  *
  * @return iterator& - reference to the incremented iterator.
  */
-template <typename K>
-auto set<K>::iterator::operator++() noexcept -> iterator & {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator++() noexcept -> iterator & {
   *this += 1;
 
   return *this;
@@ -403,8 +660,8 @@ auto set<K>::iterator::operator++() noexcept -> iterator & {
  *
  * @return iterator - the original iterator before the increment.
  */
-template <typename K>
-auto set<K>::iterator::operator++(int) noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator++(int) noexcept -> iterator {
   iterator copy{*this};
 
   *this += 1;
@@ -417,8 +674,8 @@ auto set<K>::iterator::operator++(int) noexcept -> iterator {
  *
  * @return iterator& - reference to the decremented iterator.
  */
-template <typename K>
-auto set<K>::iterator::operator--() noexcept -> iterator & {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator--() noexcept -> iterator & {
   *this -= 1;
 
   return *this;
@@ -429,8 +686,8 @@ auto set<K>::iterator::operator--() noexcept -> iterator & {
  *
  * @return iterator - the original iterator before the decrement.
  */
-template <typename K>
-auto set<K>::iterator::operator--(int) noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator--(int) noexcept -> iterator {
   iterator copy{*this};
 
   *this -= 1;
@@ -444,8 +701,9 @@ auto set<K>::iterator::operator--(int) noexcept -> iterator {
  * @param[in] shift The number of positions to shift.
  * @return iterator - the shifted iterator.
  */
-template <typename K>
-auto set<K>::iterator::operator+(size_type shift) const noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator+(size_type shift) const noexcept
+    -> iterator {
   return _tree_it{*this} + shift;
 }
 
@@ -455,8 +713,9 @@ auto set<K>::iterator::operator+(size_type shift) const noexcept -> iterator {
  * @param[in] shift The number of positions to shift.
  * @return iterator - the shifted iterator.
  */
-template <typename K>
-auto set<K>::iterator::operator-(size_type shift) const noexcept -> iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator-(size_type shift) const noexcept
+    -> iterator {
   return _tree_it{*this} - shift;
 }
 
@@ -465,8 +724,8 @@ auto set<K>::iterator::operator-(size_type shift) const noexcept -> iterator {
  *
  * @return reference - reference to the value at the current position.
  */
-template <typename K>
-auto set<K>::iterator::operator*() noexcept -> reference {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::iterator::operator*() noexcept -> reference {
   return (*this->ptr_->pair).first;
 }
 
@@ -478,9 +737,9 @@ auto set<K>::iterator::operator*() noexcept -> reference {
  * @param[in] other The const_iterator to assign from.
  * @return const_iterator& - reference to the assigned const_iterator.
  */
-template <typename K>
-auto set<K>::const_iterator::operator=(const const_iterator &other) noexcept
-    -> const_iterator & {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator=(
+    const const_iterator &other) noexcept -> const_iterator & {
   this->ptr_ = other.ptr_;
   this->first_ = other.first_;
   this->last_ = other.last_;
@@ -493,8 +752,8 @@ auto set<K>::const_iterator::operator=(const const_iterator &other) noexcept
  *
  * @return const_iterator& - reference to the incremented const_iterator.
  */
-template <typename K>
-auto set<K>::const_iterator::operator++() noexcept -> const_iterator & {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator++() noexcept -> const_iterator & {
   *this += 1;
 
   return *this;
@@ -505,8 +764,8 @@ auto set<K>::const_iterator::operator++() noexcept -> const_iterator & {
  *
  * @return const_iterator - the original const_iterator before the increment.
  */
-template <typename K>
-auto set<K>::const_iterator::operator++(int) noexcept -> const_iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator++(int) noexcept -> const_iterator {
   const_iterator copy{*this};
 
   *this += 1;
@@ -519,8 +778,8 @@ auto set<K>::const_iterator::operator++(int) noexcept -> const_iterator {
  *
  * @return const_iterator& - reference to the decremented const_iterator.
  */
-template <typename K>
-auto set<K>::const_iterator::operator--() noexcept -> const_iterator & {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator--() noexcept -> const_iterator & {
   *this -= 1;
 
   return *this;
@@ -531,8 +790,8 @@ auto set<K>::const_iterator::operator--() noexcept -> const_iterator & {
  *
  * @return const_iterator - the original const_iterator before the decrement.
  */
-template <typename K>
-auto set<K>::const_iterator::operator--(int) noexcept -> const_iterator {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator--(int) noexcept -> const_iterator {
   const_iterator copy{*this};
 
   *this -= 1;
@@ -546,8 +805,8 @@ auto set<K>::const_iterator::operator--(int) noexcept -> const_iterator {
  * @param[in] shift The number of positions to shift.
  * @return const_iterator - the shifted const_iterator.
  */
-template <typename K>
-auto set<K>::const_iterator::operator+(size_type shift) const noexcept
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator+(size_type shift) const noexcept
     -> const_iterator {
   return _tree_cit{*this} + shift;
 }
@@ -558,8 +817,8 @@ auto set<K>::const_iterator::operator+(size_type shift) const noexcept
  * @param[in] shift The number of positions to shift.
  * @return const_iterator - the shifted const_iterator.
  */
-template <typename K>
-auto set<K>::const_iterator::operator-(size_type shift) const noexcept
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator-(size_type shift) const noexcept
     -> const_iterator {
   return _tree_cit{*this} - shift;
 }
@@ -570,7 +829,8 @@ auto set<K>::const_iterator::operator-(size_type shift) const noexcept
  * @return const_reference - const reference to the value at the current
  * position.
  */
-template <typename K>
-auto set<K>::const_iterator::operator*() const noexcept -> const_reference {
+template <typename K, typename C, bool L>
+auto set<K, C, L>::const_iterator::operator*() const noexcept
+    -> const_reference {
   return (*this->ptr_->pair).first;
 }
\ No newline at end of file
@@ -0,0 +1,675 @@
+/**
+ * @file skiplist_map.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the lock-free skip list map container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_skiplist_map.h"
+
+using namespace s21;
+
+// SKIPLIST MAP CONSTRUCTORS/DESTRUCTOR
+
+/**
+ * @brief Constructs an empty skip list map ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename M, typename C>
+skiplist_map<K, M, C>::skiplist_map(const C &comp) : comp_{comp} {}
+
+/**
+ * @brief Constructs a skip list map with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of key-value pairs to insert.
+ */
+template <typename K, typename M, typename C>
+skiplist_map<K, M, C>::skiplist_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+/**
+ * @brief Destructor. Deletes the linked nodes.
+ *
+ * @details
+ * No other thread may use the map any more. Erased nodes are not linked and
+ * are deleted by the epoch_domain.
+ */
+template <typename K, typename M, typename C>
+skiplist_map<K, M, C>::~skiplist_map() {
+  for (Node *node = pointer(head_[0].load()); node;) {
+    Node *next = pointer(node->link(0).load());
+
+    deleteNode(node);
+    node = next;
+  }
+}
+
+// SKIPLIST MAP ELEMENT ACCESS
+
+/**
+ * @brief Returns a copy of the value of the element with the given key.
+ *
+ * @param[in] key The key of the element.
+ * @return mapped_type - a copy of the value of the element.
+ * @throws std::out_of_range if the key is not present.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::at(const key_type &key) const -> mapped_type {
+  epoch_guard guard;
+  Link *preds[kMAX_LEVEL];
+  Node *succs[kMAX_LEVEL];
+
+  if (!findNode(key, preds, succs, false)) {
+    throw std::out_of_range("skiplist_map::at() - missing element");
+  }
+
+  return succs[0]->pair.second;
+}
+
+// SKIPLIST MAP ITERATORS
+
+/**
+ * @brief Returns an iterator to the first element.
+ *
+ * @return iterator - an iterator to the first element.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::begin() const -> iterator {
+  epoch_guard guard;
+
+  return iterator{firstFrom(head_[0].load())};
+}
+
+/**
+ * @brief Returns an iterator past the last element.
+ *
+ * @return iterator - an iterator past the last element.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::end() const noexcept -> iterator {
+  return iterator{};
+}
+
+// SKIPLIST MAP CAPACITY
+
+/**
+ * @brief Checks whether the skip list map is empty.
+ *
+ * @return bool - true if there are no elements, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool skiplist_map<K, M, C>::empty() const noexcept {
+  return !size_.load();
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @details
+ * The counter is updated right after each insertion and removal, so under
+ * concurrent updates it may briefly lag behind them.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::size() const noexcept -> size_type {
+  return size_.load();
+}
+
+// SKIPLIST MAP MODIFIERS
+
+/**
+ * @brief Removes every element present when it is reached.
+ *
+ * @details
+ * Elements inserted concurrently may survive.
+ */
+template <typename K, typename M, typename C>
+void skiplist_map<K, M, C>::clear() {
+  epoch_guard guard;
+
+  for (Node *node = firstFrom(head_[0].load()); node;
+       node = firstFrom(node->link(0).load())) {
+    erase(node->pair.first);
+  }
+}
+
+/**
+ * @brief Inserts an element if its key is not present.
+ *
+ * @details
+ * The element is linked into the bottom list with one compare-and-swap,
+ * which is the moment it becomes present, and its tower is linked upwards
+ * afterwards (see linkTower()).
+ *
+ * @param[in] value The key-value pair to insert.
+ * @return iterator_bool - an iterator to the element with the key and whether
+ * the insertion took place.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::insert(const_reference value) -> iterator_bool {
+  epoch_guard guard;
+  Link *preds[kMAX_LEVEL];
+  Node *succs[kMAX_LEVEL];
+  Node *node = nullptr;
+  size_type height = randomHeight();
+
+  for (size_type top = height_.load();
+       top < height && !height_.compare_exchange_weak(top, height);) {
+  }
+
+  while (true) {
+    if (findNode(value.first, preds, succs, false)) {
+      if (node) {
+        deleteNode(node);
+      }
+
+      return {iterator{succs[0]}, false};
+    }
+
+    if (!node) {
+      node = makeNode(value, height);
+    }
+
+    for (size_type level = 0; level < node->height; ++level) {
+      node->link(level).store(pack(succs[level]), std::memory_order_relaxed);
+    }
+
+    std::uintptr_t expected = pack(succs[0]);
+
+    if (preds[0][0].compare_exchange_strong(expected, pack(node))) {
+      break;
+    }
+  }
+
+  ++size_;
+  linkTower(node, preds, succs);
+
+  iterator it{node};
+
+  releaseNode(node);
+
+  return {it, true};
+}
+
+/**
+ * @brief Inserts an element if its key is not present.
+ *
+ * @param[in] key The key of the element.
+ * @param[in] obj The value of the element.
+ * @return iterator_bool - an iterator to the element with the key and whether
+ * the insertion took place.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::insert(const key_type &key,
+                                   const mapped_type &obj) -> iterator_bool {
+  return insert({key, obj});
+}
+
+/**
+ * @brief Removes the element with the given key.
+ *
+ * @details
+ * The links of the tower are marked from the top down; marking the bottom
+ * link is the moment the element is removed, and only one thread succeeds
+ * in it. That thread then unlinks the node from every level it can reach.
+ *
+ * @param[in] key The key of the element to remove.
+ * @return size_type - the number of removed elements (0 or 1).
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::erase(const key_type &key) -> size_type {
+  epoch_guard guard;
+  Link *preds[kMAX_LEVEL];
+  Node *succs[kMAX_LEVEL];
+
+  if (!findNode(key, preds, succs, false)) {
+    return 0;
+  }
+
+  Node *victim = succs[0];
+
+  for (size_type level = victim->height; level-- > 1;) {
+    std::uintptr_t next = victim->link(level).load();
+
+    while (!isMarked(next) &&
+           !victim->link(level).compare_exchange_weak(next, next | 1)) {
+    }
+  }
+
+  std::uintptr_t next = victim->link(0).load();
+
+  while (!isMarked(next)) {
+    if (victim->link(0).compare_exchange_weak(next, next | 1)) {
+      --size_;
+      findNode(key, preds, succs, true);
+      releaseNode(victim);
+
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+// SKIPLIST MAP LOOKUP
+
+/**
+ * @brief Searches for the element with the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the element, or end() if not found.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::find(const key_type &key) const -> iterator {
+  epoch_guard guard;
+  Link *preds[kMAX_LEVEL];
+  Node *succs[kMAX_LEVEL];
+
+  if (!findNode(key, preds, succs, false)) {
+    return end();
+  }
+
+  return iterator{succs[0]};
+}
+
+/**
+ * @brief Checks whether an element with the given key is present.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool skiplist_map<K, M, C>::contains(const key_type &key) const {
+  epoch_guard guard;
+  Link *preds[kMAX_LEVEL];
+  Node *succs[kMAX_LEVEL];
+
+  return findNode(key, preds, succs, false);
+}
+
+/**
+ * @brief Returns an iterator to the first element not less than the key.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the element, or end() if there is none.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::lower_bound(const key_type &key) const
+    -> iterator {
+  epoch_guard guard;
+  Link *preds[kMAX_LEVEL];
+  Node *succs[kMAX_LEVEL];
+
+  findNode(key, preds, succs, false);
+
+  return iterator{succs[0]};
+}
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * The traversal is weakly consistent, like an iterator, and the function may
+ * stop it early by returning false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a constant reference to each
+ * key-value pair.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C>
+template <typename F>
+bool skiplist_map<K, M, C>::for_each(F &&fn) const {
+  epoch_guard guard;
+
+  for (Node *node = firstFrom(head_[0].load()); node;
+       node = firstFrom(node->link(0).load())) {
+    if constexpr (std::is_void_v<std::invoke_result_t<F &, const_reference>>) {
+      fn(std::as_const(node->pair));
+    } else if (!fn(std::as_const(node->pair))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// SKIPLIST MAP SEARCH
+
+/**
+ * @brief Finds the neighbours of a key at every level.
+ *
+ * @details
+ * Descends from the greatest tower height reached so far, which insert()
+ * raises before searching for a taller node, so the levels above it are
+ * empty. Every marked node met on the way is unlinked at that level; if the
+ * unlinking fails because the predecessor changed, the search restarts. With
+ * through set, nodes with an equivalent key are passed too, which reaches
+ * every marked copy of the key: the thread unlinking a node relies on it.
+ *
+ * @param[in] key The key to search for.
+ * @param[out] preds The links of the last node before the key, per level up
+ * to the greatest height.
+ * @param[out] succs The first node at or after the key, per level up to the
+ * greatest height.
+ * @param[in] through Whether to pass the nodes with an equivalent key.
+ * @return bool - true if an unmarked node with the key was found at the
+ * bottom (and through is false), false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool skiplist_map<K, M, C>::findNode(const key_type &key, Link **preds,
+                                     Node **succs, bool through) const {
+  bool retry = true;
+
+  while (retry) {
+    Link *pred = head_;
+
+    retry = false;
+
+    for (size_type level = height_.load(); !retry && level-- > 0;) {
+      Node *curr = pointer(pred[level].load());
+
+      while (curr) {
+        std::uintptr_t succ = curr->link(level).load();
+
+        if (isMarked(succ)) {
+          std::uintptr_t expected = pack(curr);
+
+          retry = !pred[level].compare_exchange_strong(
+              expected, pack(pointer(succ)));
+
+          if (retry) {
+            break;
+          }
+
+          curr = pointer(succ);
+        } else if (comp_(curr->pair.first, key) ||
+                   (through && !comp_(key, curr->pair.first))) {
+          pred = &curr->link(0);
+          curr = pointer(succ);
+        } else {
+          break;
+        }
+      }
+
+      preds[level] = pred;
+      succs[level] = curr;
+    }
+  }
+
+  return !through && succs[0] && !comp_(key, succs[0]->pair.first);
+}
+
+/**
+ * @brief Links the tower of a newly inserted node above the bottom level.
+ *
+ * @details
+ * Each level is linked with a compare-and-swap on the predecessor, searching
+ * again when it fails. Linking stops as soon as the node turns out to be
+ * erased. A node erased while its tower was being built may have been linked
+ * at a level after the eraser unlinked it, so it is unlinked once more here.
+ *
+ * @param[in] node The inserted node.
+ * @param[in] preds The links of the predecessors found for the node.
+ * @param[in] succs The successors found for the node.
+ */
+template <typename K, typename M, typename C>
+void skiplist_map<K, M, C>::linkTower(Node *node, Link **preds,
+                                      Node **succs) {
+  bool erased = false;
+
+  for (size_type level = 1; !erased && level < node->height; ++level) {
+    while (true) {
+      std::uintptr_t next = node->link(level).load();
+
+      erased = isMarked(next) ||
+               (pointer(next) != succs[level] &&
+                !node->link(level).compare_exchange_strong(
+                    next, pack(succs[level])));
+
+      std::uintptr_t expected = pack(succs[level]);
+
+      if (erased ||
+          preds[level][level].compare_exchange_strong(expected, pack(node))) {
+        break;
+      }
+
+      findNode(node->pair.first, preds, succs, false);
+    }
+  }
+
+  if (isMarked(node->link(0).load())) {
+    findNode(node->pair.first, preds, succs, true);
+  }
+}
+
+/**
+ * @brief Returns the first unmarked node from a link on, at the bottom.
+ *
+ * @param[in] link The link to start from.
+ * @return Node* - the node, or nullptr if there is none.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::firstFrom(std::uintptr_t link) noexcept
+    -> Node * {
+  Node *node = pointer(link);
+
+  while (node && isMarked(link = node->link(0).load())) {
+    node = pointer(link);
+  }
+
+  return node;
+}
+
+// SKIPLIST MAP NODES
+
+/**
+ * @brief Allocates a node with its tower.
+ *
+ * @param[in] pair The pair of key/value for node.
+ * @param[in] height The number of links of the tower.
+ * @return Node* - the node, owned by its inserter and its future eraser.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::makeNode(const value_type &pair, size_type height)
+    -> Node * {
+  void *raw = ::operator new(sizeof(Node) + height * sizeof(Link));
+  Node *node = nullptr;
+
+  try {
+    node = new (raw) Node{pair, height};
+  } catch (...) {
+    ::operator delete(raw);
+    throw;
+  }
+
+  for (size_type level = 0; level < height; ++level) {
+    new (&node->link(level)) Link{0};
+  }
+
+  return node;
+}
+
+/**
+ * @brief Deletes a node and its tower.
+ *
+ * @param[in] node The node to delete.
+ */
+template <typename K, typename M, typename C>
+void skiplist_map<K, M, C>::deleteNode(void *node) noexcept {
+  static_cast<Node *>(node)->~Node();
+  ::operator delete(node);
+}
+
+/**
+ * @brief Drops one owner of a node and retires the node with the last one.
+ *
+ * @details
+ * The inserter owns the node until its tower is built and the eraser until
+ * the node is unlinked, so the node is retired once both are done.
+ *
+ * @param[in] node The node to release.
+ */
+template <typename K, typename M, typename C>
+void skiplist_map<K, M, C>::releaseNode(Node *node) noexcept {
+  if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    epoch_domain::instance().retire(node, deleteNode);
+  }
+}
+
+/**
+ * @brief Draws the height of a new tower.
+ *
+ * @details
+ * Each level is kept with probability 1/2, from a xorshift generator of the
+ * calling thread.
+ *
+ * @return size_type - the height, from 1 to kMAX_LEVEL.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::randomHeight() noexcept -> size_type {
+  thread_local std::uint64_t state =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) | 1;
+  size_type height = 1;
+
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+
+  for (std::uint64_t bits = state; height < kMAX_LEVEL && (bits & 1);
+       bits >>= 1) {
+    ++height;
+  }
+
+  return height;
+}
+
+/**
+ * @brief Returns the node a link points to.
+ *
+ * @param[in] link The link.
+ * @return Node* - the node, whatever the mark.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::pointer(std::uintptr_t link) noexcept -> Node * {
+  return reinterpret_cast<Node *>(link & ~std::uintptr_t{1});
+}
+
+/**
+ * @brief Checks whether a link marks its owner as deleted.
+ *
+ * @param[in] link The link.
+ * @return bool - true if the link is marked, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool skiplist_map<K, M, C>::isMarked(std::uintptr_t link) noexcept {
+  return link & 1;
+}
+
+/**
+ * @brief Makes an unmarked link to a node.
+ *
+ * @param[in] node The node, or nullptr.
+ * @return std::uintptr_t - the link.
+ */
+template <typename K, typename M, typename C>
+std::uintptr_t skiplist_map<K, M, C>::pack(Node *node) noexcept {
+  return reinterpret_cast<std::uintptr_t>(node);
+}
+
+// SKIPLIST ITERATOR
+
+/**
+ * @brief Constructs an iterator to a node, pinning the epoch of the thread.
+ *
+ * @param[in] node The node, or nullptr for end().
+ */
+template <typename K, typename M, typename C>
+skiplist_map<K, M, C>::SkiplistIterator::SkiplistIterator(Node *node)
+    : node_{node} {
+  if (node_) {
+    guard_.emplace();
+  }
+}
+
+/**
+ * @brief Dereferences the iterator.
+ *
+ * @return const_reference - the key-value pair of the current element.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::SkiplistIterator::operator*() const noexcept
+    -> const_reference {
+  return node_->pair;
+}
+
+/**
+ * @brief Moves to the next element present.
+ *
+ * @details
+ * Follows the bottom link even if the current element was erased
+ * meanwhile: the links of an erased node still lead forward in key order.
+ *
+ * @return iterator& - a reference to the updated iterator.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::SkiplistIterator::operator++() noexcept
+    -> iterator & {
+  node_ = firstFrom(node_->link(0).load());
+
+  if (!node_) {
+    guard_.reset();
+  }
+
+  return *this;
+}
+
+/**
+ * @brief Moves to the next element present.
+ *
+ * @return iterator - a copy of the iterator before the move.
+ */
+template <typename K, typename M, typename C>
+auto skiplist_map<K, M, C>::SkiplistIterator::operator++(int) noexcept
+    -> iterator {
+  iterator tmp = *this;
+
+  ++(*this);
+
+  return tmp;
+}
+
+/**
+ * @brief Checks whether two iterators point to the same element.
+ *
+ * @param[in] other The iterator to compare with.
+ * @return bool - true if they point to the same element, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool skiplist_map<K, M, C>::SkiplistIterator::operator==(
+    const iterator &other) const noexcept {
+  return node_ == other.node_;
+}
+
+/**
+ * @brief Checks whether two iterators point to different elements.
+ *
+ * @param[in] other The iterator to compare with.
+ * @return bool - true if they point to different elements, false otherwise.
+ */
+template <typename K, typename M, typename C>
+bool skiplist_map<K, M, C>::SkiplistIterator::operator!=(
+    const iterator &other) const noexcept {
+  return node_ != other.node_;
+}
\ No newline at end of file
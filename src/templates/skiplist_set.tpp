@@ -0,0 +1,210 @@
+/**
+ * @file skiplist_set.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the lock-free skip list set container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_skiplist_set.h"
+
+using namespace s21;
+
+// SKIPLIST SET CONSTRUCTORS
+
+/**
+ * @brief Constructs an empty skip list set ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ */
+template <typename K, typename C>
+skiplist_set<K, C>::skiplist_set(const C &comp) : map_{comp} {}
+
+/**
+ * @brief Constructs a skip list set with keys from an initializer list.
+ *
+ * @param[in] items The initializer list of keys to insert.
+ */
+template <typename K, typename C>
+skiplist_set<K, C>::skiplist_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &item : items) {
+    insert(item);
+  }
+}
+
+// SKIPLIST SET ITERATORS
+
+/**
+ * @brief Returns an iterator to the first key.
+ *
+ * @return iterator - an iterator to the first key.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::begin() const -> iterator {
+  return map_.begin();
+}
+
+/**
+ * @brief Returns an iterator past the last key.
+ *
+ * @return iterator - an iterator past the last key.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::end() const noexcept -> iterator {
+  return map_.end();
+}
+
+// SKIPLIST SET CAPACITY
+
+/**
+ * @brief Checks whether the skip list set is empty.
+ *
+ * @return bool - true if there are no keys, false otherwise.
+ */
+template <typename K, typename C>
+bool skiplist_set<K, C>::empty() const noexcept {
+  return map_.empty();
+}
+
+/**
+ * @brief Returns the number of keys.
+ *
+ * @return size_type - the number of keys.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::size() const noexcept -> size_type {
+  return map_.size();
+}
+
+// SKIPLIST SET MODIFIERS
+
+/**
+ * @brief Removes every key present when it is reached.
+ */
+template <typename K, typename C>
+void skiplist_set<K, C>::clear() {
+  map_.clear();
+}
+
+/**
+ * @brief Inserts a key if it is not present.
+ *
+ * @param[in] value The key to insert.
+ * @return iterator_bool - an iterator to the key and whether the insertion
+ * took place.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::insert(const_reference value) -> iterator_bool {
+  auto [it, inserted] = map_.insert({value, {}});
+
+  return {it, inserted};
+}
+
+/**
+ * @brief Removes the given key.
+ *
+ * @param[in] key The key to remove.
+ * @return size_type - the number of removed keys (0 or 1).
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::erase(const key_type &key) -> size_type {
+  return map_.erase(key);
+}
+
+// SKIPLIST SET LOOKUP
+
+/**
+ * @brief Searches for the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the key, or end() if not found.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::find(const key_type &key) const -> iterator {
+  return map_.find(key);
+}
+
+/**
+ * @brief Checks whether the key is present.
+ *
+ * @param[in] key The key to search for.
+ * @return bool - true if the key is present, false otherwise.
+ */
+template <typename K, typename C>
+bool skiplist_set<K, C>::contains(const key_type &key) const {
+  return map_.contains(key);
+}
+
+/**
+ * @brief Returns an iterator to the first key not less than the given one.
+ *
+ * @param[in] key The key to compare with.
+ * @return iterator - an iterator to the key, or end() if there is none.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::lower_bound(const key_type &key) const -> iterator {
+  return map_.lower_bound(key);
+}
+
+/**
+ * @brief Calls a function for every key in ascending order.
+ *
+ * @details
+ * The traversal is weakly consistent, like an iterator, and the function may
+ * stop it early by returning false.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a constant reference to each key.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename C>
+template <typename F>
+bool skiplist_set<K, C>::for_each(F &&fn) const {
+  return map_.for_each(
+      [&fn](const auto &pair) -> decltype(auto) { return fn(pair.first); });
+}
+
+// SKIPLIST SET ITERATOR OPERATORS
+
+/**
+ * @brief Pre-increment operator for the skip list set iterator.
+ *
+ * @return iterator& - reference to the incremented iterator.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::iterator::operator++() noexcept -> iterator & {
+  _map_it::operator++();
+
+  return *this;
+}
+
+/**
+ * @brief Post-increment operator for the skip list set iterator.
+ *
+ * @return iterator - the original iterator before the increment.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::iterator::operator++(int) noexcept -> iterator {
+  iterator copy{*this};
+
+  _map_it::operator++();
+
+  return copy;
+}
+
+/**
+ * @brief Dereference operator for the skip list set iterator.
+ *
+ * @return const_reference - const reference to the key at the current
+ * position.
+ */
+template <typename K, typename C>
+auto skiplist_set<K, C>::iterator::operator*() const noexcept
+    -> const_reference {
+  return _map_it::operator*().first;
+}
\ No newline at end of file
@@ -0,0 +1,811 @@
+/**
+ * @file small_vector.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the small vector container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_small_vector.h"
+
+using namespace s21;
+
+// SMALL VECTOR CONSTRUCTORS/ASSIGNMENT OPERATORS/DESTRUCTOR
+
+/**
+ * @brief Constructs an empty small vector using the inside buffer.
+ */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector() noexcept : data_{inlineData()} {}
+
+/**
+ * @brief Constructs a small vector of n value-initialized elements.
+ *
+ * @param[in] n The number of elements.
+ */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  reserve(n);
+  std::uninitialized_value_construct_n(data_, n);
+  size_ = n;
+}
+
+/**
+ * @brief Constructs a small vector with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of values to copy.
+ */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(std::initializer_list<value_type> const &items)
+    : small_vector() {
+  reserve(items.size());
+  std::uninitialized_copy(items.begin(), items.end(), data_);
+  size_ = items.size();
+}
+
+/**
+ * @brief Copy constructor. Copies the elements of other.
+ *
+ * @details
+ * The copy keeps its elements inside when they fit, whatever other does.
+ *
+ * @param[in] other The small vector to copy.
+ */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(const small_vector &other) : small_vector() {
+  reserve(other.size_);
+  std::uninitialized_copy(other.begin(), other.end(), data_);
+  size_ = other.size_;
+}
+
+/**
+ * @brief Move constructor. Takes the elements of other, leaving it empty.
+ *
+ * @param[in] other The small vector to move from.
+ */
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(small_vector &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : small_vector() {
+  moveFrom(other);
+}
+
+/**
+ * @brief Destructor. Destroys the elements and frees the heap storage.
+ */
+template <typename T, std::size_t N>
+small_vector<T, N>::~small_vector() {
+  clear();
+  if (!is_inline()) {
+    deallocate(data_);
+  }
+}
+
+/**
+ * @brief Copy assignment operator. Replaces the elements with copies.
+ *
+ * @param[in] other The small vector to copy.
+ * @return small_vector& - reference to the assigned small vector.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::operator=(const small_vector &other)
+    -> small_vector & {
+  if (this != &other) {
+    assign(other.begin(), other.end());
+  }
+  return *this;
+}
+
+/**
+ * @brief Move assignment operator. Takes the elements of other.
+ *
+ * @details
+ * The elements of the small vector are destroyed and its heap storage is
+ * freed first; other is left empty.
+ *
+ * @param[in] other The small vector to move from.
+ * @return small_vector& - reference to the assigned small vector.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::operator=(small_vector &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) -> small_vector & {
+  if (this != &other) {
+    clear();
+    if (!is_inline()) {
+      deallocate(data_);
+      data_ = inlineData();
+      capacity_ = N;
+    }
+    moveFrom(other);
+  }
+  return *this;
+}
+
+// SMALL VECTOR ELEMENT ACCESS
+
+/**
+ * @brief Accesses an element with bounds checking.
+ *
+ * @param[in] pos The position of the element.
+ * @return reference - to the element.
+ * @throws std::out_of_range if pos is not less than size().
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::at(size_type pos) -> reference {
+  if (pos >= size_) {
+    throw std::out_of_range("small_vector::at() - pos out of range");
+  }
+  return data_[pos];
+}
+
+/**
+ * @brief Accesses an element with bounds checking.
+ *
+ * @param[in] pos The position of the element.
+ * @return const_reference - to the element.
+ * @throws std::out_of_range if pos is not less than size().
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::at(size_type pos) const -> const_reference {
+  if (pos >= size_) {
+    throw std::out_of_range("small_vector::at() - pos out of range");
+  }
+  return data_[pos];
+}
+
+/**
+ * @brief Accesses an element. pos must be less than size().
+ *
+ * @param[in] pos The position of the element.
+ * @return reference - to the element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::operator[](size_type pos) noexcept -> reference {
+  return data_[pos];
+}
+
+/**
+ * @brief Accesses an element. pos must be less than size().
+ *
+ * @param[in] pos The position of the element.
+ * @return const_reference - to the element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::operator[](size_type pos) const noexcept
+    -> const_reference {
+  return data_[pos];
+}
+
+/**
+ * @brief Accesses the first element. The small vector must not be empty.
+ *
+ * @return reference - to the first element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::front() -> reference {
+  return data_[0];
+}
+
+/**
+ * @brief Accesses the first element. The small vector must not be empty.
+ *
+ * @return const_reference - to the first element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::front() const -> const_reference {
+  return data_[0];
+}
+
+/**
+ * @brief Accesses the last element. The small vector must not be empty.
+ *
+ * @return reference - to the last element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::back() -> reference {
+  return data_[size_ - 1];
+}
+
+/**
+ * @brief Accesses the last element. The small vector must not be empty.
+ *
+ * @return const_reference - to the last element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::back() const -> const_reference {
+  return data_[size_ - 1];
+}
+
+/**
+ * @brief Returns the storage of the elements, inside or on the heap.
+ *
+ * @return T* - pointer to the first element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::data() noexcept -> T * {
+  return data_;
+}
+
+/**
+ * @brief Returns the storage of the elements, inside or on the heap.
+ *
+ * @return const T* - pointer to the first element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::data() const noexcept -> const T * {
+  return data_;
+}
+
+// SMALL VECTOR ITERATORS
+
+/// @brief Returns an iterator to the first element.
+template <typename T, std::size_t N>
+auto small_vector<T, N>::begin() noexcept -> iterator {
+  return data_;
+}
+
+/// @brief Returns an iterator past the last element.
+template <typename T, std::size_t N>
+auto small_vector<T, N>::end() noexcept -> iterator {
+  return data_ + size_;
+}
+
+/// @brief Returns a const iterator to the first element.
+template <typename T, std::size_t N>
+auto small_vector<T, N>::begin() const noexcept -> const_iterator {
+  return data_;
+}
+
+/// @brief Returns a const iterator past the last element.
+template <typename T, std::size_t N>
+auto small_vector<T, N>::end() const noexcept -> const_iterator {
+  return data_ + size_;
+}
+
+/// @brief Returns a const iterator to the first element.
+template <typename T, std::size_t N>
+auto small_vector<T, N>::cbegin() const noexcept -> const_iterator {
+  return data_;
+}
+
+/// @brief Returns a const iterator past the last element.
+template <typename T, std::size_t N>
+auto small_vector<T, N>::cend() const noexcept -> const_iterator {
+  return data_ + size_;
+}
+
+// SMALL VECTOR CAPACITY
+
+/**
+ * @brief Checks whether the small vector is empty.
+ *
+ * @return bool - true if the small vector is empty, false otherwise.
+ */
+template <typename T, std::size_t N>
+bool small_vector<T, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::size() const noexcept -> size_type {
+  return size_;
+}
+
+/**
+ * @brief Returns the maximum number of elements.
+ *
+ * @return size_type - the maximum number of elements.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::max_size() const noexcept -> size_type {
+  return std::size_t(__PTRDIFF_MAX__) / sizeof(T);
+}
+
+/**
+ * @brief Makes room for at least size elements.
+ *
+ * @details
+ * Spills the elements to heap storage of exactly size elements if size
+ * exceeds capacity(); otherwise does nothing.
+ *
+ * @param[in] size The number of elements to make room for.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+  if (size > capacity_) {
+    reallocate(size);
+  }
+}
+
+/**
+ * @brief Returns the number of elements the current storage can hold.
+ *
+ * @return size_type - N while the elements are inside, more once they spill.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::capacity() const noexcept -> size_type {
+  return capacity_;
+}
+
+/**
+ * @brief Frees the unused heap capacity.
+ *
+ * @details
+ * The elements move back inside if they fit, and to heap storage of exactly
+ * size() elements otherwise.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+  if (!is_inline() && capacity_ != size_) {
+    reallocate(size_);
+  }
+}
+
+/**
+ * @brief Tells whether the elements are inside the small vector.
+ *
+ * @return bool - true if the elements are inside, false if on the heap.
+ */
+template <typename T, std::size_t N>
+bool small_vector<T, N>::is_inline() const noexcept {
+  return static_cast<const void *>(data_) == buffer_;
+}
+
+// SMALL VECTOR MODIFIERS
+
+/**
+ * @brief Destroys the elements. The capacity is kept.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::clear() noexcept {
+  std::destroy_n(data_, size_);
+  size_ = 0;
+}
+
+/**
+ * @brief Inserts a copy of value before pos.
+ *
+ * @param[in] pos The position to insert before (may be end()).
+ * @param[in] value The value to copy.
+ * @return iterator - to the inserted element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::insert(const_iterator pos, const_reference value)
+    -> iterator {
+  return emplace(pos, value);
+}
+
+/**
+ * @brief Inserts value before pos by moving it.
+ *
+ * @param[in] pos The position to insert before (may be end()).
+ * @param[in] value The value to move.
+ * @return iterator - to the inserted element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::insert(const_iterator pos, value_type &&value)
+    -> iterator {
+  return emplace(pos, std::move(value));
+}
+
+/**
+ * @brief Inserts the elements of a range before pos.
+ *
+ * @details
+ * For forward iterators the storage grows at most once and the tail moves
+ * once. A single-pass range is first gathered into a temporary small vector.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] pos The position to insert before (may be end()).
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @return iterator - to the first inserted element, or pos if none.
+ */
+template <typename T, std::size_t N>
+template <typename InputIt, typename>
+auto small_vector<T, N>::insert(const_iterator pos, InputIt first,
+                                InputIt last) -> iterator {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type index = pos - data_;
+
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+
+    return insertBatch(index, count, [&](T *dest) {
+      std::uninitialized_copy(first, last, dest);
+    });
+  } else {
+    small_vector buffer;
+
+    for (; first != last; ++first) {
+      buffer.emplace_back(*first);
+    }
+    return insert(pos, std::make_move_iterator(buffer.begin()),
+                  std::make_move_iterator(buffer.end()));
+  }
+}
+
+/**
+ * @brief Replaces the elements with the elements of a range.
+ *
+ * @details
+ * The range must not come from the small vector itself.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ */
+template <typename T, std::size_t N>
+template <typename InputIt, typename>
+void small_vector<T, N>::assign(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+
+  clear();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    reserve(std::distance(first, last));
+  }
+  insert(end(), first, last);
+}
+
+/**
+ * @brief Erases the element at pos.
+ *
+ * @param[in] pos The position of the element, dereferenceable.
+ * @return iterator - following the erased element.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::erase(const_iterator pos) -> iterator {
+  return erase(pos, pos + 1);
+}
+
+/**
+ * @brief Erases the elements in [first, last), moving the tail once.
+ *
+ * @param[in] first The first element to erase.
+ * @param[in] last The element past the last one to erase.
+ * @return iterator - following the erased elements.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::erase(const_iterator first, const_iterator last)
+    -> iterator {
+  size_type index = first - data_;
+  size_type count = last - first;
+
+  if (count > 0) {
+    std::move(data_ + index + count, data_ + size_, data_ + index);
+    std::destroy_n(data_ + size_ - count, count);
+    size_ -= count;
+  }
+  return data_ + index;
+}
+
+/**
+ * @brief Erases all elements satisfying a predicate in a single pass.
+ *
+ * @tparam Pred The type of the predicate.
+ * @param[in] pred Returns true for the elements to erase.
+ * @return size_type - the number of erased elements.
+ */
+template <typename T, std::size_t N>
+template <typename Pred>
+auto small_vector<T, N>::erase_if(Pred pred) -> size_type {
+  T *kept = std::remove_if(data_, data_ + size_, pred);
+  size_type erased = data_ + size_ - kept;
+
+  std::destroy(kept, data_ + size_);
+  size_ -= erased;
+  return erased;
+}
+
+/**
+ * @brief Appends a copy of value.
+ *
+ * @param[in] value The value to copy.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+/**
+ * @brief Appends value by moving it.
+ *
+ * @param[in] value The value to move.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+/**
+ * @brief Appends the elements of a range.
+ *
+ * @tparam Range The type of the range, anything std::begin() and std::end()
+ * accept.
+ * @param[in] range The range to append.
+ */
+template <typename T, std::size_t N>
+template <typename Range>
+void small_vector<T, N>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Destroys the last element, if any.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::pop_back() {
+  if (size_ > 0) {
+    std::destroy_at(data_ + --size_);
+  }
+}
+
+/**
+ * @brief Swaps the elements with other.
+ *
+ * @details
+ * Heap storage is handed over; elements inside are moved (see the move
+ * constructor).
+ *
+ * @param[in] other The small vector to swap with.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::swap(small_vector &other) {
+  small_vector tmp(std::move(other));
+
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+/**
+ * @brief Constructs an element in place before pos.
+ *
+ * @details
+ * The element is built before anything moves, so args may refer to elements
+ * of the small vector.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param[in] pos The position to insert before (may be end()).
+ * @param args The constructor arguments.
+ * @return iterator - to the new element.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+auto small_vector<T, N>::emplace(const_iterator pos, Args &&...args)
+    -> iterator {
+  return insertBatch(pos - data_, 1, [&](T *dest) {
+    new (dest) T(std::forward<Args>(args)...);
+  });
+}
+
+/**
+ * @brief Constructs an element in place at the end.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param args The constructor arguments.
+ * @return reference - to the new element.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+auto small_vector<T, N>::emplace_back(Args &&...args) -> reference {
+  return *insertBatch(size_, 1, [&](T *dest) {
+    new (dest) T(std::forward<Args>(args)...);
+  });
+}
+
+/**
+ * @brief Inserts one element per argument before pos.
+ *
+ * @details
+ * The storage grows at most once and the tail moves once for the batch.
+ *
+ * @tparam Args The types of the arguments.
+ * @param[in] pos The position to insert before (may be end()).
+ * @param args The arguments, one per element.
+ * @return iterator - past the last inserted element.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+auto small_vector<T, N>::insert_many(const_iterator pos, Args &&...args)
+    -> iterator {
+  return insertBatch(pos - data_, sizeof...(Args), [&](T *dest) {
+           storage::constructEach(dest, std::forward<Args>(args)...);
+         }) +
+         sizeof...(Args);
+}
+
+/**
+ * @brief Appends one element per argument.
+ *
+ * @tparam Args The types of the arguments.
+ * @param args The arguments, one per element.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+void small_vector<T, N>::insert_many_back(Args &&...args) {
+  insertBatch(size_, sizeof...(Args), [&](T *dest) {
+    storage::constructEach(dest, std::forward<Args>(args)...);
+  });
+}
+
+// SMALL VECTOR STORAGE
+
+/**
+ * @brief Returns the inside buffer as storage for elements.
+ *
+ * @return T* - the inside buffer.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::inlineData() noexcept -> T * {
+  return reinterpret_cast<T *>(buffer_);
+}
+
+/**
+ * @brief Allocates heap storage for count elements.
+ *
+ * @param[in] count The number of elements.
+ * @return T* - the storage.
+ * @throws std::length_error if count is too large.
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::allocate(size_type count) -> T * {
+  if (count > std::size_t(__PTRDIFF_MAX__) / sizeof(T)) {
+    throw std::length_error("small_vector::allocate() - size too large");
+  }
+  return static_cast<T *>(
+      ::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+/**
+ * @brief Frees heap storage from allocate().
+ *
+ * @param[in] array The storage.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::deallocate(T *array) noexcept {
+  ::operator delete(array, std::align_val_t(alignof(T)));
+}
+
+/**
+ * @brief Replaces the storage with array, to which the elements were
+ * relocated.
+ *
+ * @param[in] array The new storage, inside or on the heap.
+ * @param[in] capacity The capacity of the new storage.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::adopt(T *array, size_type capacity) noexcept {
+  if constexpr (!is_trivially_relocatable_v<T>) {
+    std::destroy_n(data_, size_);
+  }
+  if (!is_inline()) {
+    deallocate(data_);
+  }
+  data_ = array;
+  capacity_ = capacity;
+}
+
+/**
+ * @brief Relocates the elements to storage of the given capacity.
+ *
+ * @details
+ * A capacity of at most N brings the elements inside. If relocating throws
+ * the small vector is unchanged.
+ *
+ * @param[in] capacity The capacity, at least size().
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::reallocate(size_type capacity) {
+  T *array = (capacity > N) ? allocate(capacity) : inlineData();
+
+  if (array == data_) {
+    return;
+  }
+  try {
+    storage::relocate(data_, data_ + size_, array);
+  } catch (...) {
+    if (capacity > N) {
+      deallocate(array);
+    }
+    throw;
+  }
+  adopt(array, std::max(capacity, N));
+}
+
+/**
+ * @brief Takes the elements of other into an empty small vector.
+ *
+ * @details
+ * The small vector must be empty and use its inside buffer. Heap storage of
+ * other is handed over; elements inside other are relocated into the inside
+ * buffer. other is left empty.
+ *
+ * @param[in] other The small vector to take the elements of.
+ */
+template <typename T, std::size_t N>
+void small_vector<T, N>::moveFrom(small_vector &other) {
+  if (!other.is_inline()) {
+    data_ = other.data_;
+    capacity_ = other.capacity_;
+    other.data_ = other.inlineData();
+    other.capacity_ = N;
+  } else {
+    storage::relocate(other.data_, other.data_ + other.size_, data_);
+    if constexpr (!is_trivially_relocatable_v<T>) {
+      std::destroy_n(other.data_, other.size_);
+    }
+  }
+  size_ = other.size_;
+  other.size_ = 0;
+}
+
+// SMALL VECTOR INSERTION
+
+/**
+ * @brief Computes the heap capacity to grow into: double, or what is needed.
+ *
+ * @param[in] count The number of elements about to be added.
+ * @return size_type - the capacity for at least size() + count elements.
+ * @throws std::length_error if size() + count exceeds max_size().
+ */
+template <typename T, std::size_t N>
+auto small_vector<T, N>::grownCapacity(size_type count) const -> size_type {
+  if (count > max_size() - size_) {
+    throw std::length_error("small_vector::grownCapacity() - size too large");
+  }
+  return std::min(max_size(), std::max(capacity_ * 2, size_ + count));
+}
+
+/**
+ * @brief Inserts count elements built by fill at the given index.
+ *
+ * @details
+ * fill(dest) must construct count elements at dest, destroying the ones it
+ * built if one of them throws. With enough capacity they are built past the
+ * end and shifted into place (see raw_storage::shiftIn()); otherwise they
+ * are built in new heap storage around which the elements are relocated (see
+ * raw_storage::buildAround()). Either way nothing moves before fill returns,
+ * so its arguments may refer to elements of the small vector. If fill or the
+ * growth throws the small vector is unchanged.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] index The position of the first new element, at most size().
+ * @param[in] count The number of elements to insert.
+ * @param[in] fill The callable constructing the elements.
+ * @return iterator - to the first new element.
+ */
+template <typename T, std::size_t N>
+template <typename Fill>
+auto small_vector<T, N>::insertBatch(size_type index, size_type count,
+                                     Fill fill) -> iterator {
+  bool fits = capacity_ - size_ >= count;
+
+  if (fits && index == size_) {
+    fill(data_ + size_);
+    size_ += count;
+  } else if (fits && storage::kSHIFTS) {
+    storage::shiftIn(data_, size_, index, count, fill);
+  } else {
+    size_type capacity = grownCapacity(count);
+    T *array = allocate(capacity);
+
+    try {
+      storage::buildAround(data_, size_, index, count, array, fill);
+    } catch (...) {
+      deallocate(array);
+      throw;
+    }
+    adopt(array, capacity);
+    size_ += count;
+  }
+  return data_ + index;
+}
\ No newline at end of file
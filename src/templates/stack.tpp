@@ -24,7 +24,7 @@ using namespace s21;
  *
  */
 template <typename T>
-stack<T>::stack() {
+stack<T>::stack() noexcept {
   Size = 0;
   head = nullptr;
 }
@@ -71,7 +71,7 @@ stack<T>::stack(const stack &s) : stack() {
  * @param[in] s The stack to move from.
  */
 template <typename T>
-stack<T>::stack(stack &&s) : stack() {
+stack<T>::stack(stack &&s) noexcept : stack() {
   if (this != &s) {
     head = s.head;
     Size = s.Size;
@@ -140,10 +140,10 @@ stack<T> &stack<T>::operator=(const stack &s) {
  * @return stack<T>& - reference to the assigned stack.
  */
 template <typename T>
-stack<T> &stack<T>::operator=(stack &&l) {
+stack<T> &stack<T>::operator=(stack &&l) noexcept {
   if (this != &l) {
     stack<T> tmp(std::move(l));
-    *this = tmp;
+    swap(tmp);
   }
   return *this;
 }
@@ -243,9 +243,8 @@ void stack<T>::pop() {
  */
 template <typename T>
 void stack<T>::swap(stack &other) noexcept {
-  stack<T> temp(*this);
-  *this = other;
-  other = temp;
+  std::swap(head, other.head);
+  std::swap(Size, other.Size);
 }
 
 /**
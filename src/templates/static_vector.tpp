@@ -0,0 +1,937 @@
+/**
+ * @file static_vector.tpp
+ * @authors karstarl (https://edu.21-school.ru/profile/karstarl)
+ * @authors shericen (https://edu.21-school.ru/profile/shericen)
+ * @brief Template for the static vector container.
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "./../headers/s21_static_vector.h"
+
+using namespace s21;
+
+// STATIC STORAGE OF SMALL TRIVIAL TYPES
+
+/// @brief Returns the elements.
+template <typename T, std::size_t N, bool Literal>
+constexpr auto static_storage<T, N, Literal>::data() noexcept -> T * {
+  return elements_;
+}
+
+/// @brief Returns the elements.
+template <typename T, std::size_t N, bool Literal>
+constexpr auto static_storage<T, N, Literal>::data() const noexcept
+    -> const T * {
+  return elements_;
+}
+
+/**
+ * @brief Puts an element built from args in an unused slot.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param[in] dest The slot.
+ * @param args The constructor arguments.
+ */
+template <typename T, std::size_t N, bool Literal>
+template <typename... Args>
+constexpr void static_storage<T, N, Literal>::construct(T *dest,
+                                                        Args &&...args) {
+  *dest = T(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Puts one element per argument in consecutive unused slots.
+ *
+ * @tparam Args The types of the arguments.
+ * @param[in] dest The first slot.
+ * @param args The arguments, one per element.
+ */
+template <typename T, std::size_t N, bool Literal>
+template <typename... Args>
+constexpr void static_storage<T, N, Literal>::constructEach(T *dest,
+                                                            Args &&...args) {
+  ((*dest++ = T(std::forward<Args>(args))), ...);
+}
+
+/**
+ * @brief Puts count value-initialized elements in consecutive unused slots.
+ *
+ * @param[in] dest The first slot.
+ * @param[in] count The number of elements.
+ */
+template <typename T, std::size_t N, bool Literal>
+constexpr void static_storage<T, N, Literal>::constructN(T *dest,
+                                                         std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    dest[i] = T();
+  }
+}
+
+/**
+ * @brief Puts the elements of a range in consecutive unused slots.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @param[in] dest The first slot.
+ */
+template <typename T, std::size_t N, bool Literal>
+template <typename InputIt>
+constexpr void static_storage<T, N, Literal>::copy(InputIt first,
+                                                   InputIt last, T *dest) {
+  for (; first != last; ++first, ++dest) {
+    *dest = T(*first);
+  }
+}
+
+/// @brief Leaves the slots of trivial elements as they are.
+template <typename T, std::size_t N, bool Literal>
+constexpr void static_storage<T, N, Literal>::destroy(T *, T *) noexcept {}
+
+// STATIC STORAGE OF OTHER TYPES
+
+/**
+ * @brief Copy constructor. Copies the elements of other.
+ *
+ * @param[in] other The storage to copy.
+ */
+template <typename T, std::size_t N>
+static_storage<T, N, false>::static_storage(const static_storage &other) {
+  std::uninitialized_copy_n(other.data(), other.size_, data());
+  size_ = other.size_;
+}
+
+/**
+ * @brief Move constructor. Moves the elements of other one by one.
+ *
+ * @param[in] other The storage to move from, keeping its moved-from elements.
+ */
+template <typename T, std::size_t N>
+static_storage<T, N, false>::static_storage(static_storage &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>) {
+  std::uninitialized_move_n(other.data(), other.size_, data());
+  size_ = other.size_;
+}
+
+/**
+ * @brief Destructor. Destroys the elements.
+ */
+template <typename T, std::size_t N>
+static_storage<T, N, false>::~static_storage() {
+  destroy(data(), data() + size_);
+}
+
+/**
+ * @brief Copy assignment operator. Replaces the elements with copies.
+ *
+ * @param[in] other The storage to copy.
+ * @return static_storage& - reference to the assigned storage.
+ */
+template <typename T, std::size_t N>
+auto static_storage<T, N, false>::operator=(const static_storage &other)
+    -> static_storage & {
+  if (this != &other) {
+    assignFrom(other.data(), other.size_);
+  }
+  return *this;
+}
+
+/**
+ * @brief Move assignment operator. Moves the elements of other one by one.
+ *
+ * @param[in] other The storage to move from, keeping its moved-from elements.
+ * @return static_storage& - reference to the assigned storage.
+ */
+template <typename T, std::size_t N>
+auto static_storage<T, N, false>::operator=(static_storage &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T> &&
+    std::is_nothrow_move_assignable_v<T>) -> static_storage & {
+  if (this != &other) {
+    assignFrom(std::make_move_iterator(other.data()), other.size_);
+  }
+  return *this;
+}
+
+/// @brief Returns the storage of the elements.
+template <typename T, std::size_t N>
+auto static_storage<T, N, false>::data() noexcept -> T * {
+  return reinterpret_cast<T *>(buffer_);
+}
+
+/// @brief Returns the storage of the elements.
+template <typename T, std::size_t N>
+auto static_storage<T, N, false>::data() const noexcept -> const T * {
+  return reinterpret_cast<const T *>(buffer_);
+}
+
+/**
+ * @brief Constructs an element from args in raw storage.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param[in] dest The raw storage.
+ * @param args The constructor arguments.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+void static_storage<T, N, false>::construct(T *dest, Args &&...args) {
+  new (dest) T(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Constructs one element from each argument in consecutive storage.
+ *
+ * @details
+ * If a constructor throws, the elements already built are destroyed.
+ *
+ * @tparam Args The types of the arguments.
+ * @param[in] dest Raw storage for sizeof...(Args) elements.
+ * @param args The arguments, one per element.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+void static_storage<T, N, false>::constructEach(T *dest, Args &&...args) {
+  std::size_t built = 0;
+
+  try {
+    ((new (dest + built) T(std::forward<Args>(args)), ++built), ...);
+  } catch (...) {
+    std::destroy_n(dest, built);
+    throw;
+  }
+}
+
+/**
+ * @brief Constructs count value-initialized elements in raw storage.
+ *
+ * @param[in] dest Raw storage for count elements.
+ * @param[in] count The number of elements.
+ */
+template <typename T, std::size_t N>
+void static_storage<T, N, false>::constructN(T *dest, std::size_t count) {
+  std::uninitialized_value_construct_n(dest, count);
+}
+
+/**
+ * @brief Constructs the elements of a range in raw storage.
+ *
+ * @details
+ * If a constructor throws, the elements already built are destroyed.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @param[in] dest Raw storage with room for the range.
+ */
+template <typename T, std::size_t N>
+template <typename InputIt>
+void static_storage<T, N, false>::copy(InputIt first, InputIt last, T *dest) {
+  std::uninitialized_copy(first, last, dest);
+}
+
+/**
+ * @brief Destroys the elements of a range.
+ *
+ * @param[in] first The first element to destroy.
+ * @param[in] last The element past the last one to destroy.
+ */
+template <typename T, std::size_t N>
+void static_storage<T, N, false>::destroy(T *first, T *last) noexcept {
+  std::destroy(first, last);
+}
+
+/**
+ * @brief Replaces the elements with count elements of a range.
+ *
+ * @details
+ * The elements both storages have are assigned, the rest is constructed or
+ * destroyed.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] count The number of elements of the range.
+ */
+template <typename T, std::size_t N>
+template <typename InputIt>
+void static_storage<T, N, false>::assignFrom(InputIt first,
+                                             std::size_t count) {
+  std::size_t common = std::min(size_, count);
+  T *dest = data();
+
+  for (std::size_t i = 0; i < common; ++i, ++first) {
+    dest[i] = *first;
+  }
+  if (count > size_) {
+    std::uninitialized_copy_n(first, count - size_, dest + size_);
+  } else {
+    destroy(dest + count, dest + size_);
+  }
+  size_ = count;
+}
+
+// STATIC VECTOR CONSTRUCTORS
+
+/**
+ * @brief Constructs a static vector of n value-initialized elements.
+ *
+ * @param[in] n The number of elements.
+ * @throws std::length_error if n exceeds N.
+ */
+template <typename T, std::size_t N>
+constexpr static_vector<T, N>::static_vector(size_type n) {
+  appendBatch(n, [&](T *dest) { constructN(dest, n); });
+}
+
+/**
+ * @brief Constructs a static vector with elements from an initializer list.
+ *
+ * @param[in] items The initializer list of values to copy.
+ * @throws std::length_error if the list has more than N values.
+ */
+template <typename T, std::size_t N>
+constexpr static_vector<T, N>::static_vector(
+    std::initializer_list<value_type> const &items) {
+  appendBatch(items.size(),
+              [&](T *dest) { copy(items.begin(), items.end(), dest); });
+}
+
+// STATIC VECTOR ELEMENT ACCESS
+
+/**
+ * @brief Accesses an element with bounds checking.
+ *
+ * @param[in] pos The position of the element.
+ * @return reference - to the element.
+ * @throws std::out_of_range if pos is not less than size().
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::at(size_type pos) -> reference {
+  if (pos >= size_) {
+    throw std::out_of_range("static_vector::at() - pos out of range");
+  }
+  return data()[pos];
+}
+
+/**
+ * @brief Accesses an element with bounds checking.
+ *
+ * @param[in] pos The position of the element.
+ * @return const_reference - to the element.
+ * @throws std::out_of_range if pos is not less than size().
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::at(size_type pos) const
+    -> const_reference {
+  if (pos >= size_) {
+    throw std::out_of_range("static_vector::at() - pos out of range");
+  }
+  return data()[pos];
+}
+
+/**
+ * @brief Accesses an element. pos must be less than size().
+ *
+ * @param[in] pos The position of the element.
+ * @return reference - to the element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::operator[](size_type pos) noexcept
+    -> reference {
+  return data()[pos];
+}
+
+/**
+ * @brief Accesses an element. pos must be less than size().
+ *
+ * @param[in] pos The position of the element.
+ * @return const_reference - to the element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::operator[](size_type pos) const noexcept
+    -> const_reference {
+  return data()[pos];
+}
+
+/**
+ * @brief Accesses the first element. The static vector must not be empty.
+ *
+ * @return reference - to the first element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::front() -> reference {
+  return data()[0];
+}
+
+/**
+ * @brief Accesses the first element. The static vector must not be empty.
+ *
+ * @return const_reference - to the first element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::front() const -> const_reference {
+  return data()[0];
+}
+
+/**
+ * @brief Accesses the last element. The static vector must not be empty.
+ *
+ * @return reference - to the last element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::back() -> reference {
+  return data()[size_ - 1];
+}
+
+/**
+ * @brief Accesses the last element. The static vector must not be empty.
+ *
+ * @return const_reference - to the last element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::back() const -> const_reference {
+  return data()[size_ - 1];
+}
+
+// STATIC VECTOR ITERATORS
+
+/// @brief Returns an iterator to the first element.
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::begin() noexcept -> iterator {
+  return data();
+}
+
+/// @brief Returns an iterator past the last element.
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::end() noexcept -> iterator {
+  return data() + size_;
+}
+
+/// @brief Returns a const iterator to the first element.
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::begin() const noexcept -> const_iterator {
+  return data();
+}
+
+/// @brief Returns a const iterator past the last element.
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::end() const noexcept -> const_iterator {
+  return data() + size_;
+}
+
+/// @brief Returns a const iterator to the first element.
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::cbegin() const noexcept
+    -> const_iterator {
+  return data();
+}
+
+/// @brief Returns a const iterator past the last element.
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::cend() const noexcept -> const_iterator {
+  return data() + size_;
+}
+
+// STATIC VECTOR CAPACITY
+
+/**
+ * @brief Checks whether the static vector is empty.
+ *
+ * @return bool - true if the static vector is empty, false otherwise.
+ */
+template <typename T, std::size_t N>
+constexpr bool static_vector<T, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+/**
+ * @brief Checks whether the static vector holds N elements.
+ *
+ * @return bool - true if no element can be added, false otherwise.
+ */
+template <typename T, std::size_t N>
+constexpr bool static_vector<T, N>::full() const noexcept {
+  return size_ == N;
+}
+
+/**
+ * @brief Returns the number of elements.
+ *
+ * @return size_type - the number of elements.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::size() const noexcept -> size_type {
+  return size_;
+}
+
+/**
+ * @brief Returns the maximum number of elements.
+ *
+ * @return size_type - N.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::max_size() const noexcept -> size_type {
+  return N;
+}
+
+/**
+ * @brief Checks that size elements fit. The capacity never changes.
+ *
+ * @param[in] size The number of elements to make room for.
+ * @throws std::length_error if size exceeds N.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::reserve(size_type size) {
+  if (size > N) {
+    throw std::length_error("static_vector::reserve() - capacity exceeded");
+  }
+}
+
+/**
+ * @brief Returns the number of elements the static vector can hold.
+ *
+ * @return size_type - N.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::capacity() const noexcept -> size_type {
+  return N;
+}
+
+/**
+ * @brief Does nothing: the storage is part of the static vector.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::shrink_to_fit() noexcept {}
+
+// STATIC VECTOR MODIFIERS
+
+/**
+ * @brief Destroys the elements.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::clear() noexcept {
+  destroy(data(), data() + size_);
+  size_ = 0;
+}
+
+/**
+ * @brief Inserts a copy of value before pos.
+ *
+ * @param[in] pos The position to insert before (may be end()).
+ * @param[in] value The value to copy.
+ * @return iterator - to the inserted element.
+ * @throws std::length_error if the static vector is full.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::insert(const_iterator pos,
+                                           const_reference value) -> iterator {
+  return emplace(pos, value);
+}
+
+/**
+ * @brief Inserts value before pos by moving it.
+ *
+ * @param[in] pos The position to insert before (may be end()).
+ * @param[in] value The value to move.
+ * @return iterator - to the inserted element.
+ * @throws std::length_error if the static vector is full.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::insert(const_iterator pos,
+                                           value_type &&value) -> iterator {
+  return emplace(pos, std::move(value));
+}
+
+/**
+ * @brief Inserts the elements of a range before pos.
+ *
+ * @details
+ * A single-pass range is first gathered into a temporary static vector.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] pos The position to insert before (may be end()).
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @return iterator - to the first inserted element, or pos if none.
+ * @throws std::length_error if the range does not fit.
+ */
+template <typename T, std::size_t N>
+template <typename InputIt, typename>
+constexpr auto static_vector<T, N>::insert(const_iterator pos, InputIt first,
+                                           InputIt last) -> iterator {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type index = pos - data();
+
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+
+    return insertBatch(index, count,
+                       [&](T *dest) { copy(first, last, dest); });
+  } else {
+    static_vector buffer;
+
+    for (; first != last; ++first) {
+      buffer.emplace_back(*first);
+    }
+    return insert(pos, std::make_move_iterator(buffer.begin()),
+                  std::make_move_iterator(buffer.end()));
+  }
+}
+
+/**
+ * @brief Replaces the elements with the elements of a range.
+ *
+ * @details
+ * The range must not come from the static vector itself.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @throws std::length_error if the range does not fit.
+ */
+template <typename T, std::size_t N>
+template <typename InputIt, typename>
+constexpr void static_vector<T, N>::assign(InputIt first, InputIt last) {
+  clear();
+  insert(end(), first, last);
+}
+
+/**
+ * @brief Erases the element at pos.
+ *
+ * @param[in] pos The position of the element, dereferenceable.
+ * @return iterator - following the erased element.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::erase(const_iterator pos) -> iterator {
+  return erase(pos, pos + 1);
+}
+
+/**
+ * @brief Erases the elements in [first, last), moving the tail once.
+ *
+ * @param[in] first The first element to erase.
+ * @param[in] last The element past the last one to erase.
+ * @return iterator - following the erased elements.
+ */
+template <typename T, std::size_t N>
+constexpr auto static_vector<T, N>::erase(const_iterator first,
+                                          const_iterator last) -> iterator {
+  T *kept = data() + (first - data());
+  T *source = kept + (last - first);
+  T *stop = data() + size_;
+
+  if (kept != source) {
+    for (; source != stop; ++source, ++kept) {
+      *kept = std::move(*source);
+    }
+    destroy(kept, stop);
+    size_ = kept - data();
+  }
+  return data() + (first - data());
+}
+
+/**
+ * @brief Erases all elements satisfying a predicate in a single pass.
+ *
+ * @tparam Pred The type of the predicate.
+ * @param[in] pred Returns true for the elements to erase.
+ * @return size_type - the number of erased elements.
+ */
+template <typename T, std::size_t N>
+template <typename Pred>
+constexpr auto static_vector<T, N>::erase_if(Pred pred) -> size_type {
+  T *kept = data();
+  T *stop = data() + size_;
+
+  for (T *it = kept; it != stop; ++it) {
+    if (!pred(*it)) {
+      if (it != kept) {
+        *kept = std::move(*it);
+      }
+      ++kept;
+    }
+  }
+
+  size_type erased = stop - kept;
+
+  destroy(kept, stop);
+  size_ -= erased;
+  return erased;
+}
+
+/**
+ * @brief Appends a copy of value.
+ *
+ * @param[in] value The value to copy.
+ * @throws std::length_error if the static vector is full.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+/**
+ * @brief Appends value by moving it.
+ *
+ * @param[in] value The value to move.
+ * @throws std::length_error if the static vector is full.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+/**
+ * @brief Appends a copy of value unless the static vector is full.
+ *
+ * @param[in] value The value to copy.
+ * @return bool - true if value was appended, false if the vector is full.
+ */
+template <typename T, std::size_t N>
+constexpr bool static_vector<T, N>::try_push_back(const_reference value) {
+  return try_emplace_back(value) != nullptr;
+}
+
+/**
+ * @brief Appends value by moving it unless the static vector is full.
+ *
+ * @param[in] value The value to move, left untouched if the vector is full.
+ * @return bool - true if value was appended, false if the vector is full.
+ */
+template <typename T, std::size_t N>
+constexpr bool static_vector<T, N>::try_push_back(value_type &&value) {
+  return try_emplace_back(std::move(value)) != nullptr;
+}
+
+/**
+ * @brief Appends the elements of a range.
+ *
+ * @tparam Range The type of the range, anything std::begin() and std::end()
+ * accept.
+ * @param[in] range The range to append.
+ * @throws std::length_error if the range does not fit.
+ */
+template <typename T, std::size_t N>
+template <typename Range>
+constexpr void static_vector<T, N>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Destroys the last element, if any.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::pop_back() noexcept {
+  if (size_ > 0) {
+    --size_;
+    destroy(data() + size_, data() + size_ + 1);
+  }
+}
+
+/**
+ * @brief Swaps the elements with other, moving them one by one.
+ *
+ * @param[in] other The static vector to swap with.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::swap(static_vector &other) {
+  static_vector tmp(std::move(other));
+
+  other = std::move(*this);
+  *this = std::move(tmp);
+}
+
+/**
+ * @brief Constructs an element in place before pos.
+ *
+ * @details
+ * The element is built before anything moves, so args may refer to elements
+ * of the static vector.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param[in] pos The position to insert before (may be end()).
+ * @param args The constructor arguments.
+ * @return iterator - to the new element.
+ * @throws std::length_error if the static vector is full.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+constexpr auto static_vector<T, N>::emplace(const_iterator pos,
+                                            Args &&...args) -> iterator {
+  return insertBatch(pos - data(), 1, [&](T *dest) {
+    construct(dest, std::forward<Args>(args)...);
+  });
+}
+
+/**
+ * @brief Constructs an element in place at the end.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param args The constructor arguments.
+ * @return reference - to the new element.
+ * @throws std::length_error if the static vector is full.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+constexpr auto static_vector<T, N>::emplace_back(Args &&...args)
+    -> reference {
+  return *appendBatch(1, [&](T *dest) {
+    construct(dest, std::forward<Args>(args)...);
+  });
+}
+
+/**
+ * @brief Constructs an element in place at the end unless the static vector
+ * is full.
+ *
+ * @tparam Args The types of the constructor arguments.
+ * @param args The constructor arguments, left untouched if the vector is full.
+ * @return T* - the new element, or nullptr if the vector is full.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+constexpr auto static_vector<T, N>::try_emplace_back(Args &&...args) -> T * {
+  if (full()) {
+    return nullptr;
+  }
+  return appendBatch(1, [&](T *dest) {
+    construct(dest, std::forward<Args>(args)...);
+  });
+}
+
+/**
+ * @brief Inserts one element per argument before pos.
+ *
+ * @details
+ * The tail moves once for the batch.
+ *
+ * @tparam Args The types of the arguments.
+ * @param[in] pos The position to insert before (may be end()).
+ * @param args The arguments, one per element.
+ * @return iterator - past the last inserted element.
+ * @throws std::length_error if the arguments do not fit.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+constexpr auto static_vector<T, N>::insert_many(const_iterator pos,
+                                                Args &&...args) -> iterator {
+  return insertBatch(pos - data(), sizeof...(Args), [&](T *dest) {
+           constructEach(dest, std::forward<Args>(args)...);
+         }) +
+         sizeof...(Args);
+}
+
+/**
+ * @brief Appends one element per argument.
+ *
+ * @tparam Args The types of the arguments.
+ * @param args The arguments, one per element.
+ * @throws std::length_error if the arguments do not fit.
+ */
+template <typename T, std::size_t N>
+template <typename... Args>
+constexpr void static_vector<T, N>::insert_many_back(Args &&...args) {
+  appendBatch(sizeof...(Args), [&](T *dest) {
+    constructEach(dest, std::forward<Args>(args)...);
+  });
+}
+
+// STATIC VECTOR INSERTION
+
+/**
+ * @brief Checks that count more elements fit.
+ *
+ * @param[in] count The number of elements about to be added.
+ * @throws std::length_error if size() + count exceeds N.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::checkRoom(size_type count) const {
+  if (count > N - size_) {
+    throw std::length_error("static_vector::checkRoom() - capacity exceeded");
+  }
+}
+
+/**
+ * @brief Appends count elements built by fill.
+ *
+ * @details
+ * fill(dest) must construct count elements at dest, destroying the ones it
+ * built if one of them throws. If fill throws or the elements do not fit the
+ * static vector is unchanged.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] count The number of elements to append.
+ * @param[in] fill The callable constructing the elements.
+ * @return T* - the first new element.
+ */
+template <typename T, std::size_t N>
+template <typename Fill>
+constexpr auto static_vector<T, N>::appendBatch(size_type count, Fill fill)
+    -> T * {
+  checkRoom(count);
+
+  T *dest = data() + size_;
+
+  fill(dest);
+  size_ += count;
+  return dest;
+}
+
+/**
+ * @brief Inserts count elements built by fill at the given index.
+ *
+ * @details
+ * The elements are appended (see appendBatch()) and rotated into place, so
+ * the arguments of fill may refer to elements of the static vector.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] index The position of the first new element, at most size().
+ * @param[in] count The number of elements to insert.
+ * @param[in] fill The callable constructing the elements.
+ * @return iterator - to the first new element.
+ */
+template <typename T, std::size_t N>
+template <typename Fill>
+constexpr auto static_vector<T, N>::insertBatch(size_type index,
+                                                size_type count, Fill fill)
+    -> iterator {
+  T *dest = appendBatch(count, fill);
+
+  rotate(data() + index, dest, dest + count);
+  return data() + index;
+}
+
+/**
+ * @brief Rotates [first, last) so that middle becomes the first element.
+ *
+ * @details
+ * std::rotate() is not constexpr before C++20; this is its forward iterator
+ * algorithm, swapping by moves.
+ *
+ * @param[in] first The beginning of the range.
+ * @param[in] middle The element to bring to the front.
+ * @param[in] last The end of the range.
+ */
+template <typename T, std::size_t N>
+constexpr void static_vector<T, N>::rotate(T *first, T *middle, T *last) {
+  if (first == middle || middle == last) {
+    return;
+  }
+
+  T *next = middle;
+
+  while (first != next) {
+    T tmp(std::move(*first));
+
+    *first++ = std::move(*next);
+    *next++ = std::move(tmp);
+    if (next == last) {
+      next = middle;
+    } else if (first == middle) {
+      middle = next;
+    }
+  }
+}
\ No newline at end of file
@@ -22,8 +22,18 @@ using namespace s21;
  *
  * @param[in] type Type of tree elements (unique/non-unique).
  */
-template <typename K, typename M>
-tree<K, M>::tree(Uniq type) noexcept : type_{type} {}
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::tree(Uniq type) noexcept : type_{type} {}
+
+/**
+ * @brief Constructs an empty tree ordered by the given comparator.
+ *
+ * @param[in] comp The comparator ordering the keys.
+ * @param[in] type Determines whether to allow duplicates.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::tree(const C &comp, Uniq type)
+    : type_{type}, comp_{comp} {}
 
 /**
  * @brief Constructs a tree with a single node.
@@ -35,9 +45,9 @@ tree<K, M>::tree(Uniq type) noexcept : type_{type} {}
  * @param[in] pair The pair of key/value for node.
  * @param[in] type Type of tree elements (unique/non-unique).
  */
-template <typename K, typename M>
-tree<K, M>::tree(const value_type &pair, Uniq type) : type_{type} {
-  sentinel_ = new Node{value_type{}};
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::tree(const value_type &pair, Uniq type) : type_{type} {
+  sentinel_ = new Node{std::in_place};
   insert(pair);
 }
 
@@ -52,10 +62,11 @@ tree<K, M>::tree(const value_type &pair, Uniq type) : type_{type} {
  * @param[in] items The initializer list of key-val pairs insert into the tree.
  * @param[in] type Type of tree elements (unique/non-unique).
  */
-template <typename K, typename M>
-tree<K, M>::tree(std::initializer_list<value_type> const &items, Uniq type)
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::tree(std::initializer_list<value_type> const &items,
+                          Uniq type)
     : type_{type} {
-  sentinel_ = new Node{value_type{}};
+  sentinel_ = new Node{std::in_place};
 
   for (auto pair : items) {
     insert(pair);
@@ -72,9 +83,9 @@ tree<K, M>::tree(std::initializer_list<value_type> const &items, Uniq type)
  *
  * @param[in] t The tree to copy from.
  */
-template <typename K, typename M>
-tree<K, M>::tree(const tree &t) : type_{t.type_} {
-  sentinel_ = new Node{value_type{}};
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::tree(const tree &t) : type_{t.type_}, comp_{t.comp_} {
+  sentinel_ = new Node{std::in_place};
 
   copyTree(t.root_);
 }
@@ -89,12 +100,14 @@ tree<K, M>::tree(const tree &t) : type_{t.type_} {
  *
  * @param[in] t The tree to move from.
  */
-template <typename K, typename M>
-tree<K, M>::tree(tree &&t)
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::tree(tree &&t) noexcept(
+    std::is_nothrow_copy_constructible_v<C>)
     : root_{std::exchange(t.root_, nullptr)},
       sentinel_{std::exchange(t.sentinel_, nullptr)},
       size_{std::exchange(t.size_, 0)},
-      type_{t.type_} {}
+      type_{t.type_},
+      comp_{t.comp_} {}
 
 /**
  * @brief Move assignment operator for the red-black tree.
@@ -105,10 +118,11 @@ tree<K, M>::tree(tree &&t)
  * source tree.
  *
  * @param[in] t The tree to move from.
- * @return tree<K, M>& - reference to the assigned tree.
+ * @return tree<K, M, C, L, S>& - reference to the assigned tree.
  */
-template <typename K, typename M>
-tree<K, M> &tree<K, M>::operator=(tree &&t) {
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S> &tree<K, M, C, L, S>::operator=(tree &&t) noexcept(
+    std::is_nothrow_copy_constructible_v<C>) {
   if (this != &t) {
     cleanTree(root_);
     delete sentinel_;
@@ -128,10 +142,10 @@ tree<K, M> &tree<K, M>::operator=(tree &&t) {
  * source tree.
  *
  * @param[in] t The tree to copy from.
- * @return tree<K, M>& - reference to the assigned tree.
+ * @return tree<K, M, C, L, S>& - reference to the assigned tree.
  */
-template <typename K, typename M>
-tree<K, M> &tree<K, M>::operator=(const tree &t) {
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S> &tree<K, M, C, L, S>::operator=(const tree &t) {
   if (this != &t) {
     cleanTree(root_);
     delete sentinel_;
@@ -148,8 +162,8 @@ tree<K, M> &tree<K, M>::operator=(const tree &t) {
  * @details
  * Destroys the tree and frees allocated memory.
  */
-template <typename K, typename M>
-tree<K, M>::~tree() {
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::~tree() {
   if (root_) {
     cleanTree(root_);
   }
@@ -165,8 +179,13 @@ tree<K, M>::~tree() {
  *
  * @return iterator - an iterator to the beginning of the tree.
  */
-template <typename K, typename M>
-auto tree<K, M>::begin() const noexcept -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::begin() const noexcept -> iterator {
+  if constexpr (L) {
+    return iterator{(root_) ? sentinel_->link[kRIGHT] : sentinel_, root_,
+                  sentinel_};
+  }
+
   return iterator{findMin(root_), root_, sentinel_};
 }
 
@@ -175,8 +194,12 @@ auto tree<K, M>::begin() const noexcept -> iterator {
  *
  * @return iterator - an iterator to the end of the tree.
  */
-template <typename K, typename M>
-auto tree<K, M>::end() const noexcept -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::end() const noexcept -> iterator {
+  if constexpr (L) {
+    return iterator{sentinel_, root_, sentinel_};
+  }
+
   return iterator{sentinel_, root_, findMax(root_)};
 }
 
@@ -185,8 +208,13 @@ auto tree<K, M>::end() const noexcept -> iterator {
  *
  * @return iterator - an iterator to the beginning of the tree.
  */
-template <typename K, typename M>
-auto tree<K, M>::cbegin() const noexcept -> const_iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::cbegin() const noexcept -> const_iterator {
+  if constexpr (L) {
+    return const_iterator{(root_) ? sentinel_->link[kRIGHT] : sentinel_, root_,
+                  sentinel_};
+  }
+
   return const_iterator{findMin(root_), root_, sentinel_};
 }
 
@@ -195,8 +223,12 @@ auto tree<K, M>::cbegin() const noexcept -> const_iterator {
  *
  * @return iterator - an iterator to the end of the tree.
  */
-template <typename K, typename M>
-auto tree<K, M>::cend() const noexcept -> const_iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::cend() const noexcept -> const_iterator {
+  if constexpr (L) {
+    return const_iterator{sentinel_, root_, sentinel_};
+  }
+
   return const_iterator{sentinel_, root_, findMax(root_)};
 }
 
@@ -211,8 +243,8 @@ auto tree<K, M>::cend() const noexcept -> const_iterator {
  *
  * @return size_type - the number of elements in the tree.
  */
-template <typename K, typename M>
-auto tree<K, M>::size() const noexcept -> size_type {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::size() const noexcept -> size_type {
   return size_;
 }
 
@@ -221,36 +253,51 @@ auto tree<K, M>::size() const noexcept -> size_type {
  *
  * @return size_type - the maximum number of elements.
  */
-template <typename K, typename M>
-auto tree<K, M>::max_size() const noexcept -> size_type {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::max_size() const noexcept -> size_type {
   return std::numeric_limits<size_type>::max() / sizeof(Node) / 2;
 }
 
+/**
+ * @brief Returns the comparator ordering the keys.
+ *
+ * @return C - a copy of the comparator.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+C tree<K, M, C, L, S>::key_comp() const {
+  return comp_;
+}
+
 /**
  * @brief Performs a left rotation at the given node.
  *
  * @param[in] old_root The node at which to perform the rotation.
  */
-template <typename K, typename M>
-void tree<K, M>::rotateLeft(Node *old_root) noexcept {
-  Node *new_root = old_root->right;
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::rotateLeft(Node *old_root) noexcept {
+  Node *new_root = old_root->child[kRIGHT];
 
-  if (new_root->left) {
-    new_root->left->parent = old_root;
+  if (new_root->child[kLEFT]) {
+    new_root->child[kLEFT]->parent = old_root;
   }
 
-  old_root->right = new_root->left;
-  new_root->left = old_root;
+  old_root->child[kRIGHT] = new_root->child[kLEFT];
+  new_root->child[kLEFT] = old_root;
 
   if (!old_root->parent) {
     root_ = new_root;
-  } else if (old_root == old_root->parent->left) {
-    old_root->parent->left = new_root;
+  } else if (old_root == old_root->parent->child[kLEFT]) {
+    old_root->parent->child[kLEFT] = new_root;
   } else {
-    old_root->parent->right = new_root;
+    old_root->parent->child[kRIGHT] = new_root;
   }
 
   new_root->parent = std::exchange(old_root->parent, new_root);
+
+  if constexpr (kSUMMARIZED) {
+    summarizeNode(old_root);
+    summarizeNode(new_root);
+  }
 }
 
 /**
@@ -258,50 +305,30 @@ void tree<K, M>::rotateLeft(Node *old_root) noexcept {
  *
  * @param[in] old_root The node at which to perform the rotation.
  */
-template <typename K, typename M>
-void tree<K, M>::rotateRight(Node *old_root) noexcept {
-  Node *new_root = old_root->left;
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::rotateRight(Node *old_root) noexcept {
+  Node *new_root = old_root->child[kLEFT];
 
-  if (new_root->right) {
-    new_root->right->parent = old_root;
+  if (new_root->child[kRIGHT]) {
+    new_root->child[kRIGHT]->parent = old_root;
   }
 
-  old_root->left = new_root->right;
-  new_root->right = old_root;
+  old_root->child[kLEFT] = new_root->child[kRIGHT];
+  new_root->child[kRIGHT] = old_root;
 
   if (!old_root->parent) {
     root_ = new_root;
-  } else if (old_root == old_root->parent->left) {
-    old_root->parent->left = new_root;
+  } else if (old_root == old_root->parent->child[kLEFT]) {
+    old_root->parent->child[kLEFT] = new_root;
   } else {
-    old_root->parent->right = new_root;
+    old_root->parent->child[kRIGHT] = new_root;
   }
 
   new_root->parent = std::exchange(old_root->parent, new_root);
-}
-
-/**
- * @brief Swaps the colors of the given node and its children.
- *
- * @param[in] node The node at which to swap colors.
- */
-template <typename K, typename M>
-void tree<K, M>::swapColors(Node *node) noexcept {
-  if (node == nullptr || node->left == nullptr || node->right == nullptr) {
-    return;
-  }
-
-  if (node->left->color == kRED && node->right->color == kRED) {
-    node->left->color = node->right->color = kBLACK;
-    node->color = kRED;
 
-    if (node->parent && node->parent != root_) {
-      swapColors(node->parent);
-    }
-  }
-
-  if (root_) {
-    root_->color = kBLACK;
+  if constexpr (kSUMMARIZED) {
+    summarizeNode(old_root);
+    summarizeNode(new_root);
   }
 }
 
@@ -311,10 +338,10 @@ void tree<K, M>::swapColors(Node *node) noexcept {
  * @param[in] node The root node of the tree.
  * @return Node* - the node with the maximum key.
  */
-template <typename K, typename M>
-auto tree<K, M>::findMax(Node *node) noexcept -> Node * {
-  while (node && node->right) {
-    node = node->right;
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::findMax(Node *node) noexcept -> Node * {
+  while (node && node->child[kRIGHT]) {
+    node = node->child[kRIGHT];
   }
 
   return node;
@@ -326,36 +353,98 @@ auto tree<K, M>::findMax(Node *node) noexcept -> Node * {
  * @param[in] node The node from which to start searching for the minimum key.
  * @return Node* - the node with the minimum key.
  */
-template <typename K, typename M>
-auto tree<K, M>::findMin(Node *node) noexcept -> Node * {
-  while (node && node->left) {
-    node = node->left;
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::findMin(Node *node) noexcept -> Node * {
+  while (node && node->child[kLEFT]) {
+    node = node->child[kLEFT];
   }
 
   return node;
 }
 
+/**
+ * @brief Checks whether the first key is ordered before the second one.
+ *
+ * @param[in] a The first key.
+ * @param[in] b The second key.
+ * @return bool - true if a is ordered before b.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename A, typename B>
+bool tree<K, M, C, L, S>::lessKeys(const A &a, const B &b) const noexcept {
+  if constexpr (is_three_way<C>::value) {
+    return comp_(a, b) < 0;
+  } else {
+    return comp_(a, b);
+  }
+}
+
+/**
+ * @brief Compares two keys in one step.
+ *
+ * @details
+ * A three-way comparator is called once. A boolean comparator needs a second
+ * call in the reverse direction to tell equal keys from greater ones.
+ *
+ * @param[in] a The first key.
+ * @param[in] b The second key.
+ * @return int - negative, zero or positive if a is ordered before, equivalent
+ * to or after b.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename A, typename B>
+int tree<K, M, C, L, S>::compareKeys(const A &a, const B &b) const noexcept {
+  if constexpr (is_three_way<C>::value) {
+    return comp_(a, b);
+  } else {
+    return comp_(a, b) ? -1 : comp_(b, a) ? 1 : 0;
+  }
+}
+
 /**
  * @brief Finds the node with the given key.
  *
+ * @details
+ * With branchless_search enabled the descent does not stop on a match. Each
+ * level costs one comparison, whose result indexes the child array directly,
+ * and the last node not ordered before the key is remembered with a
+ * conditional move. A single comparison after the loop decides whether that
+ * node holds the key. Otherwise the descent stops at the first equal key.
+ *
+ * @tparam Key The type of the key, key_type or a type comparable with it.
  * @param[in] node The root node of the tree.
  * @param[in] key The key to search for.
  * @return Node* - the node with the given key, or nullptr if the key is not
  * found.
  */
-template <typename K, typename M>
-auto tree<K, M>::findNode(Node *node, const key_type &key) const noexcept
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key>
+auto tree<K, M, C, L, S>::findNode(Node *node, const Key &key) const noexcept
     -> Node * {
-  if (!node) {
-    return nullptr;
-  }
+  if constexpr (branchless_search<K, C>::value) {
+    Node *candidate{};
+
+    while (node) {
+      bool right = lessKeys(node->pair->first, key);
+
+      candidate = (right) ? candidate : node;
+      node = node->child[right];
+    }
 
-  if (node->pair->first > key) {
-    return findNode(node->left, key);
-  } else if (node->pair->first < key) {
-    return findNode(node->right, key);
+    return (candidate && !lessKeys(key, candidate->pair->first)) ? candidate
+                                                                 : nullptr;
   } else {
-    return node;
+    while (node) {
+      int order = compareKeys(key, node->pair->first);
+
+      if (!order) {
+        return node;
+      }
+
+      node = node->child[order > 0];
+    }
+
+    return nullptr;
   }
 }
 
@@ -366,13 +455,245 @@ auto tree<K, M>::findNode(Node *node, const key_type &key) const noexcept
  * @return value_type - pointer to pair associated with the key, or a
  * nullptr if the key is not found.
  */
-template <typename K, typename M>
-auto tree<K, M>::find(const key_type &key) const -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::find(const key_type &key) const -> iterator {
+  Node *find = findNode(root_, key);
+
+  return (find) ? iterator{find, root_, sentinel_} : end();
+}
+
+/**
+ * @brief Finds the first node not ordered before (or, for an upper bound,
+ * ordered after) the given key.
+ *
+ * @tparam Key The type of the key, key_type or a type comparable with it.
+ * @param[in] key The key to search for.
+ * @param[in] upper Whether to search for the upper bound.
+ * @return Node* - the bound node, or nullptr if every key is ordered before
+ * the bound.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key>
+auto tree<K, M, C, L, S>::boundNode(const Key &key, bool upper) const noexcept
+    -> Node * {
+  Node *bound{};
+
+  for (Node *node = root_; node;) {
+    bool left = (upper) ? lessKeys(key, node->pair->first)
+                        : !lessKeys(node->pair->first, key);
+
+    bound = (left) ? node : bound;
+    node = node->child[!left];
+  }
+
+  return bound;
+}
+
+/**
+ * @brief Counts the nodes with keys equivalent to the given key.
+ *
+ * @details
+ * A unique tree needs a single search. Otherwise the equal keys are counted
+ * from the lower bound, which takes O(log n + count).
+ *
+ * @tparam Key The type of the key, key_type or a type comparable with it.
+ * @param[in] key The key to search for.
+ * @return size_type - the number of nodes with an equivalent key.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key>
+auto tree<K, M, C, L, S>::countNodes(const Key &key) const noexcept
+    -> size_type {
+  if (type_ == kUNIQUE) {
+    return (findNode(root_, key)) ? 1 : 0;
+  }
+
+  size_type count{};
+  Node *node = boundNode(key, false);
+
+  if (node) {
+    iterator last = upper_bound(key);
+
+    for (iterator it{node, root_, sentinel_}; it != last; ++it) {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * @brief Searches for a value comparable with the keys.
+ *
+ * @details
+ * Available only with a transparent comparator, so the key does not have to
+ * be converted to key_type first.
+ *
+ * @tparam Key The type of the key.
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the found element, or end().
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key, typename Cmp, typename>
+auto tree<K, M, C, L, S>::find(const Key &key) const -> iterator {
   Node *find = findNode(root_, key);
 
   return (find) ? iterator{find, root_, sentinel_} : end();
 }
 
+/**
+ * @brief Counts the elements with keys equivalent to the given key.
+ *
+ * @param[in] key The key to search for.
+ * @return size_type - the number of elements with an equivalent key.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::count(const key_type &key) const noexcept
+    -> size_type {
+  return countNodes(key);
+}
+
+/**
+ * @brief Counts the elements with keys equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the key.
+ * @param[in] key The key to search for.
+ * @return size_type - the number of elements with an equivalent key.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key, typename Cmp, typename>
+auto tree<K, M, C, L, S>::count(const Key &key) const noexcept -> size_type {
+  return countNodes(key);
+}
+
+/**
+ * @brief Finds the first element whose key is not ordered before the key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the found element, or end().
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::lower_bound(const key_type &key) const noexcept
+    -> iterator {
+  Node *bound = boundNode(key, false);
+
+  return (bound) ? iterator{bound, root_, sentinel_} : end();
+}
+
+/**
+ * @brief Finds the first element whose key is not ordered before the value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the key.
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the found element, or end().
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key, typename Cmp, typename>
+auto tree<K, M, C, L, S>::lower_bound(const Key &key) const noexcept
+    -> iterator {
+  Node *bound = boundNode(key, false);
+
+  return (bound) ? iterator{bound, root_, sentinel_} : end();
+}
+
+/**
+ * @brief Finds the first element whose key is ordered after the key.
+ *
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the found element, or end().
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::upper_bound(const key_type &key) const noexcept
+    -> iterator {
+  Node *bound = boundNode(key, true);
+
+  return (bound) ? iterator{bound, root_, sentinel_} : end();
+}
+
+/**
+ * @brief Finds the first element whose key is ordered after the value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the key.
+ * @param[in] key The key to search for.
+ * @return iterator - an iterator to the found element, or end().
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key, typename Cmp, typename>
+auto tree<K, M, C, L, S>::upper_bound(const Key &key) const noexcept
+    -> iterator {
+  Node *bound = boundNode(key, true);
+
+  return (bound) ? iterator{bound, root_, sentinel_} : end();
+}
+
+// THREADING
+
+/**
+ * @brief Links a new leaf with its in-order neighbours.
+ *
+ * @details
+ * A left child goes right before its parent, a right child right after it.
+ * The first node of a tree is linked with the sentinel alone.
+ *
+ * @param[in,out] node The new leaf.
+ * @param[in,out] parent The parent of the leaf, or nullptr for the root.
+ * @param[in] side The side of the parent the leaf hangs on.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::threadNode(Node *node, Node *parent,
+                                     bool side) noexcept {
+  if (!parent) {
+    parent = sentinel_;
+    parent->link[kLEFT] = parent->link[kRIGHT] = parent;
+  }
+
+  node->link[!side] = parent;
+  node->link[side] = parent->link[side];
+  node->link[side]->link[!side] = node;
+  parent->link[side] = node;
+}
+
+/**
+ * @brief Unlinks a node from its in-order neighbours.
+ *
+ * @param[in] node The node being removed from the tree.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::unthreadNode(Node *node) noexcept {
+  node->link[kLEFT]->link[kRIGHT] = node->link[kRIGHT];
+  node->link[kRIGHT]->link[kLEFT] = node->link[kLEFT];
+}
+
+/**
+ * @brief Relinks all nodes of the tree in the given order.
+ *
+ * @param[in] nodes All nodes of the tree sorted by key.
+ * @param[in] count The number of nodes.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::threadSequence(Node **nodes,
+                                         size_type count) noexcept {
+  Node *prev = sentinel_;
+
+  for (size_type i = 0; i < count; ++i) {
+    prev->link[kRIGHT] = nodes[i];
+    nodes[i]->link[kLEFT] = prev;
+    prev = nodes[i];
+  }
+
+  prev->link[kRIGHT] = sentinel_;
+  sentinel_->link[kLEFT] = prev;
+}
+
 // BALANCING TREE
 
 /**
@@ -380,12 +701,12 @@ auto tree<K, M>::find(const key_type &key) const -> iterator {
  *
  * @param[in] node The newly inserted node.
  */
-template <typename K, typename M>
-void tree<K, M>::balancingTree(Node *node) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::balancingTree(Node *node) noexcept {
   while (node->parent && node->parent->color == kRED) {
     Node *parent = node->parent;
     Node *grandpar = parent->parent;
-    Node *uncle = (parent == grandpar->left) ? grandpar->right : grandpar->left;
+    Node *uncle = grandpar->child[parent == grandpar->child[kLEFT]];
 
     if (uncle && uncle->color == kRED) {
       parent->color = kBLACK;
@@ -393,11 +714,12 @@ void tree<K, M>::balancingTree(Node *node) noexcept {
       grandpar->color = kRED;
       node = grandpar;
     } else {
-      if (node == parent->right && parent == grandpar->left) {
+      if (node == parent->child[kRIGHT] && parent == grandpar->child[kLEFT]) {
         rotateLeft(parent);
         node = parent;
         parent = node->parent;
-      } else if (node == parent->left && parent == grandpar->right) {
+      } else if (node == parent->child[kLEFT] &&
+                 parent == grandpar->child[kRIGHT]) {
         rotateRight(parent);
         node = parent;
         parent = node->parent;
@@ -406,204 +728,919 @@ void tree<K, M>::balancingTree(Node *node) noexcept {
       parent->color = kBLACK;
       grandpar->color = kRED;
 
-      if (parent == grandpar->left) {
-        rotateRight(grandpar);
-      } else {
-        rotateLeft(grandpar);
-      }
+      if (parent == grandpar->child[kLEFT]) {
+        rotateRight(grandpar);
+      } else {
+        rotateLeft(grandpar);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Inserts a node into the red-black tree.
+ *
+ * @details
+ * This method inserts a given node into the red-black tree, maintaining the
+ * red-black tree properties. If the node is inserted successfully, it may
+ * require rebalancing the tree to maintain its properties. The descent picks
+ * the child by indexing with the comparison result, equal keys go right. A
+ * threaded tree links the node with its neighbours and a summarized tree
+ * updates the summaries up to the root before rebalancing.
+ *
+ * @param[in] insert The node to insert.
+ * @param[in,out] node A reference to the node pointer where the new node will
+ * be inserted.
+ * @param[in] parent The parent of the new node.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::insertNode(Node *insert, Node *&node, Node *parent) {
+  Node **slot = &node;
+
+  while (*slot) {
+    parent = *slot;
+    slot = &parent->child[!lessKeys(insert->pair->first, parent->pair->first)];
+  }
+
+  insert->color = kRED;
+  insert->parent = parent;
+  insert->child[kLEFT] = insert->child[kRIGHT] = nullptr;
+
+  ++size_;
+  *slot = insert;
+
+  if constexpr (L) {
+    threadNode(insert, parent, parent && slot == &parent->child[kRIGHT]);
+  }
+
+  if constexpr (kSUMMARIZED) {
+    summarizePath(insert);
+  }
+
+  if (parent && parent->color == kRED) {
+    balancingTree(insert);
+  }
+
+  if (root_) {
+    root_->color = kBLACK;
+  }
+}
+
+/**
+ * @brief Links an allocated node into the tree.
+ *
+ * @details
+ * The node must not break uniqueness: the duplicate check is done by the
+ * caller, before or after the node is allocated.
+ *
+ * @param[in] node The node to link; ownership passes to the tree.
+ * @return iterator - an iterator to the linked node.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::linkNode(Node *node) -> iterator {
+  if (!sentinel_) {
+    sentinel_ = new Node{std::in_place};
+  }
+
+  insertNode(node, root_);
+
+  return iterator{node, root_, sentinel_};
+}
+
+/**
+ * @brief Inserts a new node with the given key and value into the tree.
+ *
+ * @param[in] pair The pair of key/value for node.
+ * @return iterator - an iterator to the inserted element, or end() if the key
+ * is already present in a unique tree.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::insert(const value_type &pair) -> iterator {
+  if (type_ == kUNIQUE && findNode(root_, pair.first)) {
+    return end();
+  }
+
+  return linkNode(new Node{pair, kRED});
+}
+
+/**
+ * @brief Inserts a new node, moving the given pair into it.
+ *
+ * @details
+ * The duplicate check is done before the pair is touched, so a rejected pair
+ * is left intact.
+ *
+ * @param[in] pair The pair of key/value for node.
+ * @return iterator - an iterator to the inserted element, or end() if the key
+ * is already present in a unique tree.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::insert(value_type &&pair) -> iterator {
+  if (type_ == kUNIQUE && findNode(root_, pair.first)) {
+    return end();
+  }
+
+  return linkNode(new Node{std::in_place, std::move(pair)});
+}
+
+/**
+ * @brief Inserts a new element into the tree, constructed in place.
+ *
+ * @details
+ * This method constructs a new element directly in the tree using the provided
+ * arguments, and inserts it into the tree. The key is only known once the
+ * element is built, so a rejected element is constructed and destroyed.
+ *
+ * @tparam Args The types of the arguments to forward to the constructor of the
+ * element.
+ * @param args The arguments to forward to the constructor of the element.
+ * @return A pair consisting of an iterator to the inserted element (or to the
+ * element that prevented the insertion) and a bool denoting whether the
+ * insertion took place.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename... Args>
+auto tree<K, M, C, L, S>::emplace(Args &&...args) -> std::pair<iterator, bool> {
+  Node *new_node = new Node{std::in_place, std::forward<Args>(args)...};
+  Node *found = (type_ == kUNIQUE) ? findNode(root_, new_node->pair->first)
+                                   : nullptr;
+
+  if (found) {
+    delete new_node;
+    return {iterator{found, root_, sentinel_}, false};
+  }
+
+  return {linkNode(new_node), true};
+}
+
+/**
+ * @brief Inserts an element with the given key if the key is not present.
+ *
+ * @details
+ * Unlike emplace(), the key is looked up first, so nothing is constructed when
+ * the key is present. Otherwise the key is forwarded (copied or moved) into the
+ * new node and the value is built from args directly in it.
+ *
+ * @tparam Key The type of the key argument.
+ * @tparam Args The types of the arguments for the value constructor.
+ * @param[in] key The key of the element.
+ * @param args The arguments to forward to the constructor of the value.
+ * @return A pair consisting of an iterator to the inserted element (or to the
+ * element that prevented the insertion) and a bool denoting whether the
+ * insertion took place.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key, typename... Args>
+auto tree<K, M, C, L, S>::try_emplace(Key &&key, Args &&...args)
+    -> std::pair<iterator, bool> {
+  Node *found = (type_ == kUNIQUE) ? findNode(root_, key) : nullptr;
+
+  if (found) {
+    return {iterator{found, root_, sentinel_}, false};
+  }
+
+  Node *new_node =
+      new Node{std::in_place, std::piecewise_construct,
+               std::forward_as_tuple(std::forward<Key>(key)),
+               std::forward_as_tuple(std::forward<Args>(args)...)};
+
+  return {linkNode(new_node), true};
+}
+
+/**
+ * @brief Assigns to the value of an element or inserts a new element.
+ *
+ * @details
+ * In a summarized tree the summaries above an assigned element are refreshed,
+ * so this is the way to change a value in place.
+ *
+ * @tparam Obj The type of the value argument.
+ * @param[in] key The key of the element.
+ * @param[in] obj The value to assign or insert.
+ * @return A pair consisting of an iterator to the element and a bool denoting
+ * whether the insertion took place.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Obj>
+auto tree<K, M, C, L, S>::insert_or_assign(const key_type &key, Obj &&obj)
+    -> std::pair<iterator, bool> {
+  Node *found = findNode(root_, key);
+
+  if (!found) {
+    return try_emplace(key, std::forward<Obj>(obj));
+  }
+
+  found->pair->second = std::forward<Obj>(obj);
+
+  if constexpr (kSUMMARIZED) {
+    summarizePath(found);
+  }
+
+  return {iterator{found, root_, sentinel_}, false};
+}
+
+// VISITATION
+
+/**
+ * @brief Calls a function for every element in ascending key order.
+ *
+ * @details
+ * Unlike a loop over iterators, the traversal keeps no iterator state and
+ * calls the function directly, so it can be inlined. The function may stop
+ * the traversal early by returning false; a function returning void always
+ * visits every element.
+ *
+ * @tparam F The type of the function.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename F>
+bool tree<K, M, C, L, S>::for_each(F &&fn) const {
+  if constexpr (L) {
+    Node *node = (root_) ? sentinel_->link[kRIGHT] : sentinel_;
+
+    for (; node != sentinel_; node = node->link[kRIGHT]) {
+      if (!visitNode(fn, *node->pair)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  return visitNodes(root_, nullptr, nullptr, fn);
+}
+
+/**
+ * @brief Calls a function for every element with a key in [lo, hi).
+ *
+ * @details
+ * Only the subtrees overlapping the range are entered, and keys are compared
+ * only along the paths to the two bounds: the subtrees between them are
+ * visited without any comparison. The elements are visited in ascending key
+ * order and the function may stop the traversal early as in for_each().
+ *
+ * @tparam F The type of the function.
+ * @param[in] lo The lowest key to visit.
+ * @param[in] hi The key to stop at, not visited itself.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename F>
+bool tree<K, M, C, L, S>::for_each_in_range(const key_type &lo,
+                                            const key_type &hi,
+                                            F &&fn) const {
+  return visitNodes(root_, &lo, &hi, fn);
+}
+
+/**
+ * @brief Calls a visitor with an element.
+ *
+ * @tparam F The type of the visitor.
+ * @param[in] fn The visitor.
+ * @param[in] pair The element to visit.
+ * @return bool - false if the visitor asks to stop, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename F>
+bool tree<K, M, C, L, S>::visitNode(F &fn, value_type &pair) {
+  if constexpr (std::is_void_v<std::invoke_result_t<F &, value_type &>>) {
+    fn(pair);
+
+    return true;
+  } else {
+    return static_cast<bool>(fn(pair));
+  }
+}
+
+/**
+ * @brief Visits the nodes of a subtree with keys in [lo, hi) in order.
+ *
+ * @details
+ * Left subtrees are visited recursively and right ones in the loop, so the
+ * recursion depth is bounded by the height of the tree. A bound is dropped
+ * (set to nullptr) as soon as the whole remaining subtree is known to satisfy
+ * it: everything left of a key below hi is below hi, and everything right of a
+ * key not below lo is not below lo.
+ *
+ * @tparam F The type of the visitor.
+ * @param[in] node The root of the subtree.
+ * @param[in] lo The lowest key to visit, or nullptr for no lower bound.
+ * @param[in] hi The key to stop at, or nullptr for no upper bound.
+ * @param[in] fn The visitor.
+ * @return bool - false if the visitor stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename F>
+bool tree<K, M, C, L, S>::visitNodes(Node *node, const key_type *lo,
+                                     const key_type *hi, F &fn) const {
+  while (node) {
+    bool after_lo = !lo || !lessKeys(node->pair->first, *lo);
+    bool before_hi = !hi || lessKeys(node->pair->first, *hi);
+
+    if (after_lo &&
+        !visitNodes(node->child[kLEFT], lo, (before_hi) ? nullptr : hi, fn)) {
+      return false;
+    }
+
+    if (!before_hi) {
+      return true;
+    }
+
+    if (after_lo && !visitNode(fn, *node->pair)) {
+      return false;
+    }
+
+    lo = (after_lo) ? nullptr : lo;
+    node = node->child[kRIGHT];
+  }
+
+  return true;
+}
+
+// SUMMARIES
+
+/**
+ * @brief Returns the summary of all elements.
+ *
+ * @details
+ * Available only with a summary policy. Takes O(1).
+ *
+ * @return std::optional - the summary, or nullopt if the tree is empty.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Sum>
+auto tree<K, M, C, L, S>::aggregate() const
+    -> std::optional<typename Sum::type> {
+  if (!root_) {
+    return std::nullopt;
+  }
+
+  return root_->summary;
+}
+
+/**
+ * @brief Returns the summary of the elements with keys in [lo, hi).
+ *
+ * @details
+ * Available only with a summary policy. The walk follows the paths to both
+ * bounds and takes the stored summary of every subtree lying between them, so
+ * it takes O(log n) whatever the size of the range.
+ *
+ * @param[in] lo The lowest key to include.
+ * @param[in] hi The key to stop at, not included itself.
+ * @return std::optional - the summary, or nullopt if the range is empty.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Sum>
+auto tree<K, M, C, L, S>::aggregate(const key_type &lo,
+                                    const key_type &hi) const
+    -> std::optional<typename Sum::type> {
+  std::optional<typename Sum::type> result;
+
+  summarizeRange(root_, &lo, &hi, result);
+
+  return result;
+}
+
+/**
+ * @brief Returns the summary of the elements ordered before a bound of a key.
+ *
+ * @details
+ * Available only with a summary policy. A single descent takes the stored
+ * summaries of the left subtrees it passes, so it takes O(log n). With a
+ * counting summary, the difference of the two bounds is the number of
+ * elements equivalent to the key.
+ *
+ * @param[in] key The key to compare with.
+ * @param[in] upper Whether to stop at the upper bound of the key (the first
+ * element ordered after it) instead of the lower bound.
+ * @return std::optional - the summary, or nullopt if no element is ordered
+ * before the bound.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Sum>
+auto tree<K, M, C, L, S>::aggregate_before(const key_type &key,
+                                           bool upper) const
+    -> std::optional<typename Sum::type> {
+  S policy{};
+  std::optional<typename Sum::type> result;
+
+  for (Node *node = root_; node;) {
+    bool before = (upper) ? !lessKeys(key, node->pair->first)
+                          : lessKeys(node->pair->first, key);
+
+    if (before) {
+      typename Sum::type part = policy(*node->pair);
+
+      if (node->child[kLEFT]) {
+        part = policy(node->child[kLEFT]->summary, part);
+      }
+
+      result = (result) ? policy(*result, part) : part;
+    }
+
+    node = node->child[before];
+  }
+
+  return result;
+}
+
+/**
+ * @brief Calls a function for the elements of the subtrees a predicate enters.
+ *
+ * @details
+ * Available only with a summary policy. The elements are visited in ascending
+ * key order, but a subtree is skipped as a whole when the predicate returns
+ * false for its summary, so a search guided by the summaries (for instance
+ * the greatest interval end, see interval_map) only walks the paths to the
+ * elements it reports: O(log n) per reported element at worst, since every
+ * walk from one reported element to the next is a descent. The function may
+ * stop the traversal early as in for_each().
+ *
+ * @tparam P The type of the predicate.
+ * @tparam F The type of the function.
+ * @param[in] enter The predicate called with the summary of a subtree.
+ * @param[in] fn The function called with a reference to each element.
+ * @return bool - false if the function stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename P, typename F>
+bool tree<K, M, C, L, S>::for_each_summarized(P &&enter, F &&fn) const {
+  return visitSummarized(root_, enter, fn);
+}
+
+/**
+ * @brief Recomputes the summary of a node from its element and children.
+ *
+ * @param[in,out] node The node whose children are already up to date.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::summarizeNode(Node *node) const noexcept {
+  S policy{};
+  typename S::type summary = policy(*node->pair);
+
+  if (node->child[kLEFT]) {
+    summary = policy(node->child[kLEFT]->summary, summary);
+  }
+
+  if (node->child[kRIGHT]) {
+    summary = policy(summary, node->child[kRIGHT]->summary);
+  }
+
+  node->summary = std::move(summary);
+}
+
+/**
+ * @brief Recomputes the summaries from a node up to the root.
+ *
+ * @param[in,out] node The lowest node to update, or nullptr to do nothing.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::summarizePath(Node *node) const noexcept {
+  for (; node; node = node->parent) {
+    summarizeNode(node);
+  }
+}
+
+/**
+ * @brief Recomputes the summaries of a whole subtree.
+ *
+ * @param[in,out] node The root of the subtree.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::summarizeTree(Node *node) const noexcept {
+  if (node) {
+    summarizeTree(node->child[kLEFT]);
+    summarizeTree(node->child[kRIGHT]);
+    summarizeNode(node);
+  }
+}
+
+/**
+ * @brief Combines the summaries of a subtree with keys in [lo, hi).
+ *
+ * @details
+ * Walks like visitNodes(), but once both bounds are dropped the rest of the
+ * subtree lies inside the range and its stored summary is taken as a whole.
+ * The parts are combined in key order.
+ *
+ * @tparam T The summary type.
+ * @param[in] node The root of the subtree.
+ * @param[in] lo The lowest key to include, or nullptr for no lower bound.
+ * @param[in] hi The key to stop at, or nullptr for no upper bound.
+ * @param[in,out] result The summary of the elements before the subtree, which
+ * receives the elements of the subtree.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename T>
+void tree<K, M, C, L, S>::summarizeRange(Node *node, const key_type *lo,
+                                         const key_type *hi,
+                                         std::optional<T> &result) const {
+  S policy{};
+
+  while (node) {
+    if (!lo && !hi) {
+      result = (result) ? policy(*result, node->summary) : node->summary;
+
+      return;
+    }
+
+    bool after_lo = !lo || !lessKeys(node->pair->first, *lo);
+    bool before_hi = !hi || lessKeys(node->pair->first, *hi);
+
+    if (after_lo) {
+      summarizeRange(node->child[kLEFT], lo, (before_hi) ? nullptr : hi,
+                     result);
+    }
+
+    if (!before_hi) {
+      return;
+    }
+
+    if (after_lo) {
+      T own = policy(*node->pair);
+
+      result = (result) ? policy(*result, own) : own;
+    }
+
+    lo = (after_lo) ? nullptr : lo;
+    node = node->child[kRIGHT];
+  }
+}
+
+/**
+ * @brief Visits in order the nodes of the subtrees a predicate enters.
+ *
+ * @details
+ * Left subtrees are visited recursively and right ones in the loop, as in
+ * visitNodes().
+ *
+ * @tparam P The type of the predicate.
+ * @tparam F The type of the visitor.
+ * @param[in] node The root of the subtree.
+ * @param[in] enter The predicate called with the summary of a subtree.
+ * @param[in] fn The visitor.
+ * @return bool - false if the visitor stopped the traversal, true otherwise.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename P, typename F>
+bool tree<K, M, C, L, S>::visitSummarized(Node *node, P &enter,
+                                          F &fn) const {
+  while (node && enter(std::as_const(node->summary))) {
+    if (!visitSummarized(node->child[kLEFT], enter, fn) ||
+        !visitNode(fn, *node->pair)) {
+      return false;
     }
+
+    node = node->child[kRIGHT];
   }
+
+  return true;
 }
 
+// BULK INSERTION
+
 /**
- * @brief Inserts a node into the red-black tree.
+ * @brief Inserts a batch of elements given as a parameter pack.
  *
  * @details
- * This method inserts a given node into the red-black tree, maintaining the
- * red-black tree properties. If the node is inserted successfully, it may
- * require rebalancing the tree to maintain its properties.
+ * Every argument is converted into a node value once, then the whole batch is
+ * sorted and inserted in one ordered pass (see insertBatch()).
+ *
+ * @tparam Iter Iterator type reported in the results (must be constructible
+ * from iterator).
+ * @tparam Args Types of the values to insert.
+ * @param args Values to insert, each convertible to value_type.
+ * @return A vector of <iterator,bool> pairs in the order of the arguments. A
+ * rejected duplicate is reported with the iterator of the element that
+ * blocked it and false.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Iter, typename... Args>
+auto tree<K, M, C, L, S>::insert_many(Args &&...args)
+    -> vector<std::pair<Iter, bool>> {
+  vector<Node *> nodes;
+
+  nodes.reserve(sizeof...(Args));
+
+  try {
+    (nodes.push_back(new Node{std::in_place, std::forward<Args>(args)}), ...);
+  } catch (...) {
+    deleteNodes(nodes.data(), nodes.size());
+    throw;
+  }
+
+  return insertBatch<Iter>(nodes.data(), nodes.size());
+}
+
+/**
+ * @brief Inserts a batch of elements taken from the range [first, last).
  *
- * @param[in] insert The node to insert.
- * @param[in,out] node A reference to the node pointer where the new node will
- * be inserted.
- * @param[in] parent The parent of the new node.
+ * @tparam Iter Iterator type reported in the results (must be constructible
+ * from iterator).
+ * @tparam InputIt Type of the range iterators.
+ * @tparam Make Callable building a value_type from a range element.
+ * @param[in] first The beginning of the range.
+ * @param[in] last The end of the range.
+ * @param[in] make Converts a range element into a node value.
+ * @return A vector of <iterator,bool> pairs in the order of the range. A
+ * rejected duplicate is reported with the iterator of the element that
+ * blocked it and false.
  */
-template <typename K, typename M>
-void tree<K, M>::insertNode(Node *insert, Node *&node, Node *parent) {
-  if (!node) {
-    insert->color = kRED;
-    insert->parent = parent;
-    insert->left = insert->right = nullptr;
-
-    ++size_;
-    node = insert;
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Iter, typename InputIt, typename Make>
+auto tree<K, M, C, L, S>::insert_range(InputIt first, InputIt last, Make make)
+    -> vector<std::pair<Iter, bool>> {
+  vector<Node *> nodes;
 
-    if (node->parent && node->parent->color == kRED) {
-      balancingTree(node);
-    }
-  } else {
-    if (insert->pair->first < node->pair->first) {
-      insertNode(insert, node->left, node);
-    } else {
-      insertNode(insert, node->right, node);
+  try {
+    for (; first != last; ++first) {
+      nodes.push_back(nullptr);
+      nodes[nodes.size() - 1] = new Node{std::in_place, make(*first)};
     }
+  } catch (...) {
+    deleteNodes(nodes.data(), nodes.size());
+    throw;
   }
 
-  if (root_) {
-    root_->color = kBLACK;
-  }
+  return insertBatch<Iter>(nodes.data(), nodes.size());
 }
 
 /**
- * @brief Inserts a new node with the given key and value into the tree.
+ * @brief Deletes the nodes of a batch that could not be built completely.
  *
- * @param[in] pair The pair of key/value for node.
+ * @param[in] nodes The nodes, possibly ending with a null pointer.
+ * @param[in] count The number of nodes.
  */
-template <typename K, typename M>
-auto tree<K, M>::insert(const value_type &pair) -> iterator {
-  if (type_ == kUNIQUE && findNode(root_, pair.first)) {
-    return end();
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::deleteNodes(Node **nodes, size_type count) noexcept {
+  for (size_type i = 0; i < count; ++i) {
+    delete nodes[i];
+  }
+}
+
+/**
+ * @brief Inserts already allocated nodes as one sorted batch.
+ *
+ * @details
+ * The nodes are stable-sorted by key, so equal keys keep the order in which
+ * they were passed. A batch that is small compared to the tree is inserted in
+ * one ascending sweep, where each descent starts from the previously inserted
+ * node instead of the root. A batch that is large compared to the tree (more
+ * than size() / height elements) is merged with the in-order sequence of the
+ * existing nodes and the tree is rebuilt in linear time. Existing nodes are
+ * relinked, never reallocated. In unique mode a batch element whose key is
+ * already present is deleted and reported as not inserted, with the element
+ * holding the key.
+ *
+ * @param[in] nodes The nodes to insert; ownership passes to the tree.
+ * @param[in] count The number of nodes.
+ * @return A vector of <iterator,bool> pairs in the order of the nodes.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Iter>
+auto tree<K, M, C, L, S>::insertBatch(Node **nodes, size_type count)
+    -> vector<std::pair<Iter, bool>> {
+  vector<std::pair<Iter, bool>> result(count);
+
+  if (!count) {
+    return result;
   }
 
   if (!sentinel_) {
-    sentinel_ = new Node{value_type{}};
+    sentinel_ = new Node{std::in_place};
   }
 
-  Node *node_pos = new Node{pair, kRED};
-  insertNode(node_pos, root_);
+  vector<BatchItem> batch(count);
+  vector<Node *> placed(count);
+  vector<bool> inserted(count);
 
-  return iterator{node_pos, root_, sentinel_};
-}
+  for (size_type i = 0; i < count; ++i) {
+    batch[i] = BatchItem{nodes[i], i};
+  }
 
-/**
- * @brief Inserts a new element into the tree, constructed in place.
- *
- * @details
- * This method constructs a new element directly in the tree using the provided
- * arguments, and inserts it into the tree.
- *
- * @tparam Args The types of the arguments to forward to the constructor of the
- * element.
- * @param args The arguments to forward to the constructor of the element.
- * @return A pair consisting of an iterator to the inserted element (or to the
- * element that prevented the insertion) and a bool denoting whether the
- * insertion took place.
- */
-template <typename K, typename M>
-auto tree<K, M>::emplace(K key, M val) -> std::pair<iterator, bool> {
-  Node *new_node = new Node{value_type{key, val}};
+  std::stable_sort(batch.data(), batch.data() + count,
+                   [this](const BatchItem &a, const BatchItem &b) {
+                     return lessKeys(a.first->pair->first,
+                                     b.first->pair->first);
+                   });
 
-  if (type_ == kUNIQUE && findNode(root_, new_node->pair->first)) {
-    delete new_node;
-    return {end(), false};
+  size_type height{};
+
+  for (size_type n = size_; n; n >>= 1) {
+    ++height;
   }
 
-  if (!sentinel_) {
-    sentinel_ = new Node{value_type{}};
+  if (size_ <= count * height) {
+    rebuildBatch(batch.data(), count, placed.data(), inserted.data());
+  } else {
+    sweepBatch(batch.data(), count, placed.data(), inserted.data());
   }
 
-  insertNode(new_node, root_);
+  for (size_type i = 0; i < count; ++i) {
+    result[i] = std::pair<Iter, bool>{iterator{placed[i], root_, sentinel_},
+                                      inserted[i]};
+  }
 
-  return {iterator{new_node, root_, sentinel_}, true};
+  return result;
 }
 
-// NODES DELETION
-
 /**
- * @brief Handles the case where the node to delete has a red parent and a black
- * brother with a red left child.
+ * @brief Inserts a sorted batch into the tree in one ascending sweep.
  *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::redParBlackSonRedLeft(Node *&node) noexcept {
-  Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
-  bool is_left = (parent->left == node) ? true : false;
+ * @details
+ * Since keys arrive in ascending order, the next key never belongs to the left
+ * of the previously placed node. The descent therefore starts from the lowest
+ * ancestor of that node whose subtree can still hold the key, which costs
+ * O(log d) for a distance d between neighbouring keys instead of a full
+ * descent from the root.
+ *
+ * @param[in] batch The nodes sorted by key, paired with their batch positions.
+ * @param[in] count The number of nodes.
+ * @param[out] placed The node holding each key, by batch position.
+ * @param[out] inserted Whether each node was inserted, by batch position.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::sweepBatch(BatchItem *batch, size_type count,
+                                     Node **placed, bool *inserted) {
+  Node *prev{};
+
+  for (size_type i = 0; i < count; ++i) {
+    Node *node = batch[i].first;
+    Node *start = (prev) ? prev : root_;
+
+    while (start && start->parent &&
+           !(start == start->parent->child[kLEFT] &&
+             lessKeys(node->pair->first, start->parent->pair->first))) {
+      start = start->parent;
+    }
+
+    Node *found =
+        (type_ == kUNIQUE) ? findNode(start, node->pair->first) : nullptr;
+
+    if (found) {
+      delete node;
+      prev = found;
+    } else {
+      Node *parent = (start) ? start->parent : nullptr;
+      Node *&slot = (!parent) ? root_
+                              : parent->child[start != parent->child[kLEFT]];
+
+      insertNode(node, slot, parent);
+      prev = node;
+    }
 
-  removeConnect(node);
-  (is_left) ? rotateLeft(brother->parent) : rotateRight(brother->parent);
-  swapColors(brother);
+    placed[batch[i].second] = prev;
+    inserted[batch[i].second] = !found;
+  }
 }
 
 /**
- * @brief Handles the case where the node to delete has a red parent and a black
- * brother with a red right child.
+ * @brief Merges a sorted batch with the tree and rebuilds it.
  *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::redParBlackSonRedRight(Node *&node) noexcept {
-  Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
-  bool is_left = (parent->left == node) ? true : false;
+ * @details
+ * The existing nodes are collected in order and merged with the batch (an
+ * existing node goes first among equal keys). The merged sequence is then
+ * relinked into a perfectly balanced tree.
+ *
+ * @param[in] batch The nodes sorted by key, paired with their batch positions.
+ * @param[in] count The number of nodes.
+ * @param[out] placed The node holding each key, by batch position.
+ * @param[out] inserted Whether each node was inserted, by batch position.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::rebuildBatch(BatchItem *batch, size_type count,
+                                       Node **placed, bool *inserted) {
+  vector<Node *> flat(size_);
+  vector<Node *> merged;
+  size_type pos{};
+
+  flattenTree(root_, flat.data(), pos);
+  merged.reserve(size_ + count);
+
+  for (size_type i = 0, j = 0; i < size_ || j < count;) {
+    if (j == count ||
+        (i < size_ &&
+         !lessKeys(batch[j].first->pair->first, flat[i]->pair->first))) {
+      merged.push_back(flat[i++]);
+    } else {
+      Node *node = batch[j].first;
+      Node *last = (merged.empty()) ? nullptr : merged[merged.size() - 1];
+      bool duplicate = type_ == kUNIQUE && last &&
+                       !lessKeys(last->pair->first, node->pair->first);
+
+      if (duplicate) {
+        delete node;
+      } else {
+        merged.push_back(node);
+      }
+
+      placed[batch[j].second] = (duplicate) ? last : node;
+      inserted[batch[j].second] = !duplicate;
+      ++j;
+    }
+  }
+
+  size_type full_levels{};
+
+  while ((size_type{2} << full_levels) - 1 <= merged.size()) {
+    ++full_levels;
+  }
+
+  size_ = merged.size();
+  root_ = buildBalanced(merged.data(), size_, nullptr, 0, full_levels);
 
-  removeConnect(node);
-  (is_left) ? rotateRight(brother) : rotateLeft(brother);
-  std::swap(brother->color, brother->parent->color);
-  (is_left) ? rotateLeft(parent) : rotateRight(parent);
-  swapColors(parent->parent);
+  if constexpr (L) {
+    threadSequence(merged.data(), size_);
+  }
+
+  if constexpr (kSUMMARIZED) {
+    summarizeTree(root_);
+  }
 }
 
 /**
- * @brief Handles the case where the node to delete has a black parent and a red
- * brother with a black right child.
+ * @brief Writes the nodes of a subtree in ascending order.
  *
- * @param[in,out] node The node to delete.
+ * @param[in] node The root of the subtree.
+ * @param[out] out The array receiving the nodes.
+ * @param[in,out] pos The next free position in the array.
  */
-template <typename K, typename M>
-void tree<K, M>::blackParRedSonBlackRight(Node *&node) noexcept {
-  Node *parent = node->parent;
-  bool is_left = (parent->left == node) ? true : false;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
-  Node *grandson = (is_left) ? brother->left : brother->right;
-
-  std::swap(brother->color, grandson->color);
-  removeConnect(node);
-  (is_left) ? rotateLeft(parent) : rotateRight(parent);
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::flattenTree(Node *node, Node **out,
+                                      size_type &pos) noexcept {
+  if (node) {
+    flattenTree(node->child[kLEFT], out, pos);
+    out[pos++] = node;
+    flattenTree(node->child[kRIGHT], out, pos);
+  }
 }
 
 /**
- * @brief Handles the case where the node to delete has a black parent and a red
- * brother with a black right child and a red left child.
+ * @brief Links sorted nodes into a balanced red-black subtree.
  *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::blackParRedBrosBlackRightRedLeft(Node *&node) noexcept {
-  Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
+ * @details
+ * The middle node becomes the root of each subtree, so all leaves end up on
+ * the last two levels. The nodes of the incomplete last level are colored red
+ * and every other node black, which gives every path the same black height.
+ *
+ * @param[in] nodes The nodes sorted by key.
+ * @param[in] count The number of nodes.
+ * @param[in] parent The parent of the subtree root.
+ * @param[in] depth The depth of the subtree root.
+ * @param[in] red_depth The depth from which nodes are colored red.
+ * @return Node* - the root of the built subtree.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::buildBalanced(Node **nodes, size_type count,
+                                        Node *parent, size_type depth,
+                                        size_type red_depth) noexcept
+    -> Node * {
+  if (!count) {
+    return nullptr;
+  }
+
+  size_type mid = count / 2;
+  Node *node = nodes[mid];
 
-  removeConnect(node);
-  rotateLeft(brother->parent);
-  std::swap(brother->color, parent->color);
-  rotateLeft(parent);
-  swapColors(parent->parent);
+  node->parent = parent;
+  node->color = (depth >= red_depth) ? kRED : kBLACK;
+  node->child[kLEFT] = buildBalanced(nodes, mid, node, depth + 1, red_depth);
+  node->child[kRIGHT] = buildBalanced(nodes + mid + 1, count - mid - 1, node,
+                              depth + 1, red_depth);
+
+  return node;
 }
 
+// NODES DELETION
+
 /**
  * @brief Fix to a double black violation.
  *
  * @param[in,out] node The node with the double black violation.
  */
-template <typename K, typename M>
-void tree<K, M>::fixDoubleBlack(Node *&node) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::fixDoubleBlack(Node *&node) noexcept {
   if (node == root_) {
     return;
   }
 
   Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
+  Node *brother = parent->child[parent->child[kLEFT] == node];
 
   if (brother->color == kRED) {
     parent->color = kRED;
     brother->color = kBLACK;
 
-    (brother == parent->left) ? rotateRight(parent) : rotateLeft(parent);
+    (brother == parent->child[kLEFT]) ? rotateRight(parent)
+                                      : rotateLeft(parent);
     fixDoubleBlack(node);
   } else {
-    if ((brother->left && brother->left->color == kBLACK) &&
-        (brother->right && brother->right->color == kBLACK)) {
+    if ((!brother->child[kLEFT] || brother->child[kLEFT]->color == kBLACK) &&
+        (!brother->child[kRIGHT] || brother->child[kRIGHT]->color == kBLACK)) {
       brother->color = kRED;
       if (parent->color == kBLACK) {
         fixDoubleBlack(parent);
@@ -611,24 +1648,26 @@ void tree<K, M>::fixDoubleBlack(Node *&node) noexcept {
         parent->color = kBLACK;
       }
     } else {
-      if (brother == parent->left) {
-        if (brother->left && brother->left->color == kRED) {
-          brother->left->color = std::exchange(brother->color, parent->color);
+      if (brother == parent->child[kLEFT]) {
+        if (brother->child[kLEFT] && brother->child[kLEFT]->color == kRED) {
+          brother->child[kLEFT]->color =
+              std::exchange(brother->color, parent->color);
           rotateRight(parent);
         } else {
-          if (brother->right && brother->right->color == kRED) {
-            brother->right->color = parent->color;
+          if (brother->child[kRIGHT] && brother->child[kRIGHT]->color == kRED) {
+            brother->child[kRIGHT]->color = parent->color;
             rotateLeft(brother);
             rotateRight(parent);
           }
         }
       } else {
-        if (brother->right && brother->right->color == kRED) {
-          brother->right->color = std::exchange(brother->color, parent->color);
+        if (brother->child[kRIGHT] && brother->child[kRIGHT]->color == kRED) {
+          brother->child[kRIGHT]->color =
+              std::exchange(brother->color, parent->color);
           rotateLeft(parent);
         } else {
-          if (brother->left && brother->left->color == kRED) {
-            brother->left->color = parent->color;
+          if (brother->child[kLEFT] && brother->child[kLEFT]->color == kRED) {
+            brother->child[kLEFT]->color = parent->color;
             rotateRight(brother);
             rotateLeft(parent);
           }
@@ -639,208 +1678,18 @@ void tree<K, M>::fixDoubleBlack(Node *&node) noexcept {
   }
 }
 
-/**
- * @brief Handles the case where the node to delete has a black parent and a
- * black brother with no children.
- *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::blackParBlackBrosBlackAll(Node *&node) noexcept {
-  Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
-
-  brother->color = kRED;
-  removeConnect(node);
-
-  if (parent->color == kBLACK) {
-    fixDoubleBlack(parent);
-  } else {
-    parent->color = kBLACK;
-  }
-}
-
-/**
- * @brief Handles the case where the node to delete has a black parent and a
- * black brother with a red right grandchild.
- *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::blackParBlackBrosRedRightGran(Node *&node) noexcept {
-  Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
-  bool is_left = (parent->left == node) ? true : false;
-
-  removeConnect(node);
-  (is_left) ? rotateRight(brother) : rotateLeft(brother);
-  std::swap(brother->color, brother->parent->color);
-  (is_left) ? rotateLeft(parent) : rotateRight(parent);
-  brother->color = kBLACK;
-}
-
-/**
- * @brief Handles the case where the node to delete has a black parent and a
- * black brother with a red left child or all grandchildren.
- *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::blackParBlackBrosRedLeftOrAllGran(Node *&node) noexcept {
-  Node *parent = node->parent;
-  bool is_left = (parent->left == node) ? true : false;
-
-  removeConnect(node);
-  if (is_left) {
-    rotateLeft(parent);
-    if (parent->parent && parent->parent->right) {
-      parent->parent->right->color = kBLACK;
-    } else if (root_ == parent) {
-      root_->right->color = kBLACK;
-    }
-  } else {
-    rotateRight(parent);
-    if (parent->parent && parent->parent->left) {
-      parent->parent->left->color = kBLACK;
-    } else if (root_ == parent) {
-      root_->left->color = kBLACK;
-    }
-  }
-}
-
-/**
- * @brief Deletes a black node with no children.
- *
- * @param[in,out] node The node to delete.
- */
-template <typename K, typename M>
-void tree<K, M>::deleteBlackNoChild(Node *&node) noexcept {
-  if (!node->parent) {
-    return;
-  }
-
-  Node *parent = node->parent;
-  Node *brother = (parent->left == node) ? parent->right : parent->left;
-  bool is_left = (parent->left == node) ? true : false;
-
-  if (brother && parent->color == kRED && brother->color == kBLACK) {
-    if (!brother->left && !brother->right) {
-      std::swap(brother->color, parent->color);
-      removeConnect(node);
-    } else if ((is_left && brother->right && brother->right->color == kRED) ||
-               (!is_left && brother->left && brother->left->color == kRED)) {
-      redParBlackSonRedLeft(node);
-    } else if ((is_left && brother->left && brother->left->color == kRED) ||
-               (!is_left && brother->right && brother->right->color == kRED)) {
-      redParBlackSonRedRight(node);
-    }
-  } else if (brother && parent->color == kBLACK && brother->color == kBLACK) {
-    if (!brother->left && !brother->right) {
-      blackParBlackBrosBlackAll(node);
-    } else if ((is_left && !brother->right && brother->left) ||
-               (!is_left && !brother->left && brother->right)) {
-      blackParBlackBrosRedRightGran(node);
-    } else {
-      blackParBlackBrosRedLeftOrAllGran(node);
-    }
-  } else if (brother && node->parent->color == kBLACK &&
-             brother->color == kRED) {
-    if ((is_left && brother->left && brother->left->color == kBLACK) ||
-        (!is_left && brother->right && brother->right->color == kBLACK)) {
-      Node *grgrson = (is_left) ? brother->left->right : brother->right->left;
-      if (grgrson && grgrson->color == kRED) {
-        blackParRedBrosBlackRightRedLeft(node);
-      } else {
-        blackParRedSonBlackRight(node);
-      }
-    }
-  }
-}
-
-/**
- * @brief Deletes a node with one child from the red-black tree.
- *
- * @details
- * This method handles the deletion of a node that has exactly one child. It
- * swaps the values of the node to be deleted with its child, and then removes
- * the child node. This ensures that the tree properties are maintained.
- *
- * @param[in,out] node The node to delete. It must have exactly one child.
- * @param[in,out] child The child of the node to delete.
- * @return Node* - a pointer to the node that was actually deleted.
- */
-template <typename K, typename M>
-auto tree<K, M>::deleteOneChild(Node *&node, Node *&child) noexcept -> Node * {
-  Node *ch = child;
-
-  value_type node_copy{*node->pair};
-
-  delete node->pair;
-  node->pair = new value_type{*child->pair};
-  delete child->pair;
-  child->pair = new value_type{node_copy};
-
-  child = nullptr;
-
-  return ch;
-}
-
-/**
- * @brief Deletes a node with two children from the red-black tree.
- *
- * @details
- * This method handles the deletion of a node that has two children. It finds
- * the in-order successor or predecessor of the node to be deleted, swaps the
- * values, and then deletes the successor or predecessor node. The method
- * handles different cases based on the color of the node and the number of its
- * children.
- *
- * @param[in,out] node The node to delete. It must have two children.
- * @return Node* - a pointer to the node that was actually deleted.
- */
-template <typename K, typename M>
-auto tree<K, M>::deleteTwoChild(Node *&node) noexcept -> Node * {
-  Node *swap = findMax(node->left);
-  Node *to_del{swap};
-
-  if (!(swap && !(swap->left && swap->right))) {
-    swap = findMin(node->right);
-  }
-
-  value_type swap_copy{*swap->pair};
-
-  delete swap->pair;
-  swap->pair = new value_type{*node->pair};
-  delete node->pair;
-  node->pair = new value_type{swap_copy};
-
-  if (!swap->left && !swap->right) {
-    if (swap->color == kRED) {
-      removeConnect(swap);
-    } else {
-      deleteBlackNoChild(swap);
-    }
-  } else if (!swap->left && swap->right) {
-    to_del = deleteOneChild(swap, swap->right);
-  } else if (swap->left && !swap->right) {
-    to_del = deleteOneChild(swap, swap->left);
-  }
-
-  return to_del;
-}
-
 /**
  * @brief Removes parents connect with given node.
  *
  * @param[in,out] node Node to break connection with.
  */
-template <typename K, typename M>
-void tree<K, M>::removeConnect(Node *node) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::removeConnect(Node *node) noexcept {
   if (node->parent) {
-    if (node->parent->left == node) {
-      node->parent->left = nullptr;
+    if (node->parent->child[kLEFT] == node) {
+      node->parent->child[kLEFT] = nullptr;
     } else {
-      node->parent->right = nullptr;
+      node->parent->child[kRIGHT] = nullptr;
     }
   }
 }
@@ -850,36 +1699,59 @@ void tree<K, M>::removeConnect(Node *node) noexcept {
  *
  * @details
  * This method extracts a given node from the red-black tree, maintaining the
- * red-black tree properties. The method handles different cases based on the
- * color of the node and the number of its children.
+ * red-black tree properties. A node with two children exchanges its pair with
+ * the in-order predecessor, which has at most one child. A node with one child
+ * (always black with a red leaf child) exchanges its pair with that child, and
+ * the child is detached. A black leaf first resolves the double black
+ * violation and is then detached. The exchanged pairs all lie on the path from
+ * the detached node to the root, so refreshing the summaries along that path
+ * (before the rotations of the fix and again after detaching) is enough.
  *
  * @param[in] node The node to extract.
  * @return Node* - a pointer to the node that was extracted.
  */
-template <typename K, typename M>
-auto tree<K, M>::extractNode(Node *node) noexcept -> Node * {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::extractNode(Node *node) noexcept -> Node * {
   if (!node) {
     return nullptr;
   }
 
-  Node *to_del{node};
+  if (node->child[kLEFT] && node->child[kRIGHT]) {
+    Node *swap = findMax(node->child[kLEFT]);
+
+    std::swap(node->pair, swap->pair);
+    node = swap;
+  }
+
+  Node *to_del =
+      (node->child[kLEFT]) ? node->child[kLEFT] : node->child[kRIGHT];
 
-  if (node->color == kRED) {
-    if (!node->left && !node->right) {
-      removeConnect(node);
-    } else if (node->left && node->right) {
-      to_del = deleteTwoChild(node);
+  if (to_del) {
+    std::swap(node->pair, to_del->pair);
+    node->child[kLEFT] = node->child[kRIGHT] = nullptr;
+
+    if constexpr (kSUMMARIZED) {
+      summarizePath(node);
     }
   } else {
-    if (!node->left && !node->right) {
-      deleteBlackNoChild(node);
-    } else if (!node->left && node->right) {
-      to_del = deleteOneChild(node, node->right);
-    } else if (node->left && !node->right) {
-      to_del = deleteOneChild(node, node->left);
-    } else {
-      to_del = deleteTwoChild(node);
+    if constexpr (kSUMMARIZED) {
+      summarizePath(node);
+    }
+
+    if (node->color == kBLACK) {
+      fixDoubleBlack(node);
     }
+
+    removeConnect(node);
+    to_del = node;
+
+    if constexpr (kSUMMARIZED) {
+      summarizePath(node->parent);
+    }
+  }
+
+  if constexpr (L) {
+    unthreadNode(to_del);
   }
 
   --size_;
@@ -898,8 +1770,12 @@ auto tree<K, M>::extractNode(Node *node) noexcept -> Node * {
  *
  * @param[in,out] other The tree to merge into the current tree.
  */
-template <typename K, typename M>
-void tree<K, M>::merge(tree &other) {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::merge(tree &other) {
+  if (!sentinel_ && other.size_) {
+    sentinel_ = new Node{std::in_place};
+  }
+
   if (type_ == kUNIQUE) {
     auto it = other.begin();
 
@@ -935,8 +1811,8 @@ void tree<K, M>::merge(tree &other) {
 /**
  * @brief Cleans the tree by deleting all nodes.
  */
-template <typename K, typename M>
-void tree<K, M>::clear() noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::clear() noexcept {
   if (root_) {
     cleanTree(root_);
   }
@@ -954,36 +1830,132 @@ void tree<K, M>::clear() noexcept {
  * @return iterator - an iterator to the next node after the erased node, or
  * end() if the erased node was the last node.
  */
-template <typename K, typename M>
-auto tree<K, M>::erase(const key_type &key) noexcept -> iterator {
-  Node *node = findNode(root_, key);
-  iterator it = (node) ? ++iterator{node, root_, sentinel_} : end();
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::erase(const key_type &key) noexcept -> iterator {
+  return eraseNode(findNode(root_, key));
+}
+
+/**
+ * @brief Removes the node with a key equivalent to the given value.
+ *
+ * @details
+ * Available only with a transparent comparator.
+ *
+ * @tparam Key The type of the key.
+ * @param[in] key The key of the node to remove.
+ * @return iterator - an iterator to the next node after the erased node, or
+ * end() if the erased node was the last node.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+template <typename Key, typename Cmp, typename, typename>
+auto tree<K, M, C, L, S>::erase(const Key &key) noexcept -> iterator {
+  return eraseNode(findNode(root_, key));
+}
+
+/**
+ * @brief Removes the given node from the tree and deletes it.
+ *
+ * @param[in] node The node to remove, or nullptr to do nothing.
+ * @return iterator - an iterator to the next node after the erased node, or
+ * end() if the erased node was the last node.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::eraseNode(Node *node) noexcept -> iterator {
+  if (!node) {
+    return end();
+  }
+
+  // A node with a single right child hands its pair over to that child, which
+  // is also its successor, so the successor then lives in the node itself.
+  bool lifted = !node->child[kLEFT] && node->child[kRIGHT];
+  Node *next = (lifted) ? node : (++iterator{node, root_, sentinel_}).ptr_;
+
+  delete extractNode(node);
+
+  if (!size_) {
+    root_ = nullptr;
+  }
+
+  // The iterator is rebuilt on the new root, so that it compares equal to
+  // end() and keeps iterating correctly after the rebalancing.
+  return (next == sentinel_) ? end() : iterator{next, root_, sentinel_};
+}
+
+/**
+ * @brief Removes every node with a key equivalent to the given key.
+ *
+ * @details
+ * The nodes are erased in one walk from the lower bound of the key: each
+ * step moves to the in-order successor through the parent links (or the
+ * threads), without a new search from the root, so the cost is O(log n) for
+ * the search plus the rebalancing of each erased node.
+ *
+ * @param[in] key The key of the nodes to remove.
+ * @return size_type - the number of nodes removed.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::erase_all(const key_type &key) noexcept
+    -> size_type {
+  size_type erased{};
+  Node *node = boundNode(key, false);
+
+  while (node && node != sentinel_ && !lessKeys(key, node->pair->first)) {
+    // As in eraseNode(), a node with a single right child takes the pair of
+    // its successor, so the walk goes on from the node itself.
+    bool lifted = !node->child[kLEFT] && node->child[kRIGHT];
+    Node *next = (lifted) ? node : nextNode(node);
 
-  if (node) {
     delete extractNode(node);
+    node = next;
+    ++erased;
+  }
 
-    if (!size_) {
-      root_ = nullptr;
-    }
+  if (!size_) {
+    root_ = nullptr;
   }
 
-  return it;
+  return erased;
+}
+
+/**
+ * @brief Finds the in-order successor of a node without a search from the
+ * root.
+ *
+ * @param[in] node The node.
+ * @return Node* - the successor, or nullptr (the dummy node in a threaded
+ * tree) if the node is the greatest.
+ */
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::nextNode(Node *node) noexcept -> Node * {
+  if constexpr (L) {
+    return node->link[kRIGHT];
+  }
+
+  if (node->child[kRIGHT]) {
+    return findMin(node->child[kRIGHT]);
+  }
+
+  while (node->parent && node == node->parent->child[kRIGHT]) {
+    node = node->parent;
+  }
+
+  return node->parent;
 }
 
 /**
  * @brief Erases the node pointed to by the constant iterator.
  *
  * @details
- * This method erases the node pointed to by the constant iterator. It uses the
- * key of the node to find and remove it from the tree.
+ * This method erases the node pointed to by the constant iterator without
+ * searching for its key, so among equal keys exactly that element is erased.
  *
  * @param[in] it The constant iterator pointing to the node to be erased.
  * @return iterator - an iterator to the next node after the erased node, or
  * end() if the erased node was the last node.
  */
-template <typename K, typename M>
-auto tree<K, M>::erase(const_iterator it) noexcept -> iterator {
-  return erase((*it).first);
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::erase(const_iterator it) noexcept -> iterator {
+  return (it.ptr_ && it.ptr_ != sentinel_) ? eraseNode(it.ptr_) : end();
 }
 
 /**
@@ -998,8 +1970,9 @@ auto tree<K, M>::erase(const_iterator it) noexcept -> iterator {
  * element, or end() if the last erased element was the last element.
  * @throws std::range_error if the range is invalid.
  */
-template <typename K, typename M>
-auto tree<K, M>::erase(const_iterator first, const_iterator last) -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::erase(const_iterator first, const_iterator last)
+    -> iterator {
   if (first == last) {
     return first.toIterator();
   } else if (first == begin() && last == end()) {
@@ -1034,7 +2007,7 @@ auto tree<K, M>::erase(const_iterator first, const_iterator last) -> iterator {
     for (auto it = cbegin(); it != cend(); ++it) {
       auto current = (*it).first;
 
-      if (current >= first_key) {
+      if (!lessKeys(current, first_key)) {
         erase(current);
         it = cbegin();
       }
@@ -1046,7 +2019,7 @@ auto tree<K, M>::erase(const_iterator first, const_iterator last) -> iterator {
     for (auto it = cbegin(); it != cend(); ++it) {
       auto current = (*it).first;
 
-      if (current >= first_key && current < last_key) {
+      if (!lessKeys(current, first_key) && lessKeys(current, last_key)) {
         erase(current);
         it = cbegin();
       }
@@ -1061,11 +2034,11 @@ auto tree<K, M>::erase(const_iterator first, const_iterator last) -> iterator {
  *
  * @param[in,out] node The root node of the tree.
  */
-template <typename K, typename M>
-void tree<K, M>::cleanTree(Node *&node) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::cleanTree(Node *&node) noexcept {
   if (node) {
-    cleanTree(node->left);
-    cleanTree(node->right);
+    cleanTree(node->child[kLEFT]);
+    cleanTree(node->child[kRIGHT]);
 
     delete node;
     node = nullptr;
@@ -1085,13 +2058,13 @@ void tree<K, M>::cleanTree(Node *&node) noexcept {
  *
  * @param[in] node The root node of the tree to copy from.
  */
-template <typename K, typename M>
-void tree<K, M>::copyTree(Node *node) {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::copyTree(Node *node) {
   if (node) {
     insert(*node->pair);
 
-    copyTree(node->left);
-    copyTree(node->right);
+    copyTree(node->child[kLEFT]);
+    copyTree(node->child[kRIGHT]);
   }
 }
 
@@ -1105,9 +2078,9 @@ void tree<K, M>::copyTree(Node *node) {
  * @param[in] last Whether the node is the last child of its parent.
  * @return std::string - a string representation of the tree structure.
  */
-template <typename K, typename M>
-std::string tree<K, M>::printNodes(const Node *node, int indent,
-                                   bool last) const noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+std::string tree<K, M, C, L, S>::printNodes(const Node *node, int indent,
+                                            bool last) const noexcept {
   std::string str{};
 
   if (node) {
@@ -1130,8 +2103,8 @@ std::string tree<K, M>::printNodes(const Node *node, int indent,
       delete[] char_str;
     }
 
-    str += printNodes(node->left, indent + 4, false);
-    str += printNodes(node->right, indent + 4, true);
+    str += printNodes(node->child[kLEFT], indent + 4, false);
+    str += printNodes(node->child[kRIGHT], indent + 4, true);
   }
 
   return str;
@@ -1142,8 +2115,8 @@ std::string tree<K, M>::printNodes(const Node *node, int indent,
  *
  * @return std::string - a string representation of the tree structure.
  */
-template <typename K, typename M>
-std::string tree<K, M>::structure() const noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+std::string tree<K, M, C, L, S>::structure() const noexcept {
   return printNodes(root_);
 }
 
@@ -1156,9 +2129,9 @@ std::string tree<K, M>::structure() const noexcept {
  * @param[in] root The root node of the tree.
  * @param[in] sentinel The sentinel node of the tree.
  */
-template <typename K, typename M>
-tree<K, M>::iterator::TreeIterator(Node *node, Node *root,
-                                   Node *sentinel) noexcept
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::iterator::TreeIterator(Node *node, Node *root,
+                                            Node *sentinel) noexcept
     : TreeConstIterator(node, root, sentinel) {}
 
 /**
@@ -1166,8 +2139,8 @@ tree<K, M>::iterator::TreeIterator(Node *node, Node *root,
  *
  * @param[in] other The iterator to copy from.
  */
-template <typename K, typename M>
-tree<K, M>::iterator::TreeIterator(const iterator &other) noexcept
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::iterator::TreeIterator(const iterator &other) noexcept
     : TreeConstIterator(other.ptr_, other.first_, other.last_) {}
 
 // TREE ITERATOR OPERATORS
@@ -1178,8 +2151,8 @@ tree<K, M>::iterator::TreeIterator(const iterator &other) noexcept
  * @param[in] other The iterator to assign from.
  * @return iterator& - reference to the assigned iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator=(const iterator &other) noexcept
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator=(const iterator &other) noexcept
     -> iterator & {
   // TreeConstIterator(other.ptr_, other.first_, other.last_)
   // setFields(other);
@@ -1195,20 +2168,26 @@ auto tree<K, M>::iterator::operator=(const iterator &other) noexcept
  *
  * @return iterator& - reference to the decremented iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator--() noexcept -> iterator & {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator--() noexcept -> iterator & {
+  if constexpr (L) {
+    this->ptr_ = (this->ptr_) ? this->ptr_->link[kLEFT] : this->ptr_;
+
+    return *this;
+  }
+
   Node *max_node = findMax(this->first_);
 
   if (this->last_ == max_node) {
     std::swap(this->ptr_, this->last_);
   } else if (this->ptr_) {
-    if (this->ptr_->left) {
-      this->ptr_ = findMax(this->ptr_->left);
+    if (this->ptr_->child[kLEFT]) {
+      this->ptr_ = findMax(this->ptr_->child[kLEFT]);
     } else {
       if (this->ptr_ != findMin(this->first_)) {
         Node *parent = this->ptr_->parent;
 
-        while (parent && this->ptr_ == parent->left) {
+        while (parent && this->ptr_ == parent->child[kLEFT]) {
           this->ptr_ = parent;
           parent = parent->parent;
         }
@@ -1226,19 +2205,25 @@ auto tree<K, M>::iterator::operator--() noexcept -> iterator & {
  *
  * @return iterator& - reference to the incremented iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator++() noexcept -> iterator & {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator++() noexcept -> iterator & {
+  if constexpr (L) {
+    this->ptr_ = (this->ptr_) ? this->ptr_->link[kRIGHT] : this->ptr_;
+
+    return *this;
+  }
+
   Node *max_node = findMax(this->first_);
 
   if (this->ptr_ == max_node) {
     std::swap(this->ptr_, this->last_);
   } else if (this->ptr_ && this->last_ != max_node) {
-    if (this->ptr_->right) {
-      this->ptr_ = findMin(this->ptr_->right);
+    if (this->ptr_->child[kRIGHT]) {
+      this->ptr_ = findMin(this->ptr_->child[kRIGHT]);
     } else {
       Node *parent = this->ptr_->parent;
 
-      while (parent && this->ptr_ == parent->right) {
+      while (parent && this->ptr_ == parent->child[kRIGHT]) {
         this->ptr_ = parent;
         parent = parent->parent;
       }
@@ -1256,8 +2241,8 @@ auto tree<K, M>::iterator::operator++() noexcept -> iterator & {
  * @return An `iterator` representing the original position of the iterator
  * before the increment.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator++(int) noexcept -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator++(int) noexcept -> iterator {
   iterator copy{*this};
 
   ++*this;
@@ -1271,8 +2256,8 @@ auto tree<K, M>::iterator::operator++(int) noexcept -> iterator {
  * @return An `iterator` representing the original position of the iterator
  * before the decrement.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator--(int) noexcept -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator--(int) noexcept -> iterator {
   iterator copy{*this};
 
   --*this;
@@ -1286,8 +2271,8 @@ auto tree<K, M>::iterator::operator--(int) noexcept -> iterator {
  * @param[in] shift The number of positions to shift.
  * @return iterator - before the shift.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator+(size_type shift) const noexcept
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator+(size_type shift) const noexcept
     -> iterator {
   iterator copy{*this};
 
@@ -1304,8 +2289,8 @@ auto tree<K, M>::iterator::operator+(size_type shift) const noexcept
  * @param[in] shift The number of positions to shift.
  * @return iterator - before the shift.
  */
-template <typename K, typename M>
-auto tree<K, M>::iterator::operator-(size_type shift) const noexcept
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator-(size_type shift) const noexcept
     -> iterator {
   iterator copy{*this};
 
@@ -1321,8 +2306,8 @@ auto tree<K, M>::iterator::operator-(size_type shift) const noexcept
  *
  * @param[in] shift The number of positions to advance the iterator.
  */
-template <typename K, typename M>
-void tree<K, M>::iterator::operator+=(size_type shift) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::iterator::operator+=(size_type shift) noexcept {
   for (size_type i = 0; i < shift; ++i) {
     ++*this;
   }
@@ -1333,8 +2318,8 @@ void tree<K, M>::iterator::operator+=(size_type shift) noexcept {
  *
  * @param[in] shift The number of positions to move the iterator backward.
  */
-template <typename K, typename M>
-void tree<K, M>::iterator::operator-=(size_type shift) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::iterator::operator-=(size_type shift) noexcept {
   for (size_type i = 0; i < shift; ++i) {
     --*this;
   }
@@ -1346,8 +2331,8 @@ void tree<K, M>::iterator::operator-=(size_type shift) noexcept {
  * @param[in] other The iterator to compare with.
  * @return true if the iterators are equal, false otherwise.
  */
-template <typename K, typename M>
-bool tree<K, M>::iterator::operator==(iterator other) const noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+bool tree<K, M, C, L, S>::iterator::operator==(iterator other) const noexcept {
   return (this->ptr_ == other.ptr_ && this->first_ == other.first_ &&
           this->last_ == other.last_)
              ? true
@@ -1360,8 +2345,8 @@ bool tree<K, M>::iterator::operator==(iterator other) const noexcept {
  * @param[in] other The iterator to compare with.
  * @return true if the iterators are not equal, false otherwise.
  */
-template <typename K, typename M>
-bool tree<K, M>::iterator::operator!=(iterator other) const noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+bool tree<K, M, C, L, S>::iterator::operator!=(iterator other) const noexcept {
   return (this->ptr_ != other.ptr_ || this->first_ != other.first_ ||
           this->last_ != other.last_)
              ? true
@@ -1373,10 +2358,9 @@ bool tree<K, M>::iterator::operator!=(iterator other) const noexcept {
  *
  * @return value_type & - reference to pair in current node.
  */
-template <typename K, typename M>
-std::pair<const K, M &> tree<K, M>::iterator::operator*() noexcept {
-  return std::pair<const K, M &>{this->ptr_->pair->first,
-                                 this->ptr_->pair->second};
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::iterator::operator*() noexcept -> value_type & {
+  return *this->ptr_->pair;
 }
 
 // TREE CONST ITERATOR CONSTRUCTORS
@@ -1388,18 +2372,18 @@ std::pair<const K, M &> tree<K, M>::iterator::operator*() noexcept {
  * @param[in] root The root node of the tree.
  * @param[in] sentinel The sentinel node of the tree.
  */
-template <typename K, typename M>
-tree<K, M>::const_iterator::TreeConstIterator(Node *node, Node *root,
-                                              Node *sentinel) noexcept
-    : ptr_{node}, first_{root}, last_{sentinel} {}
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::const_iterator::TreeConstIterator(Node *node, Node *root,
+                                                       Node *sentinel) noexcept
+    : ptr_{node}, first_{(L) ? nullptr : root}, last_{sentinel} {}
 
 /**
  * @brief Copy constructor for the tree const_iterator.
  *
  * @param[in] other The const_iterator to copy from.
  */
-template <typename K, typename M>
-tree<K, M>::const_iterator::TreeConstIterator(
+template <typename K, typename M, typename C, bool L, typename S>
+tree<K, M, C, L, S>::const_iterator::TreeConstIterator(
     const const_iterator &other) noexcept
     : ptr_{other.ptr_}, first_{other.first_}, last_{other.last_} {}
 
@@ -1415,8 +2399,9 @@ tree<K, M>::const_iterator::TreeConstIterator(
  * @return iterator - A regular iterator initialized with the same position and
  * range as the constant iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::toIterator() const noexcept -> iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::toIterator() const noexcept
+    -> iterator {
   return iterator{ptr_, first_, last_};
 }
 
@@ -1428,9 +2413,9 @@ auto tree<K, M>::const_iterator::toIterator() const noexcept -> iterator {
  * @param[in] other The const_iterator to assign from.
  * @return const_iterator& - reference to the assigned const_iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator=(const const_iterator &other) noexcept
-    -> const_iterator & {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator=(
+    const const_iterator &other) noexcept -> const_iterator & {
   ptr_ = other.ptr_;
   first_ = other.first_;
   last_ = other.last_;
@@ -1443,20 +2428,27 @@ auto tree<K, M>::const_iterator::operator=(const const_iterator &other) noexcept
  *
  * @return const_iterator& - reference to the decremented const_iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator--() noexcept -> const_iterator & {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator--() noexcept
+    -> const_iterator & {
+  if constexpr (L) {
+    ptr_ = (ptr_) ? ptr_->link[kLEFT] : ptr_;
+
+    return *this;
+  }
+
   Node *max_node = findMax(first_);
 
   if (last_ == max_node) {
     std::swap(ptr_, last_);
   } else if (ptr_) {
-    if (ptr_->left) {
-      ptr_ = findMax(ptr_->left);
+    if (ptr_->child[kLEFT]) {
+      ptr_ = findMax(ptr_->child[kLEFT]);
     } else {
       if (ptr_ != findMin(first_)) {
         Node *parent = ptr_->parent;
 
-        while (parent && ptr_ == parent->left) {
+        while (parent && ptr_ == parent->child[kLEFT]) {
           ptr_ = parent;
           parent = parent->parent;
         }
@@ -1474,19 +2466,26 @@ auto tree<K, M>::const_iterator::operator--() noexcept -> const_iterator & {
  *
  * @return const_iterator& - reference to the incremented const_iterator.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator++() noexcept -> const_iterator & {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator++() noexcept
+    -> const_iterator & {
+  if constexpr (L) {
+    ptr_ = (ptr_) ? ptr_->link[kRIGHT] : ptr_;
+
+    return *this;
+  }
+
   Node *max_node = findMax(first_);
 
   if (ptr_ == max_node) {
     std::swap(ptr_, last_);
   } else if (ptr_ && last_ != max_node) {
-    if (ptr_->right) {
-      ptr_ = findMin(ptr_->right);
+    if (ptr_->child[kRIGHT]) {
+      ptr_ = findMin(ptr_->child[kRIGHT]);
     } else {
       Node *parent = ptr_->parent;
 
-      while (parent && ptr_ == parent->right) {
+      while (parent && ptr_ == parent->child[kRIGHT]) {
         ptr_ = parent;
         parent = parent->parent;
       }
@@ -1504,8 +2503,9 @@ auto tree<K, M>::const_iterator::operator++() noexcept -> const_iterator & {
  * @return A `const_iterator` representing the original position of the
  * iterator before the increment.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator++(int) noexcept -> const_iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator++(int) noexcept
+    -> const_iterator {
   const_iterator copy{*this};
 
   ++*this;
@@ -1519,8 +2519,9 @@ auto tree<K, M>::const_iterator::operator++(int) noexcept -> const_iterator {
  * @return A `const_iterator` representing the original position of the
  * iterator before the decrementation.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator--(int) noexcept -> const_iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator--(int) noexcept
+    -> const_iterator {
   const_iterator copy{*this};
 
   --*this;
@@ -1536,9 +2537,9 @@ auto tree<K, M>::const_iterator::operator--(int) noexcept -> const_iterator {
  * @return A `const_iterator` representing the original position of the
  * iterator before the incrementation.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator+(size_type shift) const noexcept
-    -> const_iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator+(
+    size_type shift) const noexcept -> const_iterator {
   const_iterator copy{*this};
 
   for (size_type i = 0; i < shift; ++i) {
@@ -1556,9 +2557,9 @@ auto tree<K, M>::const_iterator::operator+(size_type shift) const noexcept
  * @return A `const_iterator` representing the original position of the
  * iterator before the decrementation.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator-(size_type shift) const noexcept
-    -> const_iterator {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator-(
+    size_type shift) const noexcept -> const_iterator {
   const_iterator copy{*this};
 
   for (size_type i = 0; i < shift; ++i) {
@@ -1573,8 +2574,8 @@ auto tree<K, M>::const_iterator::operator-(size_type shift) const noexcept
  *
  * @param[in] shift The number of positions to move the const_iterator backward.
  */
-template <typename K, typename M>
-void tree<K, M>::const_iterator::operator+=(size_type shift) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::const_iterator::operator+=(size_type shift) noexcept {
   for (size_type i = 0; i < shift; ++i) {
     ++*this;
   }
@@ -1585,8 +2586,8 @@ void tree<K, M>::const_iterator::operator+=(size_type shift) noexcept {
  *
  * @param[in] shift The number of positions to advance the const_iterator.
  */
-template <typename K, typename M>
-void tree<K, M>::const_iterator::operator-=(size_type shift) noexcept {
+template <typename K, typename M, typename C, bool L, typename S>
+void tree<K, M, C, L, S>::const_iterator::operator-=(size_type shift) noexcept {
   for (size_type i = 0; i < shift; ++i) {
     --*this;
   }
@@ -1598,8 +2599,8 @@ void tree<K, M>::const_iterator::operator-=(size_type shift) noexcept {
  * @param[in] other The const_iterator to compare with.
  * @return true if the const_iterators are equal, false otherwise.
  */
-template <typename K, typename M>
-bool tree<K, M>::const_iterator::operator==(
+template <typename K, typename M, typename C, bool L, typename S>
+bool tree<K, M, C, L, S>::const_iterator::operator==(
     const_iterator other) const noexcept {
   return (ptr_ == other.ptr_ && first_ == other.first_ && last_ == other.last_)
              ? true
@@ -1612,8 +2613,8 @@ bool tree<K, M>::const_iterator::operator==(
  * @param[in] other The const_iterator to compare with.
  * @return true if the const_iterators are not equal, false otherwise.
  */
-template <typename K, typename M>
-bool tree<K, M>::const_iterator::operator!=(
+template <typename K, typename M, typename C, bool L, typename S>
+bool tree<K, M, C, L, S>::const_iterator::operator!=(
     const_iterator other) const noexcept {
   return (ptr_ != other.ptr_ || first_ != other.first_ || last_ != other.last_)
              ? true
@@ -1625,8 +2626,8 @@ bool tree<K, M>::const_iterator::operator!=(
  *
  * @return value_type & - reference to pair in current node.
  */
-template <typename K, typename M>
-auto tree<K, M>::const_iterator::operator*() const noexcept
-    -> const value_type {
+template <typename K, typename M, typename C, bool L, typename S>
+auto tree<K, M, C, L, S>::const_iterator::operator*() const noexcept
+    -> const value_type & {
   return *ptr_->pair;
 }
\ No newline at end of file
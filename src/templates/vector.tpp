@@ -23,22 +23,23 @@ using namespace s21;
  * and with nullptr pointers for the array of the vector
  *
  */
-template <typename T>
-vector<T>::vector() : _array(nullptr), _size(0), _capacity(0) {}
+template <typename T, typename G>
+vector<T, G>::vector() noexcept : _array(nullptr), _size(0), _capacity(0) {}
 
 /**
  * @brief Creates a vector of the given size.
  *
  * @details
  * This constructor creates a vector of length n
- * and initializes it with 0.
+ * and value-initializes its elements (0 for arithmetic types).
  *
  * @param[in] n Vector size.
  */
-template <typename T>
-vector<T>::vector(size_type n)
-    : _array(new value_type[n]), _size(n), _capacity(n) {
-  std::fill_n(_array, n, value_type());
+template <typename T, typename G>
+vector<T, G>::vector(size_type n) : vector() {
+  adopt(allocate(n), n);
+  std::uninitialized_value_construct_n(_array, n);
+  _size = n;
 }
 
 /**
@@ -51,24 +52,33 @@ vector<T>::vector(size_type n)
  *
  * @param[in] items The initializer list of values to insert into the vector.
  */
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items)
-    : vector(items.size()) {
-  std::copy(items.begin(), items.end(), _array);
+template <typename T, typename G>
+vector<T, G>::vector(std::initializer_list<value_type> const &items)
+    : vector() {
+  adopt(allocate(items.size()), items.size());
+  std::uninitialized_copy(items.begin(), items.end(), _array);
+  _size = items.size();
 }
 
 /**
  * @brief Copy constructor for the vector.
  *
  * @details
- * This constructor creates a new vector of size 'v' and copies the values
- * ​​in 'v' into it.
+ * This constructor creates a new vector with room for the elements of 'v'
+ * and copy-constructs them into it, with a single memcpy() for trivially
+ * copyable types. The growth policy is default constructed, not copied.
  *
  * @param[in] v The vector to copy from.
  */
-template <typename T>
-vector<T>::vector(const vector &v) : vector(v._capacity) {
-  for (size_type i = 0; i < v._capacity; ++i) _array[i] = v._array[i];
+template <typename T, typename G>
+vector<T, G>::vector(const vector &v) : vector() {
+  adopt(allocate(v._size), v._size);
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (v._size) std::memcpy(_array, v._array, v._size * sizeof(T));
+  } else {
+    std::uninitialized_copy(v._array, v._array + v._size, _array);
+  }
+  _size = v._size;
 }
 
 /**
@@ -81,12 +91,9 @@ vector<T>::vector(const vector &v) : vector(v._capacity) {
  *
  * @param[in] v The vector to move from.
  */
-template <typename T>
-vector<T>::vector(vector &&v) {
+template <typename T, typename G>
+vector<T, G>::vector(vector &&v) noexcept : vector() {
   this->swap(v);
-  v._array = nullptr;
-  v._size = 0;
-  v._capacity = 0;
 }
 
 /**
@@ -98,17 +105,13 @@ vector<T>::vector(vector &&v) {
  * and then cleans up the another vector
  *
  * @param[in] v The vector to move from.
- * @return vector<T>& - reference to the assigned vector.
+ * @return vector<T, G>& - reference to the assigned vector.
  */
-template <typename T>
-vector<T> &vector<T>::operator=(vector &&v) {
+template <typename T, typename G>
+vector<T, G> &vector<T, G>::operator=(vector &&v) noexcept {
   if (this != &v) {
     this->swap(v);
-
-    delete[] v._array;
-    v._array = nullptr;
-    v._size = 0;
-    v._capacity = 0;
+    v.release();
   }
   return *this;
 }
@@ -117,13 +120,11 @@ vector<T> &vector<T>::operator=(vector &&v) {
  * @brief Destructor.
  *
  * @details
- * Destroys the array and frees allocated memory.
+ * Destroys the elements and frees allocated memory.
  */
-template <typename T>
-vector<T>::~vector() {
-  delete[] _array;
-  _size = 0;
-  _capacity = 0;
+template <typename T, typename G>
+vector<T, G>::~vector() {
+  release();
 }
 
 // Vector Element access
@@ -138,8 +139,8 @@ vector<T>::~vector() {
  * @param[in] pos Position of the searched element.
  * @return reference - to element of the vector.
  */
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename G>
+typename vector<T, G>::reference vector<T, G>::at(size_type pos) {
   if (pos >= this->_size)
     throw std::out_of_range("'pos' must be less than or equal to size");
   return (*this)[pos];
@@ -155,8 +156,8 @@ typename vector<T>::reference vector<T>::at(size_type pos) {
  * @param[in] pos Position of the searched element.
  * @return reference - to element of the vector.
  */
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename G>
+typename vector<T, G>::reference vector<T, G>::operator[](size_type pos) {
   if (pos >= this->_size)
     throw std::out_of_range("index must be less than or equal to size");
   return *(this->_array + pos);
@@ -172,8 +173,8 @@ typename vector<T>::reference vector<T>::operator[](size_type pos) {
  * @param[in] pos Position of the searched element.
  * @return const_reference - to element of the vector.
  */
-template <typename T>
-typename vector<T>::const_reference vector<T>::operator[](
+template <typename T, typename G>
+typename vector<T, G>::const_reference vector<T, G>::operator[](
     const size_type pos) const {
   if (pos >= this->_size)
     throw std::out_of_range("index must be less than or equal to size");
@@ -189,8 +190,8 @@ typename vector<T>::const_reference vector<T>::operator[](
  *
  * @return const_reference - to the first element of the vector.
  */
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() const {
+template <typename T, typename G>
+typename vector<T, G>::const_reference vector<T, G>::front() const {
   if (_size == 0) throw std::out_of_range("Verctor empty");
   return _array[0];
 }
@@ -204,8 +205,8 @@ typename vector<T>::const_reference vector<T>::front() const {
  *
  * @return const_reference - to the last element of the vector.
  */
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() const {
+template <typename T, typename G>
+typename vector<T, G>::const_reference vector<T, G>::back() const {
   if (_size == 0) throw std::out_of_range("Verctor empty");
   return _array[_size - 1];
 }
@@ -218,8 +219,18 @@ typename vector<T>::const_reference vector<T>::back() const {
  *
  * @return iterator - pointer to the vector.
  */
-template <typename T>
-typename vector<T>::value_type *vector<T>::data() noexcept {
+template <typename T, typename G>
+typename vector<T, G>::value_type *vector<T, G>::data() noexcept {
+  return _array;
+}
+
+/**
+ * @brief Direct read-only access to the underlying vector.
+ *
+ * @return const value_type* - pointer to the vector.
+ */
+template <typename T, typename G>
+const typename vector<T, G>::value_type *vector<T, G>::data() const noexcept {
   return _array;
 }
 
@@ -233,8 +244,8 @@ typename vector<T>::value_type *vector<T>::data() noexcept {
  *
  * @return iterator - an iterator to the beginning of the vector.
  */
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() noexcept {
+template <typename T, typename G>
+typename vector<T, G>::iterator vector<T, G>::begin() noexcept {
   return iterator(_array);
 }
 
@@ -247,8 +258,8 @@ typename vector<T>::iterator vector<T>::begin() noexcept {
  *
  * @return iterator - an iterator to the end of the vector.
  */
-template <typename T>
-typename vector<T>::iterator vector<T>::end() noexcept {
+template <typename T, typename G>
+typename vector<T, G>::iterator vector<T, G>::end() noexcept {
   return iterator(_array + _size);
 }
 
@@ -260,8 +271,8 @@ typename vector<T>::iterator vector<T>::end() noexcept {
  *
  * @return const_iterator - a const iterator to the beginning of the vector.
  */
-template <typename T>
-typename vector<T>::const_iterator vector<T>::cbegin() const noexcept {
+template <typename T, typename G>
+typename vector<T, G>::const_iterator vector<T, G>::cbegin() const noexcept {
   return const_iterator(_array);
 }
 
@@ -274,8 +285,8 @@ typename vector<T>::const_iterator vector<T>::cbegin() const noexcept {
  *
  * @return const_iterator - a const iterator to the end of the vector.
  */
-template <typename T>
-typename vector<T>::const_iterator vector<T>::cend() const noexcept {
+template <typename T, typename G>
+typename vector<T, G>::const_iterator vector<T, G>::cend() const noexcept {
   return const_iterator(_array + _size);
 }
 
@@ -290,8 +301,8 @@ typename vector<T>::const_iterator vector<T>::cend() const noexcept {
  *
  * @return bool - true if the vector is empty, false otherwise.
  */
-template <typename T>
-bool vector<T>::empty() const noexcept {
+template <typename T, typename G>
+bool vector<T, G>::empty() const noexcept {
   return _size == 0;
 }
 
@@ -303,8 +314,8 @@ bool vector<T>::empty() const noexcept {
  *
  * @return size_type - the number of elements in the vector.
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::size() const noexcept {
+template <typename T, typename G>
+typename vector<T, G>::size_type vector<T, G>::size() const noexcept {
   return _size;
 }
 
@@ -317,8 +328,8 @@ typename vector<T>::size_type vector<T>::size() const noexcept {
  *
  * @return size_type - the maximum number of elements.
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const noexcept {
+template <typename T, typename G>
+typename vector<T, G>::size_type vector<T, G>::max_size() const noexcept {
   return std::size_t(__PTRDIFF_MAX__) / sizeof(T);
 }
 
@@ -330,20 +341,15 @@ typename vector<T>::size_type vector<T>::max_size() const noexcept {
  * Increase the capacity of the vector (the total number of elements that the
  * vector can hold without requiring reallocation) to a value that's greater or
  * equal to 'size'. If 'size' is greater than the current capacity(), new
- * storage is allocated, otherwise the function does nothing.
+ * storage is allocated, otherwise the function does nothing. The new capacity
+ * is exactly 'size': the growth policy is not consulted.
  *
  * @param[in] size New vector size.
  *
  */
-template <typename T>
-void vector<T>::reserve(size_type size) {
-  if (this->_capacity < size) {
-    T *new_arr = new T[size];
-    for (size_type i = 0; i < this->_size; ++i) new_arr[i] = this->_array[i];
-    if (this->_array) delete[] this->_array;
-    this->_array = new_arr;
-    this->_capacity = size;
-  }
+template <typename T, typename G>
+void vector<T, G>::reserve(size_type size) {
+  if (this->_capacity < size) reallocate(size);
 }
 
 /**
@@ -353,8 +359,8 @@ void vector<T>::reserve(size_type size) {
  * @return Size_t capacity.
  *
  */
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() {
+template <typename T, typename G>
+typename vector<T, G>::size_type vector<T, G>::capacity() {
   return _capacity;
 }
 
@@ -365,15 +371,35 @@ typename vector<T>::size_type vector<T>::capacity() {
  * It is a non-binding request to reduce capacity() to size()
  *
  */
-template <typename T>
-void vector<T>::shrink_to_fit() {
-  if (_capacity != _size) {
-    T *new_arr = new T[_size];
-    for (size_type i = 0; i < _size; ++i) new_arr[i] = _array[i];
-    if (_array) delete[] _array;
-    _array = new_arr;
-    _capacity = _size;
-  }
+template <typename T, typename G>
+void vector<T, G>::shrink_to_fit() {
+  if (_capacity != _size) reallocate(_size);
+}
+
+// Vector Growth
+
+/**
+ * @brief Returns the growth policy.
+ *
+ * @details
+ * Gives access to the state of the policy, such as the counters of
+ * growth_counted.
+ *
+ * @return G& - the growth policy of the vector.
+ */
+template <typename T, typename G>
+G &vector<T, G>::growth() noexcept {
+  return *this;
+}
+
+/**
+ * @brief Returns the growth policy.
+ *
+ * @return const G& - the growth policy of the vector.
+ */
+template <typename T, typename G>
+const G &vector<T, G>::growth() const noexcept {
+  return *this;
 }
 
 // Vector Modifiers
@@ -383,12 +409,13 @@ void vector<T>::shrink_to_fit() {
  *
  * @details
  * Erases all elements from the container. After this call, size() returns zero.
+ * The capacity is kept.
  *
  */
-template <typename T>
-void vector<T>::clear() noexcept {
+template <typename T, typename G>
+void vector<T, G>::clear() noexcept {
+  std::destroy_n(_array, _size);
   _size = 0;
-  _capacity = 0;
 }
 
 /**
@@ -398,7 +425,9 @@ void vector<T>::clear() noexcept {
  * Inserts element into concrete pos and returns the iterator that points to the
  * new element.
  * If after the operation the new size() is greater than old capacity() a
- * reallocation takes place.
+ * reallocation takes place. Otherwise the elements after pos are shifted in
+ * place and iterators before pos stay valid: an insertion costs O(size() -
+ * pos) moves.
  *
  * @param[in] pos iterator before which the content will be inserted (pos may be
  * the end() iterator).
@@ -406,34 +435,121 @@ void vector<T>::clear() noexcept {
  *
  * @return Iterator pointing to the inserted value.
  */
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  iterator new_pos;
-  if (pos == end()) {
-    push_back(value);
-    new_pos = --end();
+template <typename T, typename G>
+typename vector<T, G>::iterator vector<T, G>::insert(iterator pos,
+                                                     const_reference value) {
+  return emplace(cbegin() + (pos - begin()), value);
+}
+
+/**
+ * @brief Inserts an element at the specified location by moving it.
+ *
+ * @details
+ * Works as insert(pos, const_reference), but the new element is
+ * move-constructed from value.
+ *
+ * @param[in] pos iterator before which the content will be inserted (pos may be
+ * the end() iterator).
+ * @param[in] value element value to move into the vector.
+ *
+ * @return Iterator pointing to the inserted value.
+ */
+template <typename T, typename G>
+typename vector<T, G>::iterator vector<T, G>::insert(iterator pos,
+                                                     value_type &&value) {
+  return emplace(cbegin() + (pos - begin()), std::move(value));
+}
+
+/**
+ * @brief Inserts the elements of a range at the specified location.
+ *
+ * @details
+ * The elements of [first, last) are inserted before pos in the same order.
+ * For forward iterators the size of the range is known in advance: the
+ * storage grows at most once and the tail after pos is shifted once, so the
+ * insertion costs O(size() - pos + count) instead of one shift per element
+ * (see insertBatch()). The elements are copied before anything is shifted,
+ * so the range may come from the vector itself. A single-pass range is first
+ * gathered into a temporary vector.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] pos iterator before which the content will be inserted (pos may be
+ * the end() iterator).
+ * @param[in] first The beginning of the range to insert.
+ * @param[in] last The end of the range to insert.
+ *
+ * @return Iterator pointing to the first inserted element, or pos if the range
+ * is empty.
+ */
+template <typename T, typename G>
+template <typename InputIt, typename>
+typename vector<T, G>::iterator vector<T, G>::insert(iterator pos,
+                                                     InputIt first,
+                                                     InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  size_type index = pos - begin();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    return insertBatch(index, count, [&](T *dest) {
+      std::uninitialized_copy(first, last, dest);
+    });
   } else {
-    if (_capacity == _size) _capacity = (_capacity) ? _capacity * 2 : 1;
-    T *new_arr = new T[_capacity];
-    int pos_in_new = 0;
-    for (size_type i = 0; i < _size; ++i) {
-      if (_array[i] == *pos) {
-        new_arr[pos_in_new] = value;
-        new_arr[++pos_in_new] = *pos;
-        pos_in_new++;
-      } else {
-        new_arr[pos_in_new] = _array[i];
-        pos_in_new++;
-      }
-    }
-    value_type index = pos - begin();
-    if (_array) delete[] _array;
-    _array = new_arr;
-    _size = _size + 1;
-    new_pos = begin() + index;
+    vector buffer;
+    for (; first != last; ++first) buffer.emplace_back(*first);
+    return insert(pos, std::make_move_iterator(buffer._array),
+                  std::make_move_iterator(buffer._array + buffer._size));
+  }
+}
+
+/**
+ * @brief Replaces the contents with the elements of a range.
+ *
+ * @details
+ * The old elements are destroyed and the elements of [first, last) are
+ * copied in. For forward iterators the storage is reallocated at most once,
+ * to exactly the size of the range, and only when the current capacity is
+ * too small. The range must not come from the vector itself.
+ *
+ * @tparam InputIt The type of the iterators.
+ * @param[in] first The beginning of the range to copy.
+ * @param[in] last The end of the range to copy.
+ */
+template <typename T, typename G>
+template <typename InputIt, typename>
+void vector<T, G>::assign(InputIt first, InputIt last) {
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  clear();
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+    size_type count = std::distance(first, last);
+    if (count > _capacity) adopt(allocate(count), count);
   }
-  return new_pos;
+  insert(begin(), first, last);
+}
+
+/**
+ * @brief Constructs an element in place at the specified location.
+ *
+ * @details
+ * With spare capacity the element is constructed at the end and rotated into
+ * place, so only the elements after pos move. Otherwise it is constructed in
+ * new storage around which the old elements are relocated (see insertBatch()).
+ * Either way args may refer to elements of the vector itself.
+ *
+ * @tparam Args The types of the arguments to forward to the constructor of the
+ * element.
+ * @param[in] pos iterator before which the element will be constructed (pos
+ * may be the cend() iterator).
+ * @param args The arguments to forward to the constructor of the element.
+ *
+ * @return Iterator pointing to the new element.
+ */
+template <typename T, typename G>
+template <typename... Args>
+typename vector<T, G>::iterator vector<T, G>::emplace(const_iterator pos,
+                                                      Args &&...args) {
+  return insertBatch(pos - cbegin(), 1, [&](T *dest) {
+    new (dest) T(std::forward<Args>(args)...);
+  });
 }
 
 /**
@@ -444,18 +560,107 @@ typename vector<T>::iterator vector<T>::insert(iterator pos,
  * The iterator pos must be valid and dereferenceable.
  * Thus the end() iterator (which is valid, but is not dereferenceable) cannot
  * be used as a value for pos.
+ * For trivially relocatable types the element is destroyed and the tail is
+ * shifted with a single memmove(); otherwise the tail is move-assigned one
+ * element at a time.
  *
  * @param[in] pos iterator to the element to remove.
  *
  */
-template <typename T>
-void vector<T>::erase(iterator pos) {
+template <typename T, typename G>
+void vector<T, G>::erase(iterator pos) {
   size_type index = pos - begin();
-  while (index < _size - 1) {
-    _array[index] = *++pos;
-    ++index;
+  if constexpr (is_trivially_relocatable_v<T>) {
+    std::destroy_at(_array + index);
+    std::memmove(static_cast<void *>(_array + index), _array + index + 1,
+                 (_size - index - 1) * sizeof(T));
+    --_size;
+  } else {
+    while (index < _size - 1) {
+      _array[index] = std::move(*++pos);
+      ++index;
+    }
+    std::destroy_at(_array + --_size);
+  }
+}
+
+/**
+ * @brief Erases the elements in the range [first, last).
+ *
+ * @details
+ * The tail after last is shifted once, whatever the size of the range: with
+ * a single memmove() for trivially relocatable types and by move-assigning
+ * each element once otherwise. References and iterators at or after first
+ * are invalidated.
+ *
+ * @param[in] first iterator to the first element to remove.
+ * @param[in] last iterator past the last element to remove.
+ *
+ * @return Iterator following the last removed element.
+ */
+template <typename T, typename G>
+typename vector<T, G>::iterator vector<T, G>::erase(iterator first,
+                                                    iterator last) {
+  size_type index = first - begin();
+  size_type count = last - first;
+  if (count > 0) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+      std::destroy_n(_array + index, count);
+      std::memmove(static_cast<void *>(_array + index), _array + index + count,
+                   (_size - index - count) * sizeof(T));
+    } else {
+      std::move(_array + index + count, _array + _size, _array + index);
+      std::destroy_n(_array + _size - count, count);
+    }
+    _size -= count;
   }
-  --_size;
+  return begin() + index;
+}
+
+/**
+ * @brief Erases all elements satisfying a predicate.
+ *
+ * @details
+ * The vector is compacted in a single pass, every kept element moving at
+ * most once, so the call costs O(size()) whatever the number of removed
+ * elements. The relative order of the kept elements is preserved.
+ *
+ * @tparam Pred The type of the predicate.
+ * @param[in] pred Returns true for the elements to remove.
+ *
+ * @return size_type - the number of removed elements.
+ */
+template <typename T, typename G>
+template <typename Pred>
+typename vector<T, G>::size_type vector<T, G>::erase_if(Pred pred) {
+  size_type old_size = _size;
+  if constexpr (is_trivially_relocatable_v<T>) {
+    size_type kept = 0;
+    size_type i = 0;
+    try {
+      for (; i < _size; ++i) {
+        if (pred(_array[i])) {
+          std::destroy_at(_array + i);
+        } else {
+          if (kept != i)
+            std::memcpy(static_cast<void *>(_array + kept), _array + i,
+                        sizeof(T));
+          ++kept;
+        }
+      }
+    } catch (...) {
+      std::memmove(static_cast<void *>(_array + kept), _array + i,
+                   (_size - i) * sizeof(T));
+      _size = kept + (_size - i);
+      throw;
+    }
+    _size = kept;
+  } else {
+    T *kept = std::remove_if(_array, _array + _size, pred);
+    std::destroy(kept, _array + _size);
+    _size = kept - _array;
+  }
+  return old_size - _size;
 }
 
 /**
@@ -463,24 +668,72 @@ void vector<T>::erase(iterator pos) {
  *
  * @details
  * Adds a new element at the end of the vector container, after its current last
- * element. The content of val is copied (or moved) to the new element.
+ * element. The content of val is copied to the new element.
  * If after the operation the new size() is greater than old capacity() a
- * reallocation takes place.
+ * reallocation takes place (see emplace_back()).
  *
- * @param[in] value value to be copied (or moved) to the new element.
+ * @param[in] value value to be copied to the new element.
  *
  */
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-  if (_capacity == _size) {
-    _capacity = (_capacity) ? _capacity * 2 : 1;
-    T *new_arr = new T[_capacity];
-    for (size_type i = 0; i < _size; ++i) new_arr[i] = _array[i];
-    if (_array) delete[] _array;
-    _array = new_arr;
-  }
-  _array[_size] = value;
-  ++_size;
+template <typename T, typename G>
+void vector<T, G>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+/**
+ * @brief Adds an element to the end by moving it.
+ *
+ * @details
+ * Works as push_back(const_reference), but the new element is
+ * move-constructed from value.
+ *
+ * @param[in] value value to be moved to the new element.
+ *
+ */
+template <typename T, typename G>
+void vector<T, G>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+/**
+ * @brief Appends the elements of a range to the end.
+ *
+ * @details
+ * Works as insert(end(), first, last) over the range: the storage grows at
+ * most once for a range of forward iterators.
+ *
+ * @tparam Range The type of the range, anything std::begin() and std::end()
+ * accept.
+ * @param[in] range The range to append.
+ */
+template <typename T, typename G>
+template <typename Range>
+void vector<T, G>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+/**
+ * @brief Constructs an element in place at the end.
+ *
+ * @details
+ * If after the operation the new size() is greater than old capacity() a
+ * reallocation takes place. The new element is then constructed in the new
+ * storage before the old elements are relocated, so args may refer to an
+ * element of the vector itself. The old elements are moved when their move
+ * constructor cannot throw, and copied otherwise (see raw_storage::relocate()).
+ *
+ * @tparam Args The types of the arguments to forward to the constructor of the
+ * element.
+ * @param args The arguments to forward to the constructor of the element.
+ *
+ * @return reference - to the new element.
+ */
+template <typename T, typename G>
+template <typename... Args>
+typename vector<T, G>::reference vector<T, G>::emplace_back(Args &&...args) {
+  return *insertBatch(_size, 1, [&](T *dest) {
+    new (dest) T(std::forward<Args>(args)...);
+  });
 }
 
 /**
@@ -491,9 +744,9 @@ void vector<T>::push_back(const_reference value) {
  * Calling pop_back on an empty container results in undefined behavior.
  *
  */
-template <typename T>
-void vector<T>::pop_back() {
-  if (_size > 0) _size -= 1;
+template <typename T, typename G>
+void vector<T, G>::pop_back() {
+  if (_size > 0) std::destroy_at(_array + --_size);
 }
 
 /**
@@ -505,8 +758,9 @@ void vector<T>::pop_back() {
  * in this.
  *
  */
-template <typename T>
-void vector<T>::swap(vector &other) {
+template <typename T, typename G>
+void vector<T, G>::swap(vector &other) noexcept {
+  std::swap(growth(), other.growth());
   std::swap(_array, other._array);
   std::swap(_size, other._size);
   std::swap(_capacity, other._capacity);
@@ -521,6 +775,8 @@ void vector<T>::swap(vector &other) {
  * efficient than inserting an already constructed element, as it avoids
  * unnecessary copying or moving. The method ensures that the vector properties
  * are maintained after the insertion.
+ * All the elements are constructed first and the tail is shifted once for
+ * the whole batch, reallocating at most once (see insertBatch()).
  *
  * @tparam Args The types of the arguments to forward to the constructor of the
  * element.
@@ -528,15 +784,17 @@ void vector<T>::swap(vector &other) {
  * the end() iterator).
  * @param args The arguments to forward to the constructor of the element.
  *
- * @return An iterator pointing to the first element in the argument vector.
+ * @return An iterator pointing past the last inserted element.
  */
-template <typename T>
+template <typename T, typename G>
 template <typename... Args>
-typename s21::vector<T>::iterator s21::vector<T>::insert_many(
+typename s21::vector<T, G>::iterator s21::vector<T, G>::insert_many(
     const_iterator pos, Args &&...args) {
-  iterator position = pos.it_const_cast();
-  ([&] { position = this->insert(position, args) + 1; }(), ...);
-  return position;
+  size_type index = pos - cbegin();
+  return insertBatch(index, sizeof...(Args), [&](T *dest) {
+           storage::constructEach(dest, std::forward<Args>(args)...);
+         }) +
+         sizeof...(Args);
 }
 
 /**
@@ -548,16 +806,265 @@ typename s21::vector<T>::iterator s21::vector<T>::insert_many(
  * efficient than inserting an already constructed element, as it avoids
  * unnecessary copying or moving. The method ensures that the vector properties
  * are maintained after the insertion.
+ * The storage is grown at most once for the whole batch.
  *
  * @tparam Args The types of the arguments to forward to the constructor of the
  * element.
  * @param args The arguments to forward to the constructor of the element.
  */
-template <typename T>
+template <typename T, typename G>
 template <typename... Args>
-void s21::vector<T>::insert_many_back(Args &&...args) {
-  // реализация через Lambda expressions
-  ([&] { this->push_back(args); }(), ...);
+void s21::vector<T, G>::insert_many_back(Args &&...args) {
+  insertBatch(_size, sizeof...(Args), [&](T *dest) {
+    storage::constructEach(dest, std::forward<Args>(args)...);
+  });
+}
+
+// Vector Storage
+
+/**
+ * @brief Allocates raw storage for elements.
+ *
+ * @details
+ * No element is constructed in the storage. The storage comes from the
+ * growth policy (see growth_heap).
+ *
+ * @param[in] count Number of elements the storage must hold.
+ * @return T* - the storage, or nullptr if count is 0.
+ * @throws std::length_error if count exceeds max_size().
+ */
+template <typename T, typename G>
+T *vector<T, G>::allocate(size_type count) {
+  if (count > std::size_t(__PTRDIFF_MAX__) / sizeof(T))
+    throw std::length_error("vector::allocate() - size exceeds max_size()");
+  if (count == 0) return nullptr;
+  return static_cast<T *>(G::allocate(count * sizeof(T), alignof(T)));
+}
+
+/**
+ * @brief Frees storage from allocate().
+ *
+ * @details
+ * The elements must have been destroyed.
+ *
+ * @param[in] array The storage to free, or nullptr.
+ * @param[in] count The number of elements it was allocated for.
+ */
+template <typename T, typename G>
+void vector<T, G>::deallocate(T *array, size_type count) noexcept {
+  if (array) G::deallocate(array, count * sizeof(T), alignof(T));
+}
+
+/**
+ * @brief Replaces the storage of the vector.
+ *
+ * @details
+ * Takes array as the storage and frees the current one. The size is kept:
+ * the elements must have been relocated to array (see
+ * raw_storage::relocate()), so the current ones are destroyed only if they
+ * were not relocated bitwise.
+ *
+ * @param[in] array The new storage.
+ * @param[in] capacity The capacity of the new storage.
+ */
+template <typename T, typename G>
+void vector<T, G>::adopt(T *array, size_type capacity) noexcept {
+  if constexpr (!is_trivially_relocatable_v<T>) std::destroy_n(_array, _size);
+  deallocate(_array, _capacity);
+  _array = array;
+  _capacity = capacity;
+}
+
+/**
+ * @brief Destroys the elements and frees the storage.
+ *
+ * @details
+ * The vector is left empty with no storage.
+ */
+template <typename T, typename G>
+void vector<T, G>::release() noexcept {
+  std::destroy_n(_array, _size);
+  deallocate(_array, _capacity);
+  _array = nullptr;
+  _size = 0;
+  _capacity = 0;
+}
+
+/**
+ * @brief Relocates the elements to new storage of the given capacity.
+ *
+ * @details
+ * Trivially relocatable elements stay where they are if the growth policy
+ * can resize the storage itself (see growth_mapped); otherwise they are
+ * relocated to new storage. The reallocation is reported to the growth
+ * policy. If relocating throws the vector is unchanged (see
+ * raw_storage::relocate()).
+ *
+ * @param[in] capacity Capacity of the new storage, at least size().
+ */
+template <typename T, typename G>
+void vector<T, G>::reallocate(size_type capacity) {
+  if constexpr (G::kREMAPS && is_trivially_relocatable_v<T>) {
+    if (_array && capacity) {
+      void *array = G::remap(_array, _capacity * sizeof(T),
+                             capacity * sizeof(T), alignof(T));
+      if (array) {
+        _array = static_cast<T *>(array);
+        _capacity = capacity;
+        G::reallocated(0);
+        return;
+      }
+    }
+  }
+  T *new_arr = allocate(capacity);
+  try {
+    storage::relocate(_array, _array + _size, new_arr);
+  } catch (...) {
+    deallocate(new_arr, capacity);
+    throw;
+  }
+  if (_array) G::reallocated(_size * sizeof(T));
+  adopt(new_arr, capacity);
+}
+
+/**
+ * @brief Computes the capacity of the storage to grow into.
+ *
+ * @details
+ * The growth policy chooses the capacity (see growth_factor). With the
+ * default policy the capacity doubles, or grows to exactly what is needed
+ * when doubling is not enough, so a sequence of insertions reallocates
+ * O(log n) times.
+ *
+ * @param[in] count Number of elements about to be added.
+ * @return size_type - capacity for at least size() + count elements.
+ * @throws std::length_error if size() + count exceeds max_size().
+ */
+template <typename T, typename G>
+typename vector<T, G>::size_type vector<T, G>::grownCapacity(
+    size_type count) const {
+  if (count > max_size() - _size)
+    throw std::length_error(
+        "vector::grownCapacity() - size exceeds max_size()");
+  return std::min(max_size(), G::grow(_capacity, _size + count, sizeof(T)));
+}
+
+/**
+ * @brief Inserts count elements built by fill at the specified index.
+ *
+ * @details
+ * Every insertion goes through here. fill(dest) must construct count elements
+ * at dest, and destroy the ones it built if one of them throws. The old
+ * elements stay where they are until fill returns, so the arguments of fill
+ * may refer to them.
+ *
+ * Appending with enough spare capacity only calls fill. Inserting before the
+ * end with enough spare capacity shifts the tail after index once, whatever
+ * count is (see raw_storage::shiftIn()); types that can be neither relocated
+ * nor move-assigned are relocated to new storage of the same capacity
+ * instead.
+ * Without enough spare capacity the storage grows, in place if the growth
+ * policy can resize it (see insertRemapping()) and by relocating the elements
+ * otherwise (see insertRelocating()).
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] index Position of the first new element, at most size().
+ * @param[in] count Number of elements to insert.
+ * @param[in] fill Callable constructing the elements.
+ * @return iterator - to the first new element.
+ */
+template <typename T, typename G>
+template <typename Fill>
+typename vector<T, G>::iterator vector<T, G>::insertBatch(size_type index,
+                                                          size_type count,
+                                                          Fill fill) {
+  bool fits = _capacity - _size >= count;
+  if (fits && index == _size) {
+    fill(_array + _size);
+    _size += count;
+  } else if (fits && storage::kSHIFTS) {
+    storage::shiftIn(_array, _size, index, count, fill);
+  } else if (fits) {
+    insertRelocating(index, count, _capacity, fill);
+  } else if (!insertRemapping(index, count, fill)) {
+    insertRelocating(index, count, grownCapacity(count), fill);
+  }
+  return begin() + index;
+}
+
+/**
+ * @brief Inserts count elements built by fill after resizing the storage.
+ *
+ * @details
+ * Applies to trivially relocatable elements when the growth policy can
+ * resize the storage without copying it (see growth_mapped), and to batches
+ * small enough to be built on the stack first: the arguments of fill may
+ * refer to elements that the resizing moves. The storage is then grown (see
+ * reallocate()), the tail after index is shifted with a single memmove() and
+ * the new elements are copied in. If anything throws the vector is unchanged.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] index Position of the first new element, at most size().
+ * @param[in] count Number of elements to insert, more than the spare
+ * capacity.
+ * @param[in] fill Callable constructing the elements.
+ * @return bool - true if the elements were inserted, false if the insertion
+ * does not apply.
+ */
+template <typename T, typename G>
+template <typename Fill>
+bool vector<T, G>::insertRemapping(size_type index, size_type count,
+                                   Fill &fill) {
+  if constexpr (G::kREMAPS && is_trivially_relocatable_v<T>) {
+    size_type bytes = count * sizeof(T);
+    if (bytes > storage::kSTASH) return false;
+    alignas(T) unsigned char stack[storage::kSTASH];
+    T *stash = reinterpret_cast<T *>(stack);
+    fill(stash);
+    try {
+      reallocate(grownCapacity(count));
+    } catch (...) {
+      std::destroy_n(stash, count);
+      throw;
+    }
+    std::memmove(static_cast<void *>(_array + index + count), _array + index,
+                 (_size - index) * sizeof(T));
+    std::memcpy(static_cast<void *>(_array + index), stack, bytes);
+    _size += count;
+    return true;
+  } else {
+    return (void)index, (void)count, (void)fill, false;
+  }
+}
+
+/**
+ * @brief Inserts count elements built by fill into new storage.
+ *
+ * @details
+ * The elements are built in the new storage first, then the old elements are
+ * relocated before and after them (see raw_storage::buildAround()). If
+ * anything throws the vector is unchanged.
+ *
+ * @tparam Fill The type of the callable constructing the elements.
+ * @param[in] index Position of the first new element, at most size().
+ * @param[in] count Number of elements to insert.
+ * @param[in] capacity Capacity of the new storage, at least size() + count.
+ * @param[in] fill Callable constructing the elements.
+ */
+template <typename T, typename G>
+template <typename Fill>
+void vector<T, G>::insertRelocating(size_type index, size_type count,
+                                    size_type capacity, Fill &fill) {
+  T *new_arr = allocate(capacity);
+  try {
+    storage::buildAround(_array, _size, index, count, new_arr, fill);
+  } catch (...) {
+    deallocate(new_arr, capacity);
+    throw;
+  }
+  if (_array) G::reallocated(_size * sizeof(T));
+  adopt(new_arr, capacity);
+  _size += count;
 }
 
 // VectorIterator
@@ -566,16 +1073,16 @@ void s21::vector<T>::insert_many_back(Args &&...args) {
  * @brief Creates an entity vector iterator.
  *
  */
-template <typename T>
-inline vector<T>::VectorIterator::VectorIterator() : m_ptr(nullptr) {}
+template <typename T, typename G>
+inline vector<T, G>::VectorIterator::VectorIterator() : m_ptr(nullptr) {}
 
 /**
  * @brief Constructs a vector iterator.
  *
  * @param[in] other The other iterator to value.
  */
-template <typename T>
-inline vector<T>::VectorIterator::VectorIterator(pointer other)
+template <typename T, typename G>
+inline vector<T, G>::VectorIterator::VectorIterator(pointer other)
     : m_ptr(other) {}
 
 /**
@@ -583,9 +1090,9 @@ inline vector<T>::VectorIterator::VectorIterator(pointer other)
  *
  * @return const_iterator
  */
-template <typename T>
-inline typename vector<T>::iterator vector<T>::VectorIterator::it_const_cast()
-    const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator
+vector<T, G>::VectorIterator::it_const_cast() const noexcept {
   return *this;
 }
 
@@ -597,9 +1104,9 @@ inline typename vector<T>::iterator vector<T>::VectorIterator::it_const_cast()
  *
  * @return reference to value
  */
-template <typename T>
-inline typename vector<T>::VectorIterator::reference
-vector<T>::VectorIterator::operator*() const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::VectorIterator::reference
+vector<T, G>::VectorIterator::operator*() const noexcept {
   return *m_ptr;
 }
 
@@ -611,9 +1118,9 @@ vector<T>::VectorIterator::operator*() const noexcept {
  *
  * @return pointer to value
  */
-template <typename T>
-inline typename vector<T>::VectorIterator::pointer
-vector<T>::VectorIterator::operator->() const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::VectorIterator::pointer
+vector<T, G>::VectorIterator::operator->() const noexcept {
   return m_ptr;
 }
 
@@ -622,9 +1129,9 @@ vector<T>::VectorIterator::operator->() const noexcept {
  *
  * @return iterator& - reference to the incremented iterator.
  */
-template <typename T>
-inline typename vector<T>::iterator &
-vector<T>::VectorIterator::operator++() noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator &
+vector<T, G>::VectorIterator::operator++() noexcept {
   ++m_ptr;
   return *this;
 }
@@ -635,8 +1142,8 @@ vector<T>::VectorIterator::operator++() noexcept {
  * @return An `iterator` representing the original position of the iterator
  * before the increment.
  */
-template <typename T>
-inline typename vector<T>::iterator vector<T>::VectorIterator::operator++(
+template <typename T, typename G>
+inline typename vector<T, G>::iterator vector<T, G>::VectorIterator::operator++(
     int) noexcept {
   return iterator(m_ptr++);
 }
@@ -646,9 +1153,9 @@ inline typename vector<T>::iterator vector<T>::VectorIterator::operator++(
  *
  * @return iterator& - reference to the decremented iterator.
  */
-template <typename T>
-inline typename vector<T>::iterator &
-vector<T>::VectorIterator::operator--() noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator &
+vector<T, G>::VectorIterator::operator--() noexcept {
   --m_ptr;
   return *this;
 }
@@ -659,8 +1166,8 @@ vector<T>::VectorIterator::operator--() noexcept {
  * @return An `iterator` representing the original position of the iterator
  * before the decrement.
  */
-template <typename T>
-inline typename vector<T>::iterator vector<T>::VectorIterator::operator--(
+template <typename T, typename G>
+inline typename vector<T, G>::iterator vector<T, G>::VectorIterator::operator--(
     int) noexcept {
   return iterator(m_ptr--);
 }
@@ -670,9 +1177,9 @@ inline typename vector<T>::iterator vector<T>::VectorIterator::operator--(
  *
  * @param[in] n The number of positions to advance the iterator.
  */
-template <typename T>
-inline typename vector<T>::iterator &vector<T>::VectorIterator::operator+=(
-    value_type n) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator &
+vector<T, G>::VectorIterator::operator+=(difference_type n) noexcept {
   m_ptr += n;
   return *this;
 }
@@ -683,9 +1190,9 @@ inline typename vector<T>::iterator &vector<T>::VectorIterator::operator+=(
  * @param[in] n The number of positions to shift.
  * @return iterator - before the shift.
  */
-template <typename T>
-inline typename vector<T>::iterator vector<T>::VectorIterator::operator+(
-    value_type n) const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator vector<T, G>::VectorIterator::operator+(
+    difference_type n) const noexcept {
   return iterator(m_ptr + n);
 }
 
@@ -694,9 +1201,9 @@ inline typename vector<T>::iterator vector<T>::VectorIterator::operator+(
  *
  * @param[in] n The number of positions to move the iterator backward.
  */
-template <typename T>
-inline typename vector<T>::iterator &vector<T>::VectorIterator::operator-=(
-    value_type n) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator &
+vector<T, G>::VectorIterator::operator-=(difference_type n) noexcept {
   m_ptr -= n;
   return *this;
 }
@@ -707,9 +1214,9 @@ inline typename vector<T>::iterator &vector<T>::VectorIterator::operator-=(
  * @param[in] n The number of positions to shift.
  * @return iterator - before the shift.
  */
-template <typename T>
-inline typename vector<T>::iterator vector<T>::VectorIterator::operator-(
-    value_type n) const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator vector<T, G>::VectorIterator::operator-(
+    difference_type n) const noexcept {
   return iterator(m_ptr - n);
 }
 
@@ -719,9 +1226,9 @@ inline typename vector<T>::iterator vector<T>::VectorIterator::operator-(
  * @param[in] other Subtractive iterator.
  * @return the number of positions between this and other iterators
  */
-template <typename T>
-inline typename vector<T>::difference_type vector<T>::VectorIterator::operator-(
-    const iterator &other) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::difference_type
+vector<T, G>::VectorIterator::operator-(const iterator &other) noexcept {
   return m_ptr - other.m_ptr;
 }
 
@@ -735,8 +1242,8 @@ inline typename vector<T>::difference_type vector<T>::VectorIterator::operator-(
  * @param[in] other Comparable iterator.
  * @return bool - true if this iterator less than other, false otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorIterator::operator<(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorIterator::operator<(
     const iterator &other) noexcept {
   return other.m_ptr - this->m_ptr > 0;
 }
@@ -752,8 +1259,8 @@ inline bool vector<T>::VectorIterator::operator<(
  * @return bool - true if this iterator is greater than the other, false
  * otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorIterator::operator>(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorIterator::operator>(
     const iterator &other) noexcept {
   return other.m_ptr < this->m_ptr;
 }
@@ -769,8 +1276,8 @@ inline bool vector<T>::VectorIterator::operator>(
  * @return bool - true if this iterator less or equals than other, false
  * otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorIterator::operator<=(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorIterator::operator<=(
     const iterator &other) noexcept {
   return !(this->m_ptr > other.m_ptr);
 }
@@ -786,8 +1293,8 @@ inline bool vector<T>::VectorIterator::operator<=(
  * @return bool - true if this iterator is greater or equals than the other,
  * false otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorIterator::operator>=(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorIterator::operator>=(
     const iterator &other) noexcept {
   return !(this->m_ptr < other.m_ptr);
 }
@@ -798,16 +1305,18 @@ inline bool vector<T>::VectorIterator::operator>=(
  * @brief Creates an entity vector const iterator.
  *
  */
-template <typename T>
-inline vector<T>::VectorConstIterator::VectorConstIterator() : m_ptr(nullptr) {}
+template <typename T, typename G>
+inline vector<T, G>::VectorConstIterator::VectorConstIterator()
+    : m_ptr(nullptr) {}
 
 /**
  * @brief Constructs a const vector iterator.
  *
  * @param[in] other The other const iterator to value.
  */
-template <typename T>
-inline vector<T>::VectorConstIterator::VectorConstIterator(const_pointer other)
+template <typename T, typename G>
+inline vector<T, G>::VectorConstIterator::VectorConstIterator(
+    const_pointer other)
     : m_ptr(other) {}
 
 /**
@@ -815,9 +1324,9 @@ inline vector<T>::VectorConstIterator::VectorConstIterator(const_pointer other)
  *
  * @return iterator
  */
-template <typename T>
-inline typename vector<T>::iterator
-vector<T>::VectorConstIterator::it_const_cast() const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::iterator
+vector<T, G>::VectorConstIterator::it_const_cast() const noexcept {
   return iterator(const_cast<T *>(m_ptr));
 }
 
@@ -829,9 +1338,9 @@ vector<T>::VectorConstIterator::it_const_cast() const noexcept {
  *
  * @return const reference to value
  */
-template <typename T>
-inline typename vector<T>::VectorConstIterator::const_reference
-vector<T>::VectorConstIterator::operator*() const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::VectorConstIterator::const_reference
+vector<T, G>::VectorConstIterator::operator*() const noexcept {
   return *m_ptr;
 }
 
@@ -843,9 +1352,9 @@ vector<T>::VectorConstIterator::operator*() const noexcept {
  *
  * @return const pointer to value
  */
-template <typename T>
-inline typename vector<T>::VectorConstIterator::pointer
-vector<T>::VectorConstIterator::operator->() const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::VectorConstIterator::pointer
+vector<T, G>::VectorConstIterator::operator->() const noexcept {
   return m_ptr;
 }
 
@@ -854,9 +1363,9 @@ vector<T>::VectorConstIterator::operator->() const noexcept {
  *
  * @return iterator& - reference to the incremented iterator.
  */
-template <typename T>
-inline typename vector<T>::const_iterator &
-vector<T>::VectorConstIterator::operator++() noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator &
+vector<T, G>::VectorConstIterator::operator++() noexcept {
   ++m_ptr;
   return *this;
 }
@@ -867,9 +1376,9 @@ vector<T>::VectorConstIterator::operator++() noexcept {
  * @return An `iterator` representing the original position of the iterator
  * before the increment.
  */
-template <typename T>
-inline typename vector<T>::const_iterator
-vector<T>::VectorConstIterator::operator++(int) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator
+vector<T, G>::VectorConstIterator::operator++(int) noexcept {
   return const_iterator(m_ptr++);
 }
 
@@ -878,9 +1387,9 @@ vector<T>::VectorConstIterator::operator++(int) noexcept {
  *
  * @return iterator& - reference to the decremented iterator.
  */
-template <typename T>
-inline typename vector<T>::const_iterator &
-vector<T>::VectorConstIterator::operator--() noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator &
+vector<T, G>::VectorConstIterator::operator--() noexcept {
   --m_ptr;
   return *this;
 }
@@ -891,9 +1400,9 @@ vector<T>::VectorConstIterator::operator--() noexcept {
  * @return An `iterator` representing the original position of the iterator
  * before the decrement.
  */
-template <typename T>
-inline typename vector<T>::const_iterator
-vector<T>::VectorConstIterator::operator--(int) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator
+vector<T, G>::VectorConstIterator::operator--(int) noexcept {
   return const_iterator(m_ptr--);
 }
 
@@ -902,9 +1411,9 @@ vector<T>::VectorConstIterator::operator--(int) noexcept {
  *
  * @param[in] n The number of positions to advance the iterator.
  */
-template <typename T>
-inline typename vector<T>::const_iterator &
-vector<T>::VectorConstIterator::operator+=(value_type n) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator &
+vector<T, G>::VectorConstIterator::operator+=(difference_type n) noexcept {
   m_ptr += n;
   return *this;
 }
@@ -915,9 +1424,9 @@ vector<T>::VectorConstIterator::operator+=(value_type n) noexcept {
  * @param[in] n The number of positions to shift.
  * @return iterator - before the shift.
  */
-template <typename T>
-inline typename vector<T>::const_iterator
-vector<T>::VectorConstIterator::operator+(value_type n) const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator
+vector<T, G>::VectorConstIterator::operator+(difference_type n) const noexcept {
   return const_iterator(m_ptr + n);
 }
 
@@ -926,9 +1435,9 @@ vector<T>::VectorConstIterator::operator+(value_type n) const noexcept {
  *
  * @param[in] n The number of positions to move the iterator backward.
  */
-template <typename T>
-inline typename vector<T>::const_iterator &
-vector<T>::VectorConstIterator::operator-=(value_type n) noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator &
+vector<T, G>::VectorConstIterator::operator-=(difference_type n) noexcept {
   m_ptr -= n;
   return *this;
 }
@@ -939,9 +1448,9 @@ vector<T>::VectorConstIterator::operator-=(value_type n) noexcept {
  * @param[in] n The number of positions to shift.
  * @return iterator - before the shift.
  */
-template <typename T>
-inline typename vector<T>::const_iterator
-vector<T>::VectorConstIterator::operator-(value_type n) const noexcept {
+template <typename T, typename G>
+inline typename vector<T, G>::const_iterator
+vector<T, G>::VectorConstIterator::operator-(difference_type n) const noexcept {
   return const_iterator(m_ptr - n);
 }
 
@@ -951,9 +1460,9 @@ vector<T>::VectorConstIterator::operator-(value_type n) const noexcept {
  * @param[in] other Subtractive const iterator.
  * @return the number of positions between this and other iterators
  */
-template <typename T>
-inline typename vector<T>::difference_type
-vector<T>::VectorConstIterator::operator-(
+template <typename T, typename G>
+inline typename vector<T, G>::difference_type
+vector<T, G>::VectorConstIterator::operator-(
     const const_iterator &other) noexcept {
   return m_ptr - other.m_ptr;
 }
@@ -968,8 +1477,8 @@ vector<T>::VectorConstIterator::operator-(
  * @param[in] other Comparable iterator.
  * @return bool - true if this iterator less than other, false otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorConstIterator::operator<(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorConstIterator::operator<(
     const const_iterator &other) noexcept {
   return other.m_ptr - this->m_ptr > 0;
 }
@@ -985,8 +1494,8 @@ inline bool vector<T>::VectorConstIterator::operator<(
  * @return bool - true if this iterator is greater than the other, false
  * otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorConstIterator::operator>(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorConstIterator::operator>(
     const const_iterator &other) noexcept {
   return other.m_ptr < this->m_ptr;
 }
@@ -1002,8 +1511,8 @@ inline bool vector<T>::VectorConstIterator::operator>(
  * @return bool - true if this iterator less or equals than other, false
  * otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorConstIterator::operator<=(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorConstIterator::operator<=(
     const const_iterator &other) noexcept {
   return !(this->m_ptr > other.m_ptr);
 }
@@ -1019,8 +1528,8 @@ inline bool vector<T>::VectorConstIterator::operator<=(
  * @return bool - true if this iterator is greater or equals than the other,
  * false otherwise.
  */
-template <typename T>
-inline bool vector<T>::VectorConstIterator::operator>=(
+template <typename T, typename G>
+inline bool vector<T, G>::VectorConstIterator::operator>=(
     const const_iterator &other) noexcept {
   return !(this->m_ptr < other.m_ptr);
 }
@@ -0,0 +1,118 @@
+#include <map>
+#include <random>
+#include <string>
+
+#include "./main_test.h"
+
+using s21_sum_map = s21::aggregate_map<int, long>;
+using std_map = std::map<int, long>;
+
+long sumRange(const std_map &m, int lo, int hi) {
+  long sum{};
+
+  for (auto it = m.lower_bound(lo); it != m.end() && it->first < hi; ++it) {
+    sum += it->second;
+  }
+
+  return sum;
+}
+
+TEST(aggregate_map, emptyAggregate) {
+  s21_sum_map m;
+
+  EXPECT_EQ(m.aggregate(), 0);
+  EXPECT_EQ(m.aggregate(1, 10), 0);
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(aggregate_map, initializerList) {
+  s21_sum_map m{{3, 30}, {1, 10}, {2, 20}, {3, 99}};
+
+  EXPECT_EQ(m.size(), 3U);
+  EXPECT_EQ(m.aggregate(), 60);
+  EXPECT_EQ(m.aggregate(2, 3), 20);
+  EXPECT_EQ(m.aggregate(2, 4), 50);
+  EXPECT_EQ(m.at(3), 30);
+  EXPECT_THROW(m.at(4), std::out_of_range);
+}
+
+TEST(aggregate_map, randomWindows) {
+  std::mt19937 rng{7};
+  s21_sum_map m;
+  std_map std_m;
+
+  for (int step = 0; step < 3000; ++step) {
+    int key = rng() % 500;
+    long value = rng() % 1000;
+
+    switch (rng() % 4) {
+      case 0:
+        EXPECT_EQ(m.insert({key, value}).second,
+                  std_m.insert({key, value}).second);
+        break;
+      case 1:
+        m.insert_or_assign(key, value);
+        std_m[key] = value;
+        break;
+      default:
+        EXPECT_EQ(m.erase(key), std_m.erase(key));
+    }
+
+    if (step % 50 == 0) {
+      for (int lo = -10; lo < 510; lo += 37) {
+        int hi = lo + rng() % 200;
+        EXPECT_EQ(m.aggregate(lo, hi), sumRange(std_m, lo, hi));
+      }
+    }
+  }
+
+  EXPECT_EQ(m.aggregate(), sumRange(std_m, 0, 500));
+  EXPECT_EQ(m.size(), std_m.size());
+}
+
+TEST(aggregate_map, minMaxMonoids) {
+  s21::aggregate_map<int, int, s21::min_monoid<int>> min_m;
+  s21::aggregate_map<int, int, s21::max_monoid<int>> max_m;
+
+  for (int i = 0; i < 100; ++i) {
+    min_m.insert({i, (i * 37) % 101});
+    max_m.insert({i, (i * 37) % 101});
+  }
+
+  EXPECT_EQ(min_m.aggregate(10, 13), 3);
+  EXPECT_EQ(max_m.aggregate(10, 13), 67);
+  EXPECT_EQ(min_m.aggregate(200, 300), std::numeric_limits<int>::max());
+
+  min_m.erase(11);
+  EXPECT_EQ(min_m.aggregate(10, 13), 40);
+}
+
+struct ConcatMonoid {
+  std::string identity() const { return {}; }
+  std::string operator()(const std::string &a, const std::string &b) const {
+    return a + b;
+  }
+};
+
+TEST(aggregate_map, keyOrder) {
+  s21::aggregate_map<int, std::string, ConcatMonoid> m;
+
+  for (int i : {5, 1, 9, 3, 7, 2, 8, 4, 6, 0}) {
+    m.insert({i, std::to_string(i)});
+  }
+
+  EXPECT_EQ(m.aggregate(), "0123456789");
+  EXPECT_EQ(m.aggregate(3, 8), "34567");
+
+  m.insert_or_assign(5, "x");
+  m.erase(4);
+  EXPECT_EQ(m.aggregate(3, 8), "3x67");
+
+  std::string visited;
+  m.for_each_in_range(3, 8, [&visited](const auto &pair) {
+    visited += pair.second;
+    return pair.first < 6;
+  });
+  EXPECT_EQ(visited, "3x6");
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_concurrent_map = s21::concurrent_map<int, int>;
+
+template <typename M>
+std::vector<std::pair<int, int>> ordered(const M &m) {
+  std::vector<std::pair<int, int>> result;
+
+  m.for_each([&result](const auto &pair) { result.push_back(pair); });
+
+  return result;
+}
+
+TEST(concurrent_map, singleThread) {
+  s21::concurrent_map<std::string, int> m{{"b", 2}, {"a", 1}, {"c", 3}};
+
+  EXPECT_EQ(m.size(), 3U);
+  EXPECT_FALSE(m.insert("a", 10));
+  EXPECT_FALSE(m.insert_or_assign("a", 10));
+  EXPECT_EQ(m.find("a"), 10);
+  EXPECT_EQ(m.find("d"), std::nullopt);
+  EXPECT_TRUE(m.visit("b", [](int &value) { value *= 10; }));
+  EXPECT_EQ(m.find("b"), 20);
+  EXPECT_EQ(m.erase("c"), 1U);
+  EXPECT_EQ(m.erase("c"), 0U);
+  EXPECT_FALSE(m.contains("c"));
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(concurrent_map, orderedMerge) {
+  std::mt19937 rng{17};
+  s21_concurrent_map m{7};
+  std::map<int, int> std_m;
+
+  for (int step = 0; step < 2000; ++step) {
+    int key = rng() % 500;
+
+    if (rng() % 4) {
+      m.insert_or_assign(key, step);
+      std_m[key] = step;
+    } else {
+      EXPECT_EQ(m.erase(key), std_m.erase(key));
+    }
+  }
+
+  EXPECT_EQ(ordered(m), (std::vector<std::pair<int, int>>(std_m.begin(),
+                                                           std_m.end())));
+
+  std::vector<int> keys;
+
+  m.for_each_in_range(100, 200, [&keys](const auto &pair) {
+    keys.push_back(pair.first);
+
+    return keys.size() < 10;
+  });
+
+  auto first = std_m.lower_bound(100);
+  std::vector<int> std_keys;
+
+  for (; first != std_m.end() && std_keys.size() < 10; ++first) {
+    std_keys.push_back(first->first);
+  }
+
+  EXPECT_EQ(keys, std_keys);
+}
+
+TEST(concurrent_map, parallelUpdates) {
+  constexpr int kThreads = 4;
+  constexpr int kKeys = 2000;
+  s21_concurrent_map m{16};
+  std::vector<std::thread> threads;
+
+  for (int key = 0; key < kKeys; ++key) {
+    m.insert(key, 0);
+  }
+
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&m, t] {
+      for (int key = 0; key < kKeys; ++key) {
+        m.visit(key, [](int &value) { ++value; });
+        m.insert(kKeys + t * kKeys + key, key);
+        m.find(key);
+      }
+
+      for (int key = 0; key < kKeys; key += 2) {
+        m.erase(kKeys + t * kKeys + key);
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(m.size(), static_cast<std::size_t>(kKeys + kThreads * kKeys / 2));
+
+  for (int key = 0; key < kKeys; ++key) {
+    EXPECT_EQ(m.find(key), kThreads);
+  }
+
+  auto items = ordered(m);
+
+  for (std::size_t i = 1; i < items.size(); ++i) {
+    EXPECT_LT(items[i - 1].first, items[i].first);
+  }
+}
\ No newline at end of file
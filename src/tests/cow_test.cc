@@ -0,0 +1,75 @@
+#include <string>
+#include <utility>
+
+#include "./main_test.h"
+
+TEST(cow, copiesShareUntilWrite) {
+  using s21_map = s21::map<int, std::string>;
+  s21::cow<s21_map> a{s21_map{{1, "one"}, {2, "two"}}};
+  auto b = a;
+  auto c = b;
+
+  EXPECT_EQ(a.use_count(), 3U);
+  EXPECT_EQ(&*a, &*c);
+
+  b.write().insert(3, "three");
+
+  EXPECT_TRUE(b.unique());
+  EXPECT_EQ(a.use_count(), 2U);
+  EXPECT_EQ(a->size(), 2U);
+  EXPECT_EQ(b->size(), 3U);
+  EXPECT_FALSE(c->contains(3));
+  EXPECT_EQ(b.read().at(3), "three");
+}
+
+TEST(cow, uniqueWriteDoesNotCopy) {
+  s21::cow<s21::vector<int>> v{std::in_place, 3};
+  const auto *shared = &*v;
+
+  v.write().push_back(4);
+  v.write()[0] = 10;
+
+  EXPECT_TRUE(v.unique());
+  EXPECT_EQ(v->size(), 4U);
+  EXPECT_EQ((*v)[0], 10);
+  EXPECT_EQ(&*v, shared);
+}
+
+TEST(cow, assignAndMove) {
+  s21::cow<s21::set<int>> a{s21::set<int>{1, 2}};
+  s21::cow<s21::set<int>> b;
+
+  EXPECT_TRUE(b->empty());
+
+  b = a;
+
+  EXPECT_EQ(a.use_count(), 2U);
+
+  s21::cow<s21::set<int>> c{std::move(b)};
+
+  EXPECT_EQ(a.use_count(), 2U);
+  EXPECT_EQ(b.use_count(), 0U);
+
+  c.write().erase(c->find(1));
+  b = c;
+
+  EXPECT_EQ(a->size(), 2U);
+  EXPECT_EQ(b->size(), 1U);
+  EXPECT_EQ(c.use_count(), 2U);
+}
+
+TEST(cow, movedFromReadsEmpty) {
+  s21::cow<s21::vector<int>> a{std::in_place, 2};
+  s21::cow<s21::vector<int>> b{std::move(a)};
+
+  EXPECT_EQ(a.use_count(), 0U);
+  EXPECT_TRUE(a->empty());
+  EXPECT_EQ((*a).size(), 0U);
+  EXPECT_TRUE(a.read().empty());
+
+  a.write().push_back(7);
+
+  EXPECT_TRUE(a.unique());
+  EXPECT_EQ(a->size(), 1U);
+  EXPECT_EQ(b->size(), 2U);
+}
\ No newline at end of file
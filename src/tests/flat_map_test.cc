@@ -0,0 +1,148 @@
+#include <list>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_flat_map = s21::flat_map<int, std::string>;
+
+namespace {
+
+/// @brief Checks a flat map against a std::map.
+void expectSame(const s21_flat_map &m,
+                const std::map<int, std::string> &expected) {
+  auto it = expected.begin();
+
+  ASSERT_EQ(m.size(), expected.size());
+  for (auto [key, value] : m) {
+    EXPECT_EQ(key, it->first);
+    EXPECT_EQ(value, it->second);
+    ++it;
+  }
+}
+
+/// @brief Orders non-negative keys and throws on a negative one.
+struct PoisonLess {
+  bool operator()(int a, int b) const {
+    if (a < 0 || b < 0) {
+      throw std::runtime_error("poisoned key");
+    }
+    return a < b;
+  }
+};
+
+}  // namespace
+
+TEST(flat_map, accessAndInsert) {
+  s21_flat_map m{{3, "c"}, {1, "a"}, {3, "x"}};
+
+  expectSame(m, {{1, "a"}, {3, "c"}});
+  EXPECT_EQ(m.at(3), "c");
+  EXPECT_THROW(m.at(2), std::out_of_range);
+  m[2] = "b";
+  EXPECT_EQ(m[2], "b");
+  EXPECT_FALSE(m.insert({2, "z"}).second);
+  EXPECT_FALSE(m.insert_or_assign(2, "B").second);
+  EXPECT_EQ(m.at(2), "B");
+  EXPECT_TRUE(m.try_emplace(4, 2, 'd').second);
+  EXPECT_TRUE(m.emplace(0, "o").second);
+  EXPECT_EQ(m.find(4)->second, "dd");
+  EXPECT_EQ((*m.lower_bound(2)).first, 2);
+  EXPECT_EQ(m.upper_bound(4), m.end());
+  EXPECT_EQ(m.count(5), 0U);
+  expectSame(m, {{0, "o"}, {1, "a"}, {2, "B"}, {3, "c"}, {4, "dd"}});
+}
+
+TEST(flat_map, iteratorsAndErase) {
+  s21_flat_map m{{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}};
+  s21_flat_map::const_iterator cit = m.begin();
+
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    it->second += "!";
+  }
+  EXPECT_TRUE(cit == m.cbegin());
+  EXPECT_EQ(cit[3].second, "d!");
+  EXPECT_EQ(m.end() - m.begin(), 4);
+  EXPECT_EQ((*m.erase(m.find(2))).first, 3);
+  EXPECT_EQ(m.erase(m.begin(), m.begin() + 2), m.begin());
+  EXPECT_EQ(m.erase(4), 1U);
+  EXPECT_EQ(m.erase(4), 0U);
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(flat_map, batchesAndStorage) {
+  s21_flat_map m(s21::vector<int>{5, 1, 5},
+                 s21::vector<std::string>{"e", "a", "x"});
+  auto results = m.insert_many(std::pair(3, "c"), std::pair(1, "z"),
+                               std::pair(3, "y"), std::pair(7, "g"));
+
+  expectSame(m, {{1, "a"}, {3, "c"}, {5, "e"}, {7, "g"}});
+  EXPECT_EQ((*results[0].first).first, 3);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_EQ((*results[1].first).second, "a");
+  EXPECT_FALSE(results[1].second);
+  EXPECT_EQ((*results[2].first).second, "c");
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ((*results[3].first).first, 7);
+
+  std::list<std::pair<int, std::string>> more{{0, "o"}, {7, "q"}};
+
+  m.insert_range(more.begin(), more.end());
+  EXPECT_EQ(m.at(0), "o");
+  EXPECT_EQ(m.at(7), "g");
+
+  s21_flat_map other{{2, "b"}, {3, "w"}};
+
+  m.merge(other);
+  EXPECT_EQ(m.at(2), "b");
+  expectSame(other, {{3, "w"}});
+
+  auto [keys, values] = std::move(m).extract();
+
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(keys.size(), 6U);
+  EXPECT_EQ(values[1], "a");
+  m.replace(std::move(keys), std::move(values));
+  EXPECT_EQ(m.keys().size(), 6U);
+  EXPECT_EQ(m.values()[0], "o");
+  EXPECT_THROW(m.replace(s21::vector<int>{1}, s21::vector<std::string>{}),
+               std::invalid_argument);
+  other = m;
+  EXPECT_EQ(other.size(), 6U);
+  other.swap(m);
+  EXPECT_EQ(m.size(), 6U);
+}
+
+TEST(flat_map, movableValues) {
+  s21::flat_map<std::string, std::unique_ptr<int>> m;
+
+  m.try_emplace("b", std::make_unique<int>(2));
+  m["a"] = std::make_unique<int>(1);
+  EXPECT_EQ(*m.at("a"), 1);
+  EXPECT_EQ(*(*m.begin()).second, 1);
+  EXPECT_EQ(*m.values()[1], 2);
+}
+
+TEST(flat_map, insertManyThrowKeepsOld) {
+  s21::flat_map<int, std::string, PoisonLess> m{{5, "e"}, {1, "a"}, {3, "c"}};
+  std::list<std::pair<int, std::string>> more{{4, "d"}, {-1, "z"}};
+
+  EXPECT_THROW(m.insert_many(std::pair(7, "g"), std::pair(-1, "z")),
+               std::runtime_error);
+  EXPECT_THROW(m.insert_range(more.begin(), more.end()), std::runtime_error);
+  compare(m.keys(), std::vector<int>{1, 3, 5});
+  compare(m.values(), std::vector<std::string>{"a", "c", "e"});
+  EXPECT_TRUE(m.insert_many(std::pair(4, "d"), std::pair(0, "o"))[1].second);
+  compare(m.keys(), std::vector<int>{0, 1, 3, 4, 5});
+  EXPECT_EQ(m.at(4), "d");
+}
+
+TEST(flat_map, mergeSelf) {
+  s21_flat_map m{{2, "b"}, {1, "a"}};
+
+  m.merge(m);
+  expectSame(m, {{1, "a"}, {2, "b"}});
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_flat_multiset = s21::flat_multiset<int>;
+
+namespace {
+
+/// @brief Orders pairs by their first member only, to observe stability.
+struct ByFirst {
+  bool operator()(const std::pair<int, int> &a,
+                  const std::pair<int, int> &b) const {
+    return a.first < b.first;
+  }
+};
+
+}  // namespace
+
+TEST(flat_multiset, insertErase) {
+  s21_flat_multiset s{3, 1, 3, 2};
+
+  compare(s, std::multiset<int>{1, 2, 3, 3});
+  EXPECT_EQ(*s.insert(3), 3);
+  EXPECT_EQ(s.count(3), 3U);
+  EXPECT_EQ(*s.emplace(0), 0);
+
+  auto [first, last] = s.equal_range(3);
+
+  EXPECT_EQ(last - first, 3);
+  EXPECT_EQ(s.erase(3), 3U);
+  compare(s, std::multiset<int>{0, 1, 2});
+}
+
+TEST(flat_multiset, batchesKeepOrder) {
+  s21::flat_multiset<std::pair<int, int>, ByFirst> s{{1, 0}, {2, 0}};
+  auto results = s.insert_many(std::pair{2, 1}, std::pair{1, 1},
+                               std::pair{2, 2});
+
+  ASSERT_EQ(s.size(), 5U);
+  EXPECT_EQ(s.begin()[1], std::pair(1, 1));
+  EXPECT_EQ(s.begin()[2], std::pair(2, 0));
+  EXPECT_EQ(s.begin()[3], std::pair(2, 1));
+  EXPECT_EQ(s.begin()[4], std::pair(2, 2));
+  EXPECT_EQ(results[0].first - s.begin(), 3);
+  EXPECT_EQ(results[1].first - s.begin(), 1);
+  EXPECT_EQ(results[2].first - s.begin(), 4);
+  EXPECT_TRUE(results[2].second);
+
+  s21::flat_multiset<std::pair<int, int>, ByFirst> other(
+      s21::sorted_equivalent, s21::vector<std::pair<int, int>>{{1, 2}});
+
+  s.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s.begin()[2], std::pair(1, 2));
+}
+
+TEST(flat_multiset, mergeSelf) {
+  s21_flat_multiset s{3, 1, 3, 2, 4, 5, 6, 7, 8};
+
+  s.merge(s);
+  compare(s, std::multiset<int>{1, 2, 3, 3, 4, 5, 6, 7, 8});
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_flat_set = s21::flat_set<int>;
+
+namespace {
+
+/// @brief Orders non-negative keys and throws on a negative one.
+struct PoisonLess {
+  bool operator()(int a, int b) const {
+    if (a < 0 || b < 0) {
+      throw std::runtime_error("poisoned key");
+    }
+    return a < b;
+  }
+};
+
+}  // namespace
+
+TEST(flat_set, insertErase) {
+  s21_flat_set s{5, 1, 3, 1};
+
+  compare(s, std::set<int>{1, 3, 5});
+  EXPECT_EQ(*s.insert(2).first, 2);
+  EXPECT_FALSE(s.insert(2).second);
+  EXPECT_FALSE(s.emplace(5).second);
+  EXPECT_EQ(s.erase(5), 1U);
+  EXPECT_EQ(s.erase(5), 0U);
+  EXPECT_EQ(*s.erase(s.find(2)), 3);
+  EXPECT_TRUE(s.contains(3));
+  EXPECT_FALSE(s.contains(2));
+  EXPECT_EQ(s.count(1), 1U);
+  EXPECT_EQ(*s.lower_bound(2), 3);
+  EXPECT_EQ(s.upper_bound(3), s.end());
+  EXPECT_EQ(s.find(4), s.end());
+  compare(s, std::set<int>{1, 3});
+}
+
+TEST(flat_set, bulkConstruction) {
+  s21_flat_set s(s21::vector<int>{9, 2, 7, 2, 4, 9});
+  s21_flat_set sorted(s21::sorted_unique, s21::vector<int>{1, 2, 3});
+  s21::flat_set<int, std::greater<int>> reversed{1, 3, 2};
+
+  compare(s, std::set<int>{2, 4, 7, 9});
+  compare(sorted, std::set<int>{1, 2, 3});
+  compare(reversed, std::set<int, std::greater<int>>{1, 2, 3});
+}
+
+TEST(flat_set, insertManyMerges) {
+  s21_flat_set s{10, 20, 30};
+  auto results = s.insert_many(25, 5, 20, 25, 35);
+
+  compare(s, std::set<int>{5, 10, 20, 25, 30, 35});
+  ASSERT_EQ(results.size(), 5U);
+  EXPECT_EQ(*results[0].first, 25);
+  EXPECT_TRUE(results[0].second);
+  EXPECT_EQ(*results[1].first, 5);
+  EXPECT_EQ(*results[2].first, 20);
+  EXPECT_FALSE(results[2].second);
+  EXPECT_EQ(*results[3].first, 25);
+  EXPECT_FALSE(results[3].second);
+  EXPECT_EQ(*results[4].first, 35);
+
+  std::list<int> more{0, 35, 40};
+  auto range = s.insert_range(more.begin(), more.end());
+
+  EXPECT_EQ(*range[0].first, 0);
+  EXPECT_FALSE(range[1].second);
+  compare(s, std::set<int>{0, 5, 10, 20, 25, 30, 35, 40});
+}
+
+TEST(flat_set, mergeExtractReplace) {
+  s21::flat_set<std::string> a{"b", "d"};
+  s21::flat_set<std::string> b{"a", "b", "c"};
+
+  a.merge(b);
+  compare(a, std::set<std::string>{"a", "b", "c", "d"});
+  compare(b, std::set<std::string>{"b"});
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+
+  s21::vector<std::string> keys = std::move(b).extract();
+
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(keys.size(), 4U);
+  keys.push_back("e");
+  b.replace(std::move(keys));
+  EXPECT_TRUE(b.contains("e"));
+  a = b;
+  EXPECT_EQ(a.size(), 5U);
+  EXPECT_EQ(a.keys().size(), 5U);
+}
+
+TEST(flat_set, insertManyThrowKeepsOld) {
+  s21::flat_set<int, PoisonLess> s{5, 1, 3};
+  std::vector<int> more{4, -1, 0};
+
+  EXPECT_THROW(s.insert_many(7, -1, 2), std::runtime_error);
+  compare(s, std::set<int>{1, 3, 5});
+  EXPECT_THROW(s.insert_range(more.begin(), more.end()), std::runtime_error);
+  compare(s, std::set<int>{1, 3, 5});
+  EXPECT_TRUE(s.insert_many(4, 0)[1].second);
+  compare(s, std::set<int>{0, 1, 3, 4, 5});
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <map>
+#include <random>
+#include <utility>
+
+#include "./main_test.h"
+
+using s21_interval_map = s21::interval_map<int, int>;
+using interval = std::pair<int, int>;
+using std_map = std::map<interval, int>;
+
+std::vector<std::pair<interval, int>> bruteOverlapping(const std_map &m,
+                                                       int lo, int hi) {
+  std::vector<std::pair<interval, int>> result;
+
+  for (const auto &[key, value] : m) {
+    if (key.first < hi && lo < key.second) {
+      result.push_back({key, value});
+    }
+  }
+
+  return result;
+}
+
+template <typename Vector>
+std::vector<std::pair<interval, int>> toStd(Vector &&v) {
+  std::vector<std::pair<interval, int>> result;
+
+  for (std::size_t i = 0; i < v.size(); ++i) {
+    result.push_back(v[i]);
+  }
+
+  return result;
+}
+
+TEST(interval_map, emptyQueries) {
+  s21_interval_map m;
+
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.overlapping(0, 100).size(), 0U);
+  EXPECT_EQ(m.stabbing(5).size(), 0U);
+  EXPECT_THROW(m.insert(3, 3, 0), std::invalid_argument);
+  EXPECT_THROW(m.insert(4, 3, 0), std::invalid_argument);
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(interval_map, halfOpenBounds) {
+  s21_interval_map m{{{10, 20}, 1}, {{20, 30}, 2}, {{5, 40}, 3}};
+
+  EXPECT_EQ(toStd(m.stabbing(20)),
+            (std::vector<std::pair<interval, int>>{{{5, 40}, 3},
+                                                   {{20, 30}, 2}}));
+  EXPECT_EQ(toStd(m.stabbing(19)),
+            (std::vector<std::pair<interval, int>>{{{5, 40}, 3},
+                                                   {{10, 20}, 1}}));
+  EXPECT_EQ(m.stabbing(40).size(), 0U);
+  EXPECT_EQ(m.overlapping(30, 40).size(), 1U);
+  EXPECT_EQ(m.overlapping(0, 5).size(), 0U);
+  EXPECT_EQ(m.overlapping(0, 6).size(), 1U);
+  EXPECT_EQ(m.at({20, 30}), 2);
+  EXPECT_THROW(m.at({20, 31}), std::out_of_range);
+}
+
+TEST(interval_map, earlyStop) {
+  s21_interval_map m;
+  int visited = 0;
+
+  for (int i = 0; i < 100; ++i) {
+    m.insert(i, i + 10, i);
+  }
+
+  EXPECT_FALSE(m.for_each_overlapping(0, 100, [&visited](const auto &item) {
+    ++visited;
+
+    return item.second < 4;
+  }));
+  EXPECT_EQ(visited, 5);
+  EXPECT_TRUE(m.for_each_stabbing(50, [](auto &item) {
+    item.second = -1;
+  }));
+  EXPECT_EQ(m.at({41, 51}), -1);
+  EXPECT_EQ(m.at({40, 50}), 40);
+}
+
+TEST(interval_map, randomQueries) {
+  std::mt19937 rng{11};
+  s21_interval_map m;
+  std_map std_m;
+
+  for (int step = 0; step < 4000; ++step) {
+    int start = rng() % 1000;
+    interval key{start, start + 1 + rng() % 100};
+
+    if (rng() % 3) {
+      EXPECT_EQ(m.insert(key.first, key.second, step).second,
+                std_m.insert({key, step}).second);
+    } else {
+      EXPECT_EQ(m.erase(key), std_m.erase(key));
+    }
+
+    if (step % 20 == 0) {
+      int lo = rng() % 1100;
+      int hi = lo + 1 + rng() % 50;
+
+      EXPECT_EQ(toStd(m.overlapping(lo, hi)), bruteOverlapping(std_m, lo, hi));
+      EXPECT_EQ(toStd(m.stabbing(lo)), bruteOverlapping(std_m, lo, lo + 1));
+    }
+  }
+
+  EXPECT_EQ(m.size(), std_m.size());
+  auto it = std_m.begin();
+
+  for (const auto &item : m) {
+    EXPECT_EQ(item, *it++);
+  }
+}
\ No newline at end of file
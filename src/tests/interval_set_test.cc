@@ -0,0 +1,66 @@
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_interval_set = s21::interval_set<long>;
+using interval = std::pair<long, long>;
+
+TEST(interval_set, insertErase) {
+  s21_interval_set s{{1, 5}, {3, 4}, {1, 5}, {1, 2}};
+
+  EXPECT_EQ(s.size(), 3U);
+  EXPECT_EQ(*s.begin(), interval(1, 2));
+  EXPECT_EQ(*++s.begin(), interval(1, 5));
+  EXPECT_FALSE(s.insert(3, 4).second);
+  EXPECT_TRUE(s.contains({3, 4}));
+  EXPECT_EQ(s.erase({3, 4}), 1U);
+  EXPECT_EQ(s.erase({3, 4}), 0U);
+  EXPECT_TRUE(s.find({3, 4}) == s.end());
+  EXPECT_THROW(s.insert(7, 7), std::invalid_argument);
+}
+
+TEST(interval_set, randomQueries) {
+  std::mt19937 rng{5};
+  s21_interval_set s;
+  std::set<interval> std_s;
+
+  for (int step = 0; step < 3000; ++step) {
+    long start = rng() % 10000;
+    interval key{start, start + 1 + rng() % 2000};
+
+    if (rng() % 4) {
+      s.insert(key);
+      std_s.insert(key);
+    } else if (!std_s.empty()) {
+      auto it = s.begin();
+
+      for (unsigned shift = rng() % s.size(); shift; --shift) {
+        ++it;
+      }
+
+      std_s.erase(*it);
+      s.erase(it);
+    }
+
+    long point = rng() % 12000;
+    std::vector<interval> expected;
+    std::vector<interval> found;
+
+    for (const auto &item : std_s) {
+      if (item.first <= point && point < item.second) {
+        expected.push_back(item);
+      }
+    }
+
+    for (const auto &item : s.stabbing(point)) {
+      found.push_back(item);
+    }
+
+    EXPECT_EQ(found, expected);
+  }
+
+  EXPECT_EQ(s.size(), std_s.size());
+}
\ No newline at end of file
@@ -20,4 +20,18 @@ void compare(tree1 s1, tree2 s2) {
   EXPECT_EQ(s1.empty(), s2.empty());
 }
 
+/// @brief Counts its live instances to check construction and destruction.
+struct Tracked {
+  static inline int live = 0;
+
+  int value;
+
+  explicit Tracked(int v) : value(v) { ++live; }
+  Tracked(const Tracked &other) : value(other.value) { ++live; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++live; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) = default;
+  ~Tracked() { --live; }
+};
+
 #endif
\ No newline at end of file
@@ -1,4 +1,11 @@
+#include <cctype>
+#include <functional>
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include "./main_test.h"
 
@@ -416,7 +423,7 @@ TEST(map, insert_many) {
   s21_vector vec =
       map1.insert_many(std::make_pair(10, 9), std::make_pair(3, 9),
                        std::make_pair(5, 9), std::make_pair(16, 9));
-  s21::vector<std::pair<int, int>> check = {{10, 9}, {0, 0}, {0, 0}, {16, 9}};
+  s21::vector<std::pair<int, int>> check = {{10, 9}, {3, 3}, {5, 5}, {16, 9}};
   s21::vector<bool> check2 = {1, 0, 0, 1};
 
   int i = 0;
@@ -449,4 +456,279 @@ TEST(map, insert_many_empty) {
   }
 
   compare_map(map1, map_std);
+}
+
+TEST(map, insert_many_into_large_map) {
+  s21_map s21_m;
+  std_map std_m;
+
+  for (int i = 0; i < 1000; ++i) {
+    s21_m.insert({i * 3, i});
+    std_m.insert({i * 3, i});
+  }
+
+  s21_vector vec =
+      s21_m.insert_many(std::make_pair(7, 1), std::make_pair(3, 1),
+                        std::make_pair(2997, 1), std::make_pair(7, 2));
+  bool check[] = {true, false, false, false};
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(vec[i].second, check[i]);
+  }
+  EXPECT_EQ((*vec[0].first).second, 1);
+
+  std_m.insert({7, 1});
+  compare_map(s21_m, std_m);
+}
+
+TEST(map, insert_range) {
+  s21_map s21_m = {{1, 1}, {2, 2}, {3, 3}};
+  std_map std_m = {{1, 1}, {2, 2}, {3, 3}};
+  std::vector<std::pair<int, int>> batch;
+
+  for (int i = 0; i < 10000; ++i) {
+    batch.push_back({(i * 7919) % 12007, i});
+  }
+
+  s21_vector vec = s21_m.insert_range(batch.begin(), batch.end());
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    auto std_result = std_m.insert(batch[i]);
+    EXPECT_EQ(vec[i].second, std_result.second);
+    if (vec[i].second) {
+      EXPECT_EQ((*vec[i].first).first, batch[i].first);
+    }
+  }
+
+  compare_map(s21_m, std_m);
+}
+
+TEST(map, emplaceMoveOnly) {
+  s21::map<const int, std::unique_ptr<int>> m;
+
+  auto result = m.emplace(1, std::make_unique<int>(10));
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*(*result.first).second, 10);
+
+  auto value = std::make_unique<int>(20);
+  result = m.try_emplace(1, std::move(value));
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*(*result.first).second, 10);
+  EXPECT_NE(value, nullptr);
+
+  result = m.try_emplace(2, std::move(value));
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(value, nullptr);
+
+  result = m.insert({3, std::make_unique<int>(30)});
+  EXPECT_TRUE(result.second);
+
+  m[4] = std::make_unique<int>(40);
+
+  int expected = 10;
+  for (auto it = m.begin(); it != m.end(); ++it, expected += 10) {
+    EXPECT_EQ(*(*it).second, expected);
+  }
+  EXPECT_EQ(m.size(), 4U);
+}
+
+TEST(map, tryEmplaceNoCopies) {
+  s21::map<std::string, std::string> m;
+  std::string key(100, 'k');
+  std::string value(100, 'v');
+
+  m.try_emplace(std::move(key), std::move(value));
+  EXPECT_TRUE(key.empty());
+  EXPECT_TRUE(value.empty());
+
+  m.try_emplace(std::string(100, 'k'), 3, 'x');
+  m.emplace(std::string(100, 'a'), std::string(3, 'a'));
+  m[std::string(100, 'b')] = "b";
+
+  EXPECT_EQ(m.at(std::string(100, 'k')), std::string(100, 'v'));
+  EXPECT_EQ(m.at(std::string(100, 'a')), "aaa");
+  EXPECT_EQ(m.at(std::string(100, 'b')), "b");
+  EXPECT_EQ(m.size(), 3U);
+}
+
+TEST(map, transparentLookup) {
+  s21::map<std::string, int, std::less<>> m = {
+      {"accept", 1}, {"host", 2}, {"user-agent", 3}};
+  std::string_view host{"host"};
+
+  EXPECT_EQ((*m.find(host)).second, 2);
+  EXPECT_EQ((*m.find("accept")).second, 1);
+  EXPECT_TRUE(m.find(std::string_view{"cookie"}) == m.end());
+  EXPECT_TRUE(m.contains(host));
+  EXPECT_FALSE(m.contains(std::string_view{"cookie"}));
+  EXPECT_EQ(m.count(host), 1U);
+  EXPECT_EQ((*m.lower_bound(std::string_view{"b"})).first, "host");
+  EXPECT_EQ((*m.upper_bound(host)).first, "user-agent");
+  EXPECT_TRUE(m.upper_bound(std::string_view{"z"}) == m.end());
+
+  EXPECT_EQ(m.erase(std::string_view{"user-agent"}), 1U);
+  EXPECT_EQ(m.erase(std::string_view{"user-agent"}), 0U);
+  EXPECT_EQ(m.size(), 2U);
+}
+
+TEST(map, lookup) {
+  s21_map s21_m = {{1, 1}, {3, 3}, {5, 5}};
+  std_map std_m = {{1, 1}, {3, 3}, {5, 5}};
+
+  for (int key = 0; key < 7; ++key) {
+    EXPECT_EQ(s21_m.count(key), std_m.count(key));
+    EXPECT_EQ(s21_m.find(key) == s21_m.end(), std_m.find(key) == std_m.end());
+    EXPECT_EQ(s21_m.lower_bound(key) == s21_m.end(),
+              std_m.lower_bound(key) == std_m.end());
+    if (std_m.lower_bound(key) != std_m.end()) {
+      EXPECT_EQ((*s21_m.lower_bound(key)).first,
+                (*std_m.lower_bound(key)).first);
+    }
+    if (std_m.upper_bound(key) != std_m.end()) {
+      EXPECT_EQ((*s21_m.upper_bound(key)).first,
+                (*std_m.upper_bound(key)).first);
+    }
+  }
+
+  EXPECT_EQ(s21_m.erase(5), std_m.erase(5));
+  EXPECT_EQ(s21_m.erase(5), std_m.erase(5));
+  compare_map(s21_m, std_m);
+}
+
+struct CaseInsensitiveLess {
+  bool operator()(const std::string &a, const std::string &b) const {
+    return std::lexicographical_compare(
+        a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+          return std::tolower(static_cast<unsigned char>(x)) <
+                 std::tolower(static_cast<unsigned char>(y));
+        });
+  }
+};
+
+TEST(map, customComparator) {
+  s21::map<std::string, int, CaseInsensitiveLess> m;
+
+  EXPECT_TRUE(m.insert({"Content-Type", 1}).second);
+  EXPECT_FALSE(m.insert({"content-type", 2}).second);
+  EXPECT_TRUE(m.insert({"ACCEPT", 3}).second);
+
+  EXPECT_EQ(m.at("CONTENT-TYPE"), 1);
+  EXPECT_EQ((*m.begin()).first, "ACCEPT");
+  EXPECT_EQ(m.size(), 2U);
+}
+
+struct ModuloLess {
+  int mod;
+
+  bool operator()(int a, int b) const { return a % mod < b % mod; }
+};
+
+TEST(map, statefulComparator) {
+  s21::map<int, int, ModuloLess> m{ModuloLess{10}};
+
+  EXPECT_TRUE(m.insert({3, 3}).second);
+  EXPECT_FALSE(m.insert({13, 13}).second);
+  EXPECT_TRUE(m.insert({21, 21}).second);
+  EXPECT_EQ((*m.begin()).first, 21);
+  EXPECT_EQ(m.key_comp().mod, 10);
+  EXPECT_TRUE(m.contains(33));
+}
+
+TEST(map, threeWayComparator) {
+  s21::map<std::string, int, s21::compare_three_way> m;
+
+  for (int i = 0; i < 100; ++i) {
+    m.insert({std::to_string(i), i});
+  }
+
+  EXPECT_EQ(m.at("42"), 42);
+  EXPECT_EQ((*m.find(std::string_view{"7"})).second, 7);
+  EXPECT_EQ((*m.lower_bound("955")).first, "96");
+  EXPECT_FALSE(m.contains("100"));
+  EXPECT_EQ(m.size(), 100U);
+}
+
+TEST(map, threadedLinks) {
+  s21::map<int, int, std::less<int>, true> m;
+  std::map<int, int> std_m;
+
+  for (int i = 0; i < 300; ++i) {
+    m.insert({(i * 17) % 257, i});
+    std_m.insert({(i * 17) % 257, i});
+  }
+
+  s21::vector<std::pair<int, int>> batch;
+
+  for (int i = 0; i < 600; i += 2) {
+    batch.push_back({i, -i});
+    std_m.insert({i, -i});
+  }
+
+  m.insert_range(batch.begin(), batch.end());
+
+  for (int key = 0; key < 600; key += 5) {
+    m.erase(key);
+    std_m.erase(key);
+  }
+
+  s21::map<int, int, std::less<int>, true> copy{m};
+  auto std_it = std_m.begin();
+
+  for (auto it = copy.begin(); it != copy.end(); ++it, ++std_it) {
+    EXPECT_EQ((*it).first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+
+  EXPECT_TRUE(std_it == std_m.end());
+  EXPECT_EQ(copy.size(), std_m.size());
+}
+
+TEST(map, forEachInRange) {
+  s21_map m;
+
+  for (int i = 0; i < 200; ++i) {
+    m.insert({i * 3, i});
+  }
+
+  long sum{};
+  int prev{-1};
+  bool ordered{true};
+
+  EXPECT_TRUE(m.for_each_in_range(30, 91, [&](const auto &pair) {
+    ordered = ordered && prev < pair.first;
+    prev = pair.first;
+    sum += pair.second;
+  }));
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(sum, (10 + 30) * 21 / 2);
+
+  int visited{};
+  EXPECT_FALSE(m.for_each([&visited](auto &pair) {
+    pair.second = -pair.second;
+    return ++visited < 5;
+  }));
+  EXPECT_EQ(visited, 5);
+  EXPECT_EQ(m.at(12), -4);
+  EXPECT_EQ(m.at(15), 5);
+
+  EXPECT_TRUE(m.for_each_in_range(50, 10, [](const auto &) { return false; }));
+}
+
+TEST(map, keyIsConst) {
+  s21::map<int, int> m{{1, 10}, {2, 20}, {3, 30}};
+  auto it = m.begin();
+
+  static_assert(
+      std::is_const_v<std::remove_reference_t<decltype((*it).first)>>);
+  static_assert(std::is_same_v<s21::map<int, int>::value_type,
+                               std::pair<const int, int>>);
+  (*it).second = 11;
+  m.for_each([](auto &pair) {
+    static_assert(
+        std::is_const_v<std::remove_reference_t<decltype(pair.first)>>);
+    ++pair.second;
+    return true;
+  });
+  EXPECT_EQ(m.at(1), 12);
+  EXPECT_TRUE(m.contains(3));
 }
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_multimap = s21::multimap<int, int>;
+using std_multimap = std::multimap<int, int>;
+
+template <typename MM>
+std::vector<std::pair<int, int>> contents(const MM &mm) {
+  std::vector<std::pair<int, int>> result;
+
+  for (auto it = mm.begin(); it != mm.end(); ++it) {
+    result.push_back(*it);
+  }
+
+  return result;
+}
+
+TEST(multimap, insertKeepsOrder) {
+  s21::multimap<std::string, int> mm{{"b", 1}, {"a", 2}, {"b", 3}};
+
+  mm.insert("b", 4);
+  mm.emplace("a", 5);
+
+  auto [first, last] = mm.equal_range("b");
+  std::vector<int> values;
+
+  for (; first != last; ++first) {
+    values.push_back((*first).second);
+  }
+
+  EXPECT_EQ(values, (std::vector<int>{1, 3, 4}));
+  EXPECT_EQ((*mm.find("a")).second, 2);
+  EXPECT_EQ(mm.count("a"), 2U);
+  EXPECT_EQ(mm.count("c"), 0U);
+  EXPECT_TRUE(mm.find("c") == mm.end());
+  EXPECT_FALSE(mm.contains("c"));
+  EXPECT_EQ(mm.size(), 5U);
+}
+
+TEST(multimap, eraseByPosition) {
+  s21_multimap mm{{1, 10}, {1, 11}, {1, 12}, {1, 13}, {2, 20}};
+  auto it = mm.find(1);
+
+  ++it;
+  it = mm.erase(it);
+
+  EXPECT_EQ((*it).second, 12);
+  EXPECT_EQ(contents(mm), (std::vector<std::pair<int, int>>{
+                              {1, 10}, {1, 12}, {1, 13}, {2, 20}}));
+  EXPECT_EQ(mm.erase(1), 3U);
+  EXPECT_EQ(mm.erase(1), 0U);
+  EXPECT_EQ(contents(mm), (std::vector<std::pair<int, int>>{{2, 20}}));
+}
+
+TEST(multimap, insertManyAndMerge) {
+  s21_multimap mm{{5, 0}, {3, 1}};
+  s21_multimap other{{5, 2}, {3, 3}, {5, 4}};
+
+  mm.insert_many(std::pair{5, 5}, std::pair{1, 6}, std::pair{5, 7});
+  mm.merge(other);
+
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(contents(mm), (std::vector<std::pair<int, int>>{{1, 6},
+                                                            {3, 1},
+                                                            {3, 3},
+                                                            {5, 0},
+                                                            {5, 5},
+                                                            {5, 7},
+                                                            {5, 2},
+                                                            {5, 4}}));
+  EXPECT_EQ(mm.count(5), 5U);
+}
+
+TEST(multimap, randomOperations) {
+  std::mt19937 rng{3};
+  s21_multimap mm;
+  std_multimap std_mm;
+
+  for (int step = 0; step < 4000; ++step) {
+    int key = rng() % 40;
+
+    switch (rng() % 5) {
+      case 0:
+        EXPECT_EQ(mm.erase(key), std_mm.erase(key));
+        break;
+      case 1:
+        if (std_mm.count(key)) {
+          std::size_t shift = rng() % std_mm.count(key);
+          auto it = mm.find(key);
+          auto std_it = std_mm.find(key);
+
+          for (std::size_t i = 0; i < shift; ++i, ++it, ++std_it) {
+          }
+
+          mm.erase(it);
+          std_mm.erase(std_it);
+        }
+        break;
+      default:
+        mm.insert({key, step});
+        std_mm.insert({key, step});
+    }
+
+    EXPECT_EQ(mm.count(key), std_mm.count(key));
+  }
+
+  EXPECT_EQ(mm.size(), std_mm.size());
+  EXPECT_EQ(contents(mm), contents(std_mm));
+}
+
+TEST(multimap, eraseKeyThreaded) {
+  std::mt19937 rng{5};
+  s21::multimap<int, int, std::less<int>, true> mm;
+  std_multimap std_mm;
+
+  for (int step = 0; step < 3000; ++step) {
+    int key = rng() % 20;
+
+    if (rng() % 4) {
+      mm.insert({key, step});
+      std_mm.insert({key, step});
+    } else {
+      EXPECT_EQ(mm.erase(key), std_mm.erase(key));
+    }
+  }
+
+  EXPECT_EQ(contents(mm), contents(std_mm));
+
+  for (int key = 0; key < 20; ++key) {
+    EXPECT_EQ(mm.erase(key), std_mm.erase(key));
+  }
+
+  EXPECT_TRUE(mm.empty());
+  EXPECT_TRUE(mm.begin() == mm.end());
+}
\ No newline at end of file
@@ -1,8 +1,14 @@
+#include <functional>
+#include <random>
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "./main_test.h"
 
 using s21_multiset = s21::multiset<int>;
+using s21_counted = s21::multiset<int, std::less<int>, false, true>;
 using s21_set = s21::set<int>;
 using std_multiset = std::multiset<int>;
 using s21_vector = s21::vector<std::pair<s21_multiset::iterator, bool>>;
@@ -315,4 +321,180 @@ TEST(multiset, insert_many_empty) {
   }
 
   compare(ms1, ms_std);
+}
+
+TEST(multiset, insert_range) {
+  s21_multiset ms1 = {1, 2, 3, 4, 5, 1, 2, 3};
+  std_multiset ms_std = {1, 2, 3, 4, 5, 1, 2, 3};
+  std::vector<int> batch;
+
+  for (int i = 0; i < 5000; ++i) {
+    batch.push_back((i * 7919) % 97);
+  }
+
+  s21_vector vec = ms1.insert_range(batch.begin(), batch.end());
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    EXPECT_EQ(*(vec[i].first), batch[i]);
+    EXPECT_EQ(vec[i].second, true);
+    ms_std.insert(batch[i]);
+  }
+
+  compare(ms1, ms_std);
+}
+
+TEST(multiset, insertRvalue) {
+  s21::multiset<std::string> ms;
+  std::string value(100, 'a');
+
+  ms.insert(std::move(value));
+  EXPECT_TRUE(value.empty());
+
+  ms.insert(std::string(100, 'a'));
+  ms.emplace(100, 'a');
+  EXPECT_EQ(ms.count(std::string(100, 'a')), 3U);
+}
+
+TEST(multiset, transparentLookup) {
+  s21::multiset<std::string, std::less<>> ms = {"host", "accept", "host",
+                                                "user-agent", "host"};
+  std::string_view host{"host"};
+
+  EXPECT_EQ(ms.count(host), 3U);
+  EXPECT_TRUE(ms.contains(host));
+  EXPECT_EQ(*ms.find(host), "host");
+
+  auto range = ms.equal_range(host);
+  EXPECT_EQ(*ms.lower_bound(host), "host");
+  EXPECT_EQ(*ms.upper_bound(host), "user-agent");
+
+  size_t count{};
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ(*it, "host");
+    ++count;
+  }
+  EXPECT_EQ(count, 3U);
+}
+
+TEST(multiset, reverseOrder) {
+  s21::multiset<int, std::greater<int>> ms = {1, 3, 2, 3, 1};
+  std::multiset<int, std::greater<int>> std_ms = {1, 3, 2, 3, 1};
+
+  compare(ms, std_ms);
+  EXPECT_EQ(ms.count(3), 2U);
+  EXPECT_EQ(*ms.upper_bound(3), 2);
+}
+
+TEST(multiset, forEachInRange) {
+  s21_multiset ms;
+  std_multiset std_ms;
+
+  for (int i = 0; i < 400; ++i) {
+    ms.insert((i * 7) % 40);
+    std_ms.insert((i * 7) % 40);
+  }
+
+  for (int lo = 0; lo < 42; lo += 3) {
+    for (int hi = lo; hi < 45; hi += 4) {
+      size_t count{};
+      ms.for_each_in_range(lo, hi, [&count](int) { ++count; });
+      EXPECT_EQ(count, static_cast<size_t>(std::distance(
+                           std_ms.lower_bound(lo), std_ms.lower_bound(hi))));
+    }
+  }
+
+  int first_two{};
+  EXPECT_FALSE(ms.for_each([&first_two](int key) {
+    first_two += key + 1;
+    return key == 0;
+  }));
+  EXPECT_EQ(first_two, 10 + 2);
+}
+
+TEST(multiset, countedRuns) {
+  s21_counted ms{3, 1, 3, 2, 3};
+  std_multiset std_ms{3, 1, 3, 2, 3};
+
+  compare(ms, std_ms);
+  EXPECT_EQ(ms.distinct(), 3U);
+  EXPECT_EQ(ms.count(3), 3U);
+  EXPECT_EQ(ms.count(4), 0U);
+
+  auto [first, last] = ms.equal_range(3);
+  int run{};
+
+  for (; first != last; ++first) {
+    EXPECT_EQ(*first, 3);
+    ++run;
+  }
+
+  EXPECT_EQ(run, 3);
+  EXPECT_EQ(*--ms.end(), 3);
+  EXPECT_EQ(*ms.find(2), 2);
+  EXPECT_TRUE(ms.find(4) == ms.end());
+}
+
+TEST(multiset, countedHistogram) {
+  s21_counted ms;
+
+  for (int i = 0; i < 1000000; ++i) {
+    ms.insert(i % 4);
+  }
+
+  ms.insert(7, 1000);
+
+  EXPECT_EQ(ms.size(), 1001000U);
+  EXPECT_EQ(ms.distinct(), 5U);
+  EXPECT_EQ(ms.count(2), 250000U);
+  EXPECT_EQ(ms.erase(2), 250000U);
+  EXPECT_EQ(ms.size(), 751000U);
+
+  size_t visited{};
+  ms.for_each_run([&visited](int key, size_t run) {
+    EXPECT_NE(key, 2);
+    visited += run;
+  });
+  EXPECT_EQ(visited, ms.size());
+}
+
+TEST(multiset, countedRandomOperations) {
+  std::mt19937 rng{9};
+  s21_counted ms;
+  std_multiset std_ms;
+
+  for (int step = 0; step < 3000; ++step) {
+    int key = rng() % 20;
+
+    if (rng() % 3 || std_ms.empty()) {
+      ms.insert(key);
+      std_ms.insert(key);
+    } else {
+      auto shift = rng() % std_ms.size();
+      auto it = ms.begin();
+      auto std_it = std_ms.begin();
+
+      for (; shift; --shift, ++it, ++std_it) {
+      }
+
+      auto next = ms.erase(it);
+      auto std_next = std_ms.erase(std_it);
+
+      EXPECT_EQ(next == ms.end(), std_next == std_ms.end());
+
+      if (std_next != std_ms.end()) {
+        EXPECT_EQ(*next, *std_next);
+      }
+    }
+
+    EXPECT_EQ(ms.count(key), std_ms.count(key));
+  }
+
+  compare(ms, std_ms);
+
+  s21_counted other{5, 5, 21};
+
+  ms.merge(other);
+  std_ms.insert({5, 5, 21});
+  compare(ms, std_ms);
+  EXPECT_TRUE(other.empty());
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_persistent_map = s21::persistent_map<int, int>;
+using std_map = std::map<int, int>;
+
+template <typename M>
+std::vector<std::pair<int, int>> contents(const M &m) {
+  std::vector<std::pair<int, int>> result;
+
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    result.push_back(*it);
+  }
+
+  return result;
+}
+
+TEST(persistent_map, versionsStayUnchanged) {
+  s21::persistent_map<std::string, int> v0{{"b", 2}, {"a", 1}};
+  auto v1 = v0.insert("c", 3);
+  auto v2 = v1.insert_or_assign("a", 10);
+  auto v3 = v2.erase("b");
+
+  EXPECT_EQ(v0.size(), 2U);
+  EXPECT_FALSE(v0.contains("c"));
+  EXPECT_EQ(v1.at("a"), 1);
+  EXPECT_EQ(v2.at("a"), 10);
+  EXPECT_EQ(v2.at("b"), 2);
+  EXPECT_FALSE(v3.contains("b"));
+  EXPECT_EQ(v3.size(), 2U);
+  EXPECT_THROW(v3.at("b"), std::out_of_range);
+  EXPECT_TRUE(v3.find("b") == v3.end());
+  EXPECT_EQ((*v3.lower_bound("b")).first, "c");
+}
+
+TEST(persistent_map, unchangedUpdatesShareRoot) {
+  s21_persistent_map v0{{1, 1}, {2, 2}, {3, 3}};
+  auto copy = v0;
+
+  EXPECT_TRUE(copy.shares_root(v0));
+  EXPECT_TRUE(v0.insert(2, 20).shares_root(v0));
+  EXPECT_TRUE(v0.erase(4).shares_root(v0));
+  EXPECT_FALSE(v0.insert(4, 4).shares_root(v0));
+  EXPECT_EQ(v0.insert(2, 20).at(2), 2);
+  EXPECT_TRUE(s21_persistent_map{}.empty());
+}
+
+TEST(persistent_map, forEachStops) {
+  s21_persistent_map m{{4, 0}, {1, 0}, {3, 0}, {2, 0}};
+  std::vector<int> keys;
+
+  EXPECT_FALSE(m.for_each([&keys](const auto &pair) {
+    keys.push_back(pair.first);
+
+    return pair.first < 3;
+  }));
+  EXPECT_EQ(keys, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(persistent_map, randomVersions) {
+  std::mt19937 rng{11};
+  std::vector<s21_persistent_map> versions{s21_persistent_map{}};
+  std::vector<std_map> std_versions{std_map{}};
+
+  for (int step = 0; step < 3000; ++step) {
+    std::size_t from = rng() % versions.size();
+    int key = rng() % 200;
+    s21_persistent_map next;
+    std_map std_next = std_versions[from];
+
+    switch (rng() % 3) {
+      case 0:
+        next = versions[from].erase(key);
+        std_next.erase(key);
+        break;
+      case 1:
+        next = versions[from].insert_or_assign(key, step);
+        std_next[key] = step;
+        break;
+      default:
+        next = versions[from].insert(key, step);
+        std_next.insert({key, step});
+    }
+
+    versions.push_back(next);
+    std_versions.push_back(std_next);
+  }
+
+  for (std::size_t i = 0; i < versions.size(); i += 7) {
+    EXPECT_EQ(versions[i].size(), std_versions[i].size());
+    EXPECT_EQ(contents(versions[i]), contents(std_versions[i]));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <random>
+#include <set>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_persistent_set = s21::persistent_set<int>;
+
+TEST(persistent_set, insertErase) {
+  s21_persistent_set v0{5, 1, 3, 1};
+  auto v1 = v0.insert(2).erase(5);
+
+  EXPECT_EQ(v0.size(), 3U);
+  EXPECT_EQ(v1.size(), 3U);
+  EXPECT_EQ(*v0.begin(), 1);
+  EXPECT_EQ(*++v1.begin(), 2);
+  EXPECT_TRUE(v0.contains(5));
+  EXPECT_FALSE(v1.contains(5));
+  EXPECT_TRUE(v1.find(4) == v1.end());
+  EXPECT_EQ(*v0.lower_bound(4), 5);
+  EXPECT_TRUE(v1.lower_bound(4) == v1.end());
+}
+
+TEST(persistent_set, randomVersions) {
+  std::mt19937 rng{13};
+  s21_persistent_set s;
+  std::set<int> std_s;
+  std::vector<std::pair<s21_persistent_set, std::set<int>>> snapshots;
+
+  for (int step = 0; step < 4000; ++step) {
+    int key = rng() % 300;
+
+    if (rng() % 3) {
+      s = s.insert(key);
+      std_s.insert(key);
+    } else {
+      s = s.erase(key);
+      std_s.erase(key);
+    }
+
+    if (step % 100 == 0) {
+      snapshots.push_back({s, std_s});
+    }
+  }
+
+  snapshots.push_back({s, std_s});
+
+  for (const auto &[snapshot, std_snapshot] : snapshots) {
+    std::vector<int> keys;
+
+    snapshot.for_each([&keys](int key) { keys.push_back(key); });
+
+    EXPECT_EQ(snapshot.size(), std_snapshot.size());
+    EXPECT_EQ(keys, std::vector<int>(std_snapshot.begin(), std_snapshot.end()));
+  }
+}
\ No newline at end of file
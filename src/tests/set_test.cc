@@ -1,4 +1,8 @@
+#include <functional>
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "./main_test.h"
 
@@ -390,7 +394,7 @@ TEST(set, insert_many) {
   s21_set s1 = {1, 2, 3, 4, 5};
   std_set s_std = {1, 2, 3, 4, 5};
   s21_vector vec = s1.insert_many(10, 3, 5, 16);
-  s21::vector<int> check = {10, 0, 0, 16};
+  s21::vector<int> check = {10, 3, 5, 16};
   s21::vector<bool> check2 = {1, 0, 0, 1};
 
   int i = 0;
@@ -421,4 +425,118 @@ TEST(set, insert_many_empty) {
   }
 
   compare(s1, s_std);
+}
+
+TEST(set, insert_range) {
+  s21_set s1 = {1, 2, 3, 4, 5};
+  std_set s_std = {1, 2, 3, 4, 5};
+  std::vector<int> batch;
+
+  for (int i = 0; i < 10000; ++i) {
+    batch.push_back((i * 7919) % 12007);
+  }
+
+  s21_vector vec = s1.insert_range(batch.begin(), batch.end());
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    EXPECT_EQ(vec[i].second, s_std.insert(batch[i]).second);
+  }
+
+  compare(s1, s_std);
+}
+
+TEST(set, insertRvalue) {
+  s21::set<std::string> s;
+  std::string first(100, 'a');
+  std::string second(100, 'a');
+
+  auto result = s.insert(std::move(first));
+  EXPECT_TRUE(result.second);
+  EXPECT_TRUE(first.empty());
+
+  result = s.insert(std::move(second));
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(second, std::string(100, 'a'));
+
+  result = s.emplace(3, 'b');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "bbb");
+  EXPECT_EQ(s.size(), 2U);
+}
+
+TEST(set, transparentLookup) {
+  s21::set<std::string, std::less<>> s = {"accept", "host", "user-agent"};
+  std::string_view host{"host"};
+
+  EXPECT_EQ(*s.find(host), "host");
+  EXPECT_TRUE(s.find(std::string_view{"cookie"}) == s.end());
+  EXPECT_TRUE(s.contains(host));
+  EXPECT_EQ(s.count(std::string_view{"cookie"}), 0U);
+  EXPECT_EQ(*s.lower_bound(std::string_view{"b"}), "host");
+  EXPECT_EQ(*s.upper_bound(host), "user-agent");
+
+  EXPECT_EQ(s.erase(host), 1U);
+  EXPECT_EQ(s.erase(host), 0U);
+  EXPECT_EQ(s.size(), 2U);
+}
+
+TEST(set, lookup) {
+  s21_set s21_s = {1, 3, 5};
+  std_set std_s = {1, 3, 5};
+
+  for (int key = 0; key < 7; ++key) {
+    EXPECT_EQ(s21_s.count(key), std_s.count(key));
+    if (std_s.lower_bound(key) != std_s.end()) {
+      EXPECT_EQ(*s21_s.lower_bound(key), *std_s.lower_bound(key));
+    } else {
+      EXPECT_TRUE(s21_s.lower_bound(key) == s21_s.end());
+    }
+    if (std_s.upper_bound(key) != std_s.end()) {
+      EXPECT_EQ(*s21_s.upper_bound(key), *std_s.upper_bound(key));
+    } else {
+      EXPECT_TRUE(s21_s.upper_bound(key) == s21_s.end());
+    }
+  }
+
+  EXPECT_EQ(s21_s.erase(3), std_s.erase(3));
+  compare(s21_s, std_s);
+}
+
+TEST(set, reverseOrder) {
+  s21::set<int, std::greater<int>> s21_s = {5, 1, 4, 2, 3};
+  std::set<int, std::greater<int>> std_s = {5, 1, 4, 2, 3};
+
+  compare(s21_s, std_s);
+  EXPECT_EQ(*s21_s.lower_bound(3), *std_s.lower_bound(3));
+  EXPECT_EQ(*s21_s.upper_bound(3), *std_s.upper_bound(3));
+
+  s21_s.insert(0);
+  std_s.insert(0);
+  s21_s.erase(4);
+  std_s.erase(4);
+  compare(s21_s, std_s);
+}
+
+TEST(set, forEachInRange) {
+  s21_set s;
+  std_set std_s;
+
+  for (int i = 0; i < 500; ++i) {
+    s.insert((i * 29) % 311);
+    std_s.insert((i * 29) % 311);
+  }
+
+  for (int lo = -5; lo < 320; lo += 17) {
+    for (int hi = lo; hi < 330; hi += 23) {
+      std::vector<int> visited;
+      s.for_each_in_range(lo, hi,
+                          [&visited](int key) { visited.push_back(key); });
+      std::vector<int> expected(std_s.lower_bound(lo), std_s.lower_bound(hi));
+      EXPECT_EQ(visited, expected);
+    }
+  }
+
+  std::vector<int> all;
+  s.for_each([&all](int key) { all.push_back(key); });
+  EXPECT_EQ(all, std::vector<int>(std_s.begin(), std_s.end()));
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_skiplist_map = s21::skiplist_map<int, int>;
+
+TEST(skiplist_map, singleThread) {
+  s21::skiplist_map<std::string, int> m{{"b", 2}, {"a", 1}, {"c", 3}};
+
+  EXPECT_EQ(m.size(), 3U);
+  EXPECT_EQ((*m.begin()).first, "a");
+  EXPECT_FALSE(m.insert("a", 10).second);
+  EXPECT_EQ(m.at("a"), 1);
+  EXPECT_THROW(m.at("d"), std::out_of_range);
+  EXPECT_TRUE(m.find("d") == m.end());
+  EXPECT_EQ((*m.lower_bound("bb")).first, "c");
+  EXPECT_EQ(m.erase("c"), 1U);
+  EXPECT_EQ(m.erase("c"), 0U);
+  EXPECT_FALSE(m.contains("c"));
+  EXPECT_TRUE(m.lower_bound("bb") == m.end());
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.begin() == m.end());
+}
+
+TEST(skiplist_map, randomOperations) {
+  std::mt19937 rng{19};
+  s21_skiplist_map m;
+  std::map<int, int> std_m;
+
+  for (int step = 0; step < 20000; ++step) {
+    int key = rng() % 700;
+
+    if (rng() % 2) {
+      auto [it, inserted] = m.insert(key, step);
+      auto [std_it, std_inserted] = std_m.insert({key, step});
+
+      EXPECT_EQ(inserted, std_inserted);
+      EXPECT_EQ((*it).second, std_it->second);
+    } else {
+      EXPECT_EQ(m.erase(key), std_m.erase(key));
+    }
+  }
+
+  std::vector<std::pair<int, int>> items;
+
+  for (auto it = m.begin(); it != m.end(); ++it) {
+    items.push_back(*it);
+  }
+
+  EXPECT_EQ(m.size(), std_m.size());
+  EXPECT_EQ(items,
+            (std::vector<std::pair<int, int>>(std_m.begin(), std_m.end())));
+}
+
+TEST(skiplist_map, parallelUpdates) {
+  constexpr int kThreads = 4;
+  constexpr int kKeys = 2000;
+  s21_skiplist_map m;
+  std::atomic<int> inserted{};
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&m, &inserted, t] {
+      for (int key = 0; key < kKeys; ++key) {
+        inserted += m.insert(key, key).second;
+        m.insert(kKeys + t * kKeys + key, key);
+      }
+
+      for (int key = 0; key < kKeys; key += 2) {
+        m.erase(kKeys + t * kKeys + key);
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(inserted, kKeys);
+  EXPECT_EQ(m.size(), static_cast<std::size_t>(kKeys + kThreads * kKeys / 2));
+
+  for (int key = 0; key < kThreads * kKeys; ++key) {
+    EXPECT_EQ(m.contains(kKeys + key), key % 2 == 1);
+  }
+}
+
+TEST(skiplist_map, iterateWhileUpdating) {
+  constexpr int kKeys = 1000;
+  s21_skiplist_map m;
+  std::atomic<bool> done{};
+
+  for (int key = 0; key < kKeys; key += 2) {
+    m.insert(key, key);
+  }
+
+  std::thread writer{[&m, &done] {
+    std::mt19937 rng{23};
+
+    while (!done) {
+      int key = rng() % kKeys;
+
+      if (key % 2) {
+        m.insert(key, key);
+      } else {
+        m.erase(key + 1);
+      }
+    }
+  }};
+
+  for (int pass = 0; pass < 50; ++pass) {
+    int previous = -1;
+    int stable = 0;
+
+    for (auto it = m.begin(); it != m.end(); ++it) {
+      EXPECT_LT(previous, (*it).first);
+      EXPECT_EQ((*it).first, (*it).second);
+      stable += (*it).first % 2 == 0;
+      previous = (*it).first;
+    }
+
+    EXPECT_EQ(stable, kKeys / 2);
+  }
+
+  done = true;
+  writer.join();
+}
\ No newline at end of file
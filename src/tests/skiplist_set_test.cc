@@ -0,0 +1,72 @@
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_skiplist_set = s21::skiplist_set<int>;
+
+TEST(skiplist_set, insertErase) {
+  s21_skiplist_set s{5, 1, 3, 1};
+
+  EXPECT_EQ(s.size(), 3U);
+  EXPECT_EQ(*s.begin(), 1);
+  EXPECT_EQ(*s.insert(2).first, 2);
+  EXPECT_FALSE(s.insert(2).second);
+  EXPECT_EQ(*++s.begin(), 2);
+  EXPECT_EQ(s.erase(5), 1U);
+  EXPECT_FALSE(s.contains(5));
+  EXPECT_TRUE(s.find(4) == s.end());
+  EXPECT_TRUE(s.lower_bound(4) == s.end());
+  EXPECT_EQ(*s.lower_bound(0), 1);
+}
+
+TEST(skiplist_set, parallelRandom) {
+  constexpr int kThreads = 4;
+  s21_skiplist_set s;
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&s, t] {
+      std::mt19937 rng(t);
+
+      for (int step = 0; step < 5000; ++step) {
+        int key = rng() % 256 * kThreads + t;
+
+        if (rng() % 3) {
+          s.insert(key);
+        } else {
+          s.erase(key);
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::set<int> std_s;
+
+  for (int t = 0; t < kThreads; ++t) {
+    std::mt19937 rng(t);
+
+    for (int step = 0; step < 5000; ++step) {
+      int key = rng() % 256 * kThreads + t;
+
+      if (rng() % 3) {
+        std_s.insert(key);
+      } else {
+        std_s.erase(key);
+      }
+    }
+  }
+
+  std::vector<int> keys;
+
+  s.for_each([&keys](int key) { keys.push_back(key); });
+
+  EXPECT_EQ(s.size(), std_s.size());
+  EXPECT_EQ(keys, std::vector<int>(std_s.begin(), std_s.end()));
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_small_vector = s21::small_vector<int, 4>;
+
+TEST(small_vector, inlineThenSpill) {
+  s21_small_vector v{1, 2, 3};
+
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4U);
+  v.push_back(4);
+  EXPECT_TRUE(v.is_inline());
+  v.push_back(5);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 8U);
+  EXPECT_EQ(v.size(), 5U);
+  EXPECT_EQ(v.front(), 1);
+  EXPECT_EQ(v.back(), 5);
+  EXPECT_EQ(v.at(4), 5);
+  EXPECT_THROW(v.at(5), std::out_of_range);
+  v.pop_back();
+  v.shrink_to_fit();
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4U);
+  compare(v, std::vector<int>{1, 2, 3, 4});
+}
+
+TEST(small_vector, moveAndSwap) {
+  s21_small_vector small{1, 2};
+  s21_small_vector large{1, 2, 3, 4, 5, 6};
+  const int *heap = large.data();
+  s21_small_vector moved(std::move(large));
+
+  EXPECT_EQ(moved.data(), heap);
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(large.is_inline());
+  small.swap(moved);
+  EXPECT_EQ(small.data(), heap);
+  EXPECT_TRUE(moved.is_inline());
+  compare(moved, std::vector<int>{1, 2});
+  moved = std::move(small);
+  EXPECT_EQ(moved.data(), heap);
+  small = moved;
+  EXPECT_FALSE(small.is_inline());
+  compare(small, std::vector<int>{1, 2, 3, 4, 5, 6});
+  small = s21_small_vector{7};
+  EXPECT_EQ(small.size(), 1U);
+  EXPECT_EQ(small[0], 7);
+}
+
+TEST(small_vector, insertMany) {
+  s21_small_vector v{1, 5};
+  auto it = v.insert_many(v.begin() + 1, 2, 3);
+
+  EXPECT_EQ(*it, 5);
+  EXPECT_TRUE(v.is_inline());
+  v.insert_many(v.cend() - 1, 4);
+  v.insert_many_back(6, 7);
+  EXPECT_FALSE(v.is_inline());
+  compare(v, std::vector<int>{1, 2, 3, 4, 5, 6, 7});
+  v.emplace(v.begin(), v[6]);
+  v.insert(v.begin() + 1, v.begin(), v.begin() + 2);
+  compare(v, std::vector<int>{7, 7, 1, 1, 2, 3, 4, 5, 6, 7});
+}
+
+TEST(small_vector, rangesAndErase) {
+  std::list<int> source{1, 2, 3, 4, 5, 6, 7, 8};
+  s21_small_vector v;
+
+  v.assign(source.begin(), source.end());
+  EXPECT_EQ(v.capacity(), 8U);
+  EXPECT_EQ(*v.erase(v.begin() + 1, v.begin() + 3), 4);
+  EXPECT_EQ(*v.erase(v.begin()), 4);
+  EXPECT_EQ(v.erase_if([](int x) { return x % 2 == 0; }), 3U);
+  compare(v, std::vector<int>{5, 7});
+  v.append_range(std::vector<int>{9, 11});
+  compare(v, std::vector<int>{5, 7, 9, 11});
+  v.clear();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(small_vector, elementLifetimes) {
+  {
+    s21::small_vector<Tracked, 2> v;
+
+    v.emplace_back(1);
+    v.push_back(Tracked(2));
+    EXPECT_EQ(Tracked::live, 2);
+    v.insert(v.begin(), Tracked(3));
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_EQ(Tracked::live, 3);
+
+    s21::small_vector<Tracked, 2> copy(v);
+
+    EXPECT_EQ(Tracked::live, 6);
+    copy.erase(copy.begin(), copy.begin() + 2);
+    copy.shrink_to_fit();
+    EXPECT_TRUE(copy.is_inline());
+    EXPECT_EQ(Tracked::live, 4);
+    v.swap(copy);
+    EXPECT_EQ(Tracked::live, 4);
+    EXPECT_EQ(v.front().value, 2);
+    EXPECT_EQ(copy.front().value, 3);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(small_vector, ownedElements) {
+  s21::small_vector<std::unique_ptr<int>, 2> v;
+
+  v.emplace_back(std::make_unique<int>(1));
+  v.emplace_back(std::make_unique<int>(2));
+  v.emplace(v.begin(), std::make_unique<int>(0));
+
+  s21::small_vector<std::unique_ptr<int>, 2> moved(std::move(v));
+
+  EXPECT_EQ(*moved[0], 0);
+  EXPECT_EQ(*moved[2], 2);
+  moved.erase(moved.begin());
+  moved.shrink_to_fit();
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(*moved.back(), 2);
+}
+
+TEST(small_vector, shiftsBatchesInPlace) {
+  s21::small_vector<int, 8> v = {0, 1, 2, 3};
+  std::vector<int> batch(100, 7);
+  std::vector<int> expected = {0, 1};
+
+  v.reserve(200);
+
+  const int *storage = v.data();
+
+  expected.insert(expected.end(), batch.begin(), batch.end());
+  expected.insert(expected.end(), {2, 3});
+  v.insert(v.begin() + 2, batch.begin(), batch.end());
+
+  EXPECT_EQ(v.data(), storage);
+  EXPECT_EQ(std::vector<int>(v.begin(), v.end()), expected);
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "./main_test.h"
+
+using s21_static_vector = s21::static_vector<int, 4>;
+
+namespace {
+
+/// @brief Builds a static vector at compile time.
+constexpr s21_static_vector makeConstant() {
+  s21_static_vector v{2, 4};
+
+  v.push_back(5);
+  v.insert(v.begin(), 1);
+  v.erase(v.begin() + 2);
+  v.insert_many(v.begin() + 2, 3);
+  return v;
+}
+
+constexpr s21_static_vector kConstant = makeConstant();
+
+static_assert(kConstant.size() == 4);
+static_assert(kConstant.full());
+static_assert(kConstant[0] == 1 && kConstant[2] == 3 && kConstant.back() == 5);
+
+/// @brief An element that can be moved but not assigned.
+struct Pinned {
+  int value;
+
+  explicit Pinned(int x) : value(x) {}
+  Pinned(Pinned &&) = default;
+  Pinned &operator=(Pinned &&) = delete;
+};
+
+}  // namespace
+
+TEST(static_vector, pushAndOverflow) {
+  s21_static_vector v;
+
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 4U);
+  v.push_back(1);
+  v.insert_many_back(2, 3);
+  EXPECT_TRUE(v.try_push_back(4));
+  EXPECT_TRUE(v.full());
+  EXPECT_FALSE(v.try_push_back(5));
+  EXPECT_EQ(v.try_emplace_back(5), nullptr);
+  EXPECT_THROW(v.push_back(5), std::length_error);
+  EXPECT_THROW(v.insert(v.begin(), 0), std::length_error);
+  EXPECT_THROW(v.insert_many_back(5), std::length_error);
+  EXPECT_THROW(v.reserve(5), std::length_error);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+  EXPECT_THROW(s21_static_vector(5), std::length_error);
+  EXPECT_THROW((s21_static_vector{1, 2, 3, 4, 5}), std::length_error);
+  compare(v, std::vector<int>{1, 2, 3, 4});
+  compare(kConstant, std::vector<int>{1, 2, 3, 5});
+}
+
+TEST(static_vector, insertAndErase) {
+  s21_static_vector v{1, 4};
+  std::list<int> source{2, 3};
+
+  EXPECT_EQ(*v.insert(v.begin() + 1, source.begin(), source.end()), 2);
+  compare(v, std::vector<int>{1, 2, 3, 4});
+  EXPECT_EQ(*v.erase(v.begin() + 1, v.begin() + 3), 4);
+
+  auto it = v.erase(v.end() - 1);
+
+  EXPECT_EQ(it, v.end());
+  v.emplace(v.begin(), v[0]);
+  EXPECT_EQ(*v.insert_many(v.begin() + 1, 7, 8), 1);
+  compare(v, std::vector<int>{1, 7, 8, 1});
+  EXPECT_EQ(v.erase_if([](int x) { return x == 1; }), 2U);
+  compare(v, std::vector<int>{7, 8});
+  v.assign(source.begin(), source.end());
+  v.append_range(std::vector<int>{9});
+  compare(v, std::vector<int>{2, 3, 9});
+  EXPECT_THROW(v.append_range(std::vector<int>{1, 2}), std::length_error);
+  compare(v, std::vector<int>{2, 3, 9});
+}
+
+TEST(static_vector, ownedElements) {
+  s21::static_vector<std::string, 3> v{"b"};
+
+  v.insert(v.begin(), "a");
+  v.emplace_back(2, 'c');
+
+  s21::static_vector<std::string, 3> copy(v);
+  s21::static_vector<std::string, 3> other{"x"};
+
+  EXPECT_THROW(copy.emplace_back("d"), std::length_error);
+  other.swap(copy);
+  EXPECT_EQ(copy.size(), 1U);
+  EXPECT_EQ(other.back(), "cc");
+  other = copy;
+  compare(other, std::vector<std::string>{"x"});
+  copy = std::move(v);
+  compare(copy, std::vector<std::string>{"a", "b", "cc"});
+  copy.pop_back();
+  copy.clear();
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(static_vector, notAssignable) {
+  s21::static_vector<std::unique_ptr<int>, 2> owners;
+  s21::static_vector<Pinned, 2> pinned;
+
+  owners.emplace_back(std::make_unique<int>(2));
+  owners.insert(owners.begin(), std::make_unique<int>(1));
+  EXPECT_EQ(*owners.front(), 1);
+  pinned.emplace_back(1);
+  pinned.insert_many_back(Pinned(2));
+  EXPECT_EQ(pinned.back().value, 2);
+  EXPECT_EQ(pinned.try_emplace_back(3), nullptr);
+}
+
+TEST(static_vector, largeTrivial) {
+  s21::static_vector<int, 1024> v{1, 2, 3};
+
+  v.insert_many(v.begin() + 1, 7, 8);
+  v.push_back(4);
+
+  s21::static_vector<int, 1024> copy(v);
+
+  copy.erase(copy.begin() + 1, copy.begin() + 3);
+  v = copy;
+  while (v.try_push_back(0)) {
+  }
+  EXPECT_TRUE(v.full());
+  EXPECT_THROW(v.push_back(5), std::length_error);
+  compare(copy, std::vector<int>{1, 2, 3, 4});
+  EXPECT_EQ(v.back(), 0);
+  EXPECT_EQ(v[3], 4);
+}
\ No newline at end of file
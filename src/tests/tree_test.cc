@@ -1,3 +1,8 @@
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "./main_test.h"
 
 using tree = s21::tree<const int, int>;
@@ -1007,4 +1012,262 @@ TEST(treeIterator, treeIterateCheck_19) {
   EXPECT_NE(it1, it2);
   it1 = it1 - 1;
   EXPECT_EQ(it1, it2);
+}
+
+TEST(tree, eraseRandomOrder) {
+  tree t;
+  std::set<int> std_s;
+
+  for (int i = 0; i < 2000; ++i) {
+    int key = (i * 7919) % 1543;
+    t.insert({key, key});
+    std_s.insert(key);
+  }
+
+  for (int i = 0; i < 1500; ++i) {
+    int key = (i * 104729) % 1543;
+    t.erase(key);
+    std_s.erase(key);
+  }
+
+  auto std_it = std_s.begin();
+  for (auto i : t) {
+    EXPECT_EQ(i.first, *std_it++);
+  }
+  EXPECT_EQ(t.size(), std_s.size());
+}
+
+TEST(tree, insertManySweep) {
+  tree t;
+  for (int i = 0; i < 1000; ++i) t.insert({i * 3, i});
+
+  auto result = t.insert_many(pair{7, 1}, pair{3, 1}, pair{2997, 1},
+                              pair{7, 2}, pair{5000, 1});
+  bool inserted[] = {true, false, false, false, true};
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(result[i].second, inserted[i]);
+  }
+  EXPECT_EQ((*result[0].first).second, 1);
+  EXPECT_EQ((*result[4].first).first, 5000);
+  EXPECT_EQ(t.size(), 1002);
+  EXPECT_EQ((*t.find(7)).second, 1);
+}
+
+TEST(tree, insertManyRebuild) {
+  tree t{{15, 15}, {9, 9}, {13, 13}};
+  std::set<int> std_s = {15, 9, 13};
+  std::vector<std::pair<int, int>> items;
+
+  for (int i = 0; i < 500; ++i) items.push_back({(i * 37) % 211, i});
+
+  auto result = t.insert_range(
+      items.cbegin(), items.cend(),
+      [](const std::pair<int, int> &item) { return pair{item}; });
+
+  for (int i = 0; i < 500; ++i) {
+    EXPECT_EQ(result[i].second, std_s.insert(items[i].first).second);
+  }
+
+  auto std_it = std_s.begin();
+  for (auto i : t) {
+    EXPECT_EQ(i.first, *std_it++);
+  }
+  EXPECT_EQ(t.size(), std_s.size());
+
+  for (int i = 0; i < 211; i += 2) {
+    t.erase(i);
+    std_s.erase(i);
+  }
+
+  std_it = std_s.begin();
+  for (auto i : t) {
+    EXPECT_EQ(i.first, *std_it++);
+  }
+  EXPECT_EQ(t.size(), std_s.size());
+}
+
+TEST(tree, insertManyReportsExisting) {
+  tree small{{1, 10}, {2, 20}};
+  auto rebuilt = small.insert_many(pair{2, 0}, pair{3, 30}, pair{3, 0});
+
+  EXPECT_FALSE(rebuilt[0].second);
+  EXPECT_EQ((*rebuilt[0].first).second, 20);
+  EXPECT_TRUE(rebuilt[1].second);
+  EXPECT_FALSE(rebuilt[2].second);
+  EXPECT_EQ((*rebuilt[2].first).second, 30);
+
+  tree large;
+  for (int i = 0; i < 1000; ++i) large.insert({i * 3, i});
+
+  auto swept = large.insert_many(pair{3, 0}, pair{7, 7});
+
+  EXPECT_FALSE(swept[0].second);
+  EXPECT_EQ((*swept[0].first).first, 3);
+  EXPECT_EQ((*swept[0].first).second, 1);
+  EXPECT_EQ((*++swept[0].first).first, 6);
+}
+
+TEST(tree, insertManyThrowingValue) {
+  struct Fragile {
+    Fragile() = default;
+    explicit Fragile(int v) : value(v) {
+      if (v < 0) throw std::runtime_error("negative");
+    }
+    int value{};
+  };
+  s21::tree<const int, Fragile> t;
+  using fragile_pair = std::pair<const int, Fragile>;
+
+  t.insert_many(fragile_pair{1, Fragile{1}});
+  EXPECT_THROW(t.insert_many(std::pair<int, int>{2, 2},
+                             std::pair<int, int>{3, -1},
+                             std::pair<int, int>{4, 4}),
+               std::runtime_error);
+  EXPECT_EQ(t.size(), 1);
+  EXPECT_EQ((*t.begin()).second.value, 1);
+}
+
+TEST(tree, emplaceReturnsExisting) {
+  tree t{{1, 1}, {2, 2}};
+
+  auto result = t.emplace(2, 20);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second, 2);
+
+  result = t.try_emplace(3, 30);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).second, 30);
+
+  (*result.first).second = 33;
+  EXPECT_EQ((*t.find(3)).second, 33);
+  EXPECT_EQ(t.size(), 3U);
+}
+
+TEST(tree, boundsNonUnique) {
+  s21::tree<const int, int> t{tree::kNON_UNIQUE};
+  std::multiset<int> std_s;
+
+  for (int i = 0; i < 300; ++i) {
+    t.insert({(i * 7) % 50, i});
+    std_s.insert((i * 7) % 50);
+  }
+
+  for (int key = -1; key < 52; ++key) {
+    EXPECT_EQ(t.count(key), std_s.count(key));
+    if (std_s.lower_bound(key) != std_s.end()) {
+      EXPECT_EQ((*t.lower_bound(key)).first, *std_s.lower_bound(key));
+    } else {
+      EXPECT_TRUE(t.lower_bound(key) == t.end());
+    }
+    if (std_s.upper_bound(key) != std_s.end()) {
+      EXPECT_EQ((*t.upper_bound(key)).first, *std_s.upper_bound(key));
+    } else {
+      EXPECT_TRUE(t.upper_bound(key) == t.end());
+    }
+  }
+}
+
+TEST(tree, transparentErase) {
+  s21::tree<std::string, int, std::less<>> t{{"a", 1}, {"b", 2}, {"c", 3}};
+
+  auto it = t.erase(std::string_view{"b"});
+  EXPECT_EQ((*it).first, "c");
+  EXPECT_EQ(t.count(std::string_view{"b"}), 0U);
+  EXPECT_EQ(t.size(), 2U);
+}
+
+struct CountingThreeWay {
+  using is_three_way = void;
+
+  int *calls;
+
+  int operator()(int a, int b) const {
+    ++*calls;
+    return (a < b) ? -1 : (a > b);
+  }
+};
+
+TEST(tree, threeWayOneCallPerLevel) {
+  int calls{};
+  s21::tree<const int, int, CountingThreeWay> t{CountingThreeWay{&calls}};
+
+  for (int i = 0; i < 1023; ++i) {
+    t.insert({i, i});
+  }
+
+  for (int key : {0, 511, 1000, 2000}) {
+    calls = 0;
+    t.find(key);
+    EXPECT_LE(calls, 20);
+  }
+
+  EXPECT_EQ(t.count(512), 1U);
+  EXPECT_EQ((*t.lower_bound(-5)).first, 0);
+}
+
+TEST(tree, branchlessFind) {
+  using desc_tree = s21::tree<const double, int, std::greater<double>>;
+  desc_tree t{desc_tree::kNON_UNIQUE};
+  std::multiset<double, std::greater<double>> std_s;
+
+  for (int i = 0; i < 500; ++i) {
+    t.insert({(i * 13) % 97 * 0.5, i});
+    std_s.insert((i * 13) % 97 * 0.5);
+  }
+
+  for (int i = -2; i < 100; ++i) {
+    double key = i * 0.5;
+    EXPECT_EQ(t.find(key) != t.end(), std_s.count(key) != 0);
+    if (t.find(key) != t.end()) {
+      EXPECT_EQ((*t.find(key)).first, key);
+    }
+  }
+
+  EXPECT_TRUE(t.find(0.25) == t.end());
+  EXPECT_EQ((*t.begin()).first, 48.0);
+}
+
+TEST(tree, threadedIteration) {
+  using threaded = s21::tree<const int, int, std::less<int>, true>;
+  threaded t{threaded::kNON_UNIQUE};
+  std::multiset<int> std_s;
+
+  for (int i = 0; i < 400; ++i) {
+    t.insert({(i * 37) % 101, i});
+    std_s.insert((i * 37) % 101);
+  }
+
+  for (int key = 0; key < 101; key += 3) {
+    auto next = t.erase(key);
+    std_s.erase(std_s.find(key));
+    EXPECT_EQ((*next).first, *std_s.lower_bound(key));
+  }
+
+  auto std_it = std_s.begin();
+
+  for (auto it = t.begin(); it != t.end(); ++it, ++std_it) {
+    EXPECT_EQ((*it).first, *std_it);
+  }
+
+  auto it = t.end();
+
+  for (auto std_rit = std_s.rbegin(); std_rit != std_s.rend(); ++std_rit) {
+    EXPECT_EQ((*--it).first, *std_rit);
+  }
+
+  EXPECT_TRUE(it == t.begin());
+  EXPECT_EQ(t.size(), std_s.size());
+}
+
+TEST(tree, threadedEraseLast) {
+  s21::tree<const int, int, std::less<int>, true> t{{1, 1}, {2, 2}};
+
+  EXPECT_TRUE(t.erase(2) == t.end());
+  EXPECT_TRUE(t.erase(1) == t.end());
+  EXPECT_TRUE(t.begin() == t.end());
+
+  t.insert({3, 3});
+  EXPECT_EQ((*t.begin()).first, 3);
+  EXPECT_TRUE(++t.begin() == t.end());
 }
\ No newline at end of file
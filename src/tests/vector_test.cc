@@ -1,3 +1,9 @@
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "./main_test.h"
@@ -518,4 +524,379 @@ TEST(vector, InsertManyBack_Empty) {
   EXPECT_EQ(vec[0], 1);
   EXPECT_EQ(vec[1], 2);
   EXPECT_EQ(vec[2], 3);
+}
+
+TEST(vector, RawStorage_OnlyLiveElementsConstructed) {
+  {
+    s21::vector<Tracked> v;
+    v.reserve(100);
+    EXPECT_EQ(Tracked::live, 0);
+
+    for (int i = 0; i < 10; ++i) v.push_back(Tracked(i));
+    EXPECT_EQ(Tracked::live, 10);
+
+    v.insert(v.begin() + 2, Tracked(42));
+    v.erase(v.begin());
+    v.pop_back();
+    EXPECT_EQ(Tracked::live, 9);
+    EXPECT_EQ(v[1].value, 42);
+
+    v.shrink_to_fit();
+    EXPECT_EQ(Tracked::live, 9);
+
+    s21::vector<Tracked> copy(v);
+    EXPECT_EQ(Tracked::live, 18);
+
+    v.clear();
+    EXPECT_EQ(Tracked::live, 9);
+  }
+  EXPECT_EQ(Tracked::live, 0);
+}
+
+struct NoDefault {
+  static inline int constructed = 0;
+  static inline int destroyed = 0;
+  int value;
+
+  NoDefault() = delete;
+  explicit NoDefault(int v) : value(v) { ++constructed; }
+  NoDefault(const NoDefault &other) : value(other.value) { ++constructed; }
+  NoDefault &operator=(const NoDefault &other) = default;
+  ~NoDefault() { ++destroyed; }
+
+  static void reset() { constructed = destroyed = 0; }
+};
+
+TEST(vector, RawStorage_NoDefaultConstructor) {
+  s21::vector<NoDefault> v = {NoDefault(1), NoDefault(2)};
+
+  v.push_back(NoDefault(3));
+  v.insert(v.begin(), NoDefault(0));
+  v.reserve(64);
+
+  EXPECT_EQ(v.size(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i].value, i);
+}
+
+TEST(vector, RawStorage_ReserveConstructsNothing) {
+  NoDefault::reset();
+  {
+    s21::vector<NoDefault> v;
+
+    v.reserve(1000);
+    EXPECT_EQ(NoDefault::constructed, 0);
+    EXPECT_GE(v.capacity(), 1000);
+
+    v.push_back(NoDefault(5));
+    int after_push = NoDefault::constructed;
+
+    v.reserve(5000);
+    EXPECT_EQ(NoDefault::constructed - NoDefault::destroyed, 1);
+    EXPECT_LE(NoDefault::constructed - after_push, 1);
+  }
+  EXPECT_EQ(NoDefault::constructed, NoDefault::destroyed);
+}
+
+TEST(vector, RawStorage_DestroysExactlyLiveElements) {
+  NoDefault::reset();
+  s21::vector<NoDefault> v;
+
+  v.reserve(16);
+  for (int i = 0; i < 5; ++i) v.emplace_back(i);
+
+  int destroyed = NoDefault::destroyed;
+
+  v.pop_back();
+  EXPECT_EQ(NoDefault::destroyed - destroyed, 1);
+
+  v.pop_back();
+  EXPECT_EQ(NoDefault::destroyed - destroyed, 2);
+
+  v.clear();
+  EXPECT_EQ(NoDefault::destroyed - destroyed, 5);
+  EXPECT_EQ(NoDefault::constructed, NoDefault::destroyed);
+  EXPECT_EQ(v.size(), 0);
+  EXPECT_GE(v.capacity(), 16);
+}
+
+TEST(vector, PushBack_OwnElementOnGrowth) {
+  s21::vector<std::string> v = {"a long string that is not stored inline"};
+
+  for (int i = 0; i < 6; ++i) v.push_back(v[0]);
+
+  EXPECT_EQ(v.size(), 7);
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], v[0]);
+}
+
+struct Counted {
+  static inline int copies = 0;
+  static inline int moves = 0;
+  int value;
+
+  explicit Counted(int v) : value(v) {}
+  Counted(const Counted &other) : value(other.value) { ++copies; }
+  Counted(Counted &&other) noexcept : value(other.value) { ++moves; }
+  Counted &operator=(const Counted &other) = default;
+  Counted &operator=(Counted &&other) noexcept = default;
+};
+
+struct ThrowingMove {
+  static inline int copies = 0;
+  int value;
+
+  explicit ThrowingMove(int v) : value(v) {}
+  ThrowingMove(const ThrowingMove &other) : value(other.value) { ++copies; }
+  ThrowingMove(ThrowingMove &&other) : value(other.value) {}
+};
+
+TEST(vector, Reallocation_MovesNothrowMovable) {
+  Counted::copies = 0;
+  s21::vector<Counted> v;
+
+  for (int i = 0; i < 100; ++i) v.emplace_back(i);
+  v.push_back(Counted(100));
+  v.emplace(v.cbegin() + 50, -1);
+  v.insert(v.begin(), Counted(-2));
+  v.shrink_to_fit();
+
+  EXPECT_EQ(Counted::copies, 0);
+  EXPECT_EQ(v.size(), 103);
+  EXPECT_EQ(v[0].value, -2);
+  EXPECT_EQ(v[51].value, -1);
+  EXPECT_EQ(v[102].value, 100);
+}
+
+TEST(vector, Reallocation_CopiesThrowingMovable) {
+  ThrowingMove::copies = 0;
+  s21::vector<ThrowingMove> v;
+
+  v.emplace_back(1);
+  v.emplace_back(2);
+
+  EXPECT_EQ(ThrowingMove::copies, 1);
+  EXPECT_EQ(v[0].value, 1);
+  EXPECT_EQ(v[1].value, 2);
+}
+
+TEST(vector, Reallocation_MovesNestedContainers) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::vector<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::list<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::map<int, int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::set<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::multiset<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::flat_map<int, int>>);
+
+  Counted::copies = 0;
+  s21::vector<s21::vector<Counted>> v;
+
+  for (int i = 0; i < 9; ++i) {
+    s21::vector<Counted> inner;
+
+    inner.emplace_back(i);
+    v.push_back(std::move(inner));
+  }
+  v.insert(v.begin(), s21::vector<Counted>());
+
+  EXPECT_EQ(Counted::copies, 0);
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_TRUE(v[0].empty());
+  EXPECT_EQ(v[9][0].value, 8);
+}
+
+TEST(vector, MoveOnlyElements) {
+  s21::vector<std::unique_ptr<int>> v;
+
+  for (int i = 0; i < 10; ++i) v.push_back(std::make_unique<int>(i));
+  v.emplace(v.cbegin(), new int(-1));
+  v.erase(v.begin() + 5);
+
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_EQ(*v[0], -1);
+  EXPECT_EQ(*v[5], 5);
+  EXPECT_EQ(*v[9], 9);
+}
+
+struct Owner {
+  std::unique_ptr<int> ptr;
+
+  explicit Owner(int v) : ptr(std::make_unique<int>(v)) {}
+  Owner(Owner &&other) noexcept(false) : ptr(std::move(other.ptr)) {}
+};
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<Owner> : std::true_type {};
+}  // namespace s21
+
+struct Point {
+  int x;
+  double y;
+};
+
+TEST(vector, TriviallyCopyable_BulkPaths) {
+  s21::vector<Point> v;
+
+  for (int i = 0; i < 1000; ++i) v.push_back({i, i * 0.5});
+  v.erase(v.begin() + 10);
+  v.insert(v.begin() + 20, {-1, -1.0});
+  s21::vector<Point> copy(v);
+
+  EXPECT_EQ(copy.size(), 1000);
+  EXPECT_EQ(copy[9].x, 9);
+  EXPECT_EQ(copy[10].x, 11);
+  EXPECT_EQ(copy[20].x, -1);
+  EXPECT_EQ(copy[999].x, 999);
+  EXPECT_DOUBLE_EQ(copy[999].y, 499.5);
+}
+
+TEST(vector, TriviallyRelocatable_DeclaredType) {
+  s21::vector<Owner> v;
+
+  for (int i = 0; i < 100; ++i) v.emplace_back(i);
+  v.erase(v.begin());
+  v.emplace(v.cbegin() + 10, -1);
+  v.shrink_to_fit();
+
+  EXPECT_EQ(v.size(), 100);
+  EXPECT_EQ(*v[0].ptr, 1);
+  EXPECT_EQ(*v[10].ptr, -1);
+  EXPECT_EQ(*v[11].ptr, 11);
+  EXPECT_EQ(*v[99].ptr, 99);
+}
+
+TEST(vector, Insert_InPlaceWithSpareCapacity) {
+  s21::vector<std::string> v = {"a", "a", "a"};
+  v.reserve(8);
+  std::string *storage = v.data();
+
+  v.insert(v.begin() + 2, "b");
+  v.insert(v.begin(), v[3]);
+  auto it = v.insert_many(v.cbegin() + 1, "c", "d", "e");
+
+  EXPECT_EQ(v.data(), storage);
+  EXPECT_EQ(v.capacity(), 8);
+  EXPECT_EQ(it - v.begin(), 4);
+  s21::vector<std::string> expected = {"a", "c", "d", "e", "a", "a", "b", "a"};
+  for (size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(vector, InsertMany_GrowsOnce) {
+  s21::vector<int> v = {1, 2, 3};
+
+  v.insert_many(v.cbegin() + 1, 4, 5, 6, 7, 8);
+  v.insert_many_back(9);
+
+  EXPECT_EQ(v.size(), 9);
+  EXPECT_EQ(v.capacity(), 16);
+  int expected[] = {1, 4, 5, 6, 7, 8, 2, 3, 9};
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(vector, InsertRange) {
+  s21::vector<std::string> v = {"a", "e"};
+  std::vector<std::string> middle = {"b", "c", "d"};
+  std::istringstream words("x y");
+
+  EXPECT_EQ(*v.insert(v.begin() + 1, middle.begin(), middle.end()), "b");
+  v.insert(v.end(), v.begin(), v.begin() + 2);
+  v.insert(v.begin(), std::istream_iterator<std::string>(words),
+           std::istream_iterator<std::string>());
+
+  s21::vector<std::string> expected = {"x", "y", "a", "b", "c",
+                                       "d", "e", "a", "b"};
+  ASSERT_EQ(v.size(), expected.size());
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(vector, AssignAndAppendRange) {
+  s21::vector<int> v = {9, 9, 9, 9, 9, 9, 9, 9};
+  std::vector<int> digits = {1, 2, 3};
+  size_t capacity = v.capacity();
+
+  v.assign(digits.begin(), digits.end());
+  v.append_range(digits);
+  v.append_range(s21::vector<int>{4, 5});
+
+  EXPECT_EQ(v.capacity(), capacity);
+  int expected[] = {1, 2, 3, 1, 2, 3, 4, 5};
+  ASSERT_EQ(v.size(), 8);
+  for (size_t i = 0; i < v.size(); ++i) EXPECT_EQ(v[i], expected[i]);
+}
+
+TEST(vector, EraseRangeAndIf) {
+  s21::vector<std::string> words = {"a", "bb", "c", "dd", "e", "ff"};
+  s21::vector<Owner> owners;
+  for (int i = 0; i < 10; ++i) owners.emplace_back(i);
+
+  EXPECT_EQ(*words.erase(words.begin() + 1, words.begin() + 3), "dd");
+  size_t removed =
+      words.erase_if([](const std::string &s) { return s.size() == 2; });
+  owners.erase(owners.begin() + 2, owners.begin() + 4);
+  owners.erase_if([](const Owner &o) { return *o.ptr % 2 == 1; });
+
+  EXPECT_EQ(removed, 2);
+  ASSERT_EQ(words.size(), 2);
+  EXPECT_EQ(words[0], "a");
+  EXPECT_EQ(words[1], "e");
+  int expected[] = {0, 4, 6, 8};
+  ASSERT_EQ(owners.size(), 4);
+  for (size_t i = 0; i < owners.size(); ++i)
+    EXPECT_EQ(*owners[i].ptr, expected[i]);
+}
+
+TEST(vector, GrowthPolicies) {
+  s21::vector<int, s21::growth_counted<s21::growth_three_halves>> halves;
+  s21::vector<int, s21::growth_step<100>> stepped;
+  s21::vector<int, s21::growth_paged<>> paged;
+
+  for (int i = 0; i < 1000; ++i) {
+    halves.push_back(i);
+    stepped.push_back(i);
+  }
+  paged.push_back(1);
+  halves.reserve(2000);
+
+  EXPECT_EQ(stepped.capacity(), 1000);
+  EXPECT_EQ(paged.capacity(), 4096 / sizeof(int));
+  EXPECT_EQ(halves.capacity(), 2000);
+  EXPECT_EQ(halves.growth().reallocations(), 18);
+  EXPECT_GT(halves.growth().bytes_copied(), 1000 * sizeof(int));
+  EXPECT_EQ(halves[999], 999);
+  EXPECT_EQ(sizeof(s21::vector<int>), 3 * sizeof(void *));
+}
+
+TEST(vector, MappedGrowth) {
+  using policy = s21::growth_counted<s21::growth_mapped<
+      s21::growth_doubling, (std::size_t(1) << 16), true>>;
+  s21::vector<std::uint64_t, policy> v;
+  const std::uint64_t count = 1 << 20;
+
+  for (std::uint64_t i = 0; i < count; ++i) v.push_back(v.empty() ? 0 : i);
+  v.insert(v.begin() + 1, v[count - 1]);
+  v.shrink_to_fit();
+  s21::vector<std::uint64_t, policy> copy(v);
+
+  ASSERT_EQ(copy.size(), count + 1);
+  EXPECT_EQ(copy[1], count - 1);
+  for (std::uint64_t i = 2; i <= count; ++i) ASSERT_EQ(copy[i], i - 1);
+  EXPECT_EQ(v.growth().reallocations(), 22);
+  EXPECT_LT(v.growth().bytes_copied(), std::size_t(1) << 16);
+}
+
+struct alignas(8192) OverAligned {
+  std::uint64_t value;
+  unsigned char padding[8192 - sizeof(std::uint64_t)];
+};
+
+TEST(vector, MappedGrowth_OverAlignedFromBase) {
+  using policy = s21::growth_counted<
+      s21::growth_mapped<s21::growth_doubling, (std::size_t(1) << 16)>>;
+  s21::vector<OverAligned, policy> v;
+
+  for (std::uint64_t i = 0; i < 64; ++i) v.push_back(OverAligned{i, {}});
+
+  ASSERT_EQ(v.size(), 64);
+  for (std::uint64_t i = 0; i < 64; ++i) ASSERT_EQ(v[i].value, i);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data()) % 8192, 0);
+  EXPECT_EQ(v.growth().bytes_copied(), 63 * sizeof(OverAligned));
 }
\ No newline at end of file